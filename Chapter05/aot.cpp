@@ -0,0 +1,33 @@
+#include <cstdint>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+#include "parser/ElfObject.hpp"
+#include "parser/parser.hpp"
+
+// ahead-of-time compiler: wasm module in, AArch64 ELF relocatable object out
+int main(int argc, char **argv) {
+  if ((argc != 3) && (argc != 4)) {
+    std::cerr << "usage: " << argv[0] << " <module.wasm> <output.o> [symbol prefix, default wasm_]" << std::endl;
+    return 1;
+  }
+
+  try {
+    ModuleInfo moduleInfo = processWasmFile(argv[1]);
+    compileOpCode(moduleInfo, 0U);
+    std::vector<uint8_t> const object = emitElfObject(moduleInfo, (argc == 4) ? argv[3] : "wasm_");
+
+    std::ofstream file(argv[2], std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<char const *>(object.data()), static_cast<std::streamsize>(object.size()));
+    if (!file) {
+      std::cerr << "error: failed to write " << argv[2] << std::endl;
+      return 1;
+    }
+  } catch (const std::exception &exception) {
+    std::cerr << exception.what() << std::endl;
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,394 @@
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "parser/ByteSpan.hpp"
+#include "parser/LEB128.hpp"
+#include "parser/Runtime.hpp"
+#include "parser/Stack.hpp"
+#include "parser/parser.hpp"
+
+namespace {
+std::atomic<uint64_t> numAllocations{0U};
+
+void *countedAllocation(size_t const size) {
+  numAllocations.fetch_add(1U, std::memory_order_relaxed);
+  void *const ptr = std::malloc((size == 0U) ? 1U : size);
+  if (ptr == nullptr) {
+    throw std::bad_alloc();
+  }
+  return ptr;
+}
+} // namespace
+
+// count every heap allocation of the benchmark binary, every replaced new is paired with a delete of the same form that frees
+// what malloc returned
+void *operator new(size_t const size) {
+  return countedAllocation(size);
+}
+
+void *operator new[](size_t const size) {
+  return countedAllocation(size);
+}
+
+void operator delete(void *const ptr) noexcept {
+  std::free(ptr);
+}
+
+void operator delete(void *const ptr, size_t) noexcept {
+  std::free(ptr);
+}
+
+void operator delete[](void *const ptr) noexcept {
+  std::free(ptr);
+}
+
+void operator delete[](void *const ptr, size_t) noexcept {
+  std::free(ptr);
+}
+
+namespace {
+///
+/// @brief Run body repeatedly for at least minTime and report the best nanoseconds per item over a few rounds, and the heap
+/// allocations per item of a warmed up run
+void runBenchmark(const std::string &name, size_t const itemsPerRun, const std::function<uint64_t()> &body) {
+  constexpr uint32_t rounds = 5U;
+  constexpr std::chrono::milliseconds minTime{200};
+  double bestNsPerItem = 0.0;
+  uint64_t checksum = body();
+  uint64_t const allocationsBefore = numAllocations.load(std::memory_order_relaxed);
+  static_cast<void>(body());
+  double const allocationsPerItem =
+      static_cast<double>(numAllocations.load(std::memory_order_relaxed) - allocationsBefore) / static_cast<double>(itemsPerRun);
+  for (uint32_t round = 0U; round < rounds; ++round) {
+    uint64_t runs = 0U;
+    auto const start = std::chrono::steady_clock::now();
+    std::chrono::steady_clock::duration elapsed{};
+    do {
+      checksum = body();
+      runs++;
+      elapsed = std::chrono::steady_clock::now() - start;
+    } while (elapsed < minTime);
+    double const nsPerItem = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()) /
+                             static_cast<double>(runs * itemsPerRun);
+    if ((round == 0U) || (nsPerItem < bestNsPerItem)) {
+      bestNsPerItem = nsPerItem;
+    }
+  }
+  std::cout << std::left << std::setw(40) << name << std::right << std::fixed << std::setprecision(3) << std::setw(10) << bestNsPerItem
+            << " ns/item " << std::setw(10) << allocationsPerItem << " allocs/item   (checksum " << checksum << ")" << std::endl;
+}
+
+// decoder used by the parser before the LEB128 fast path, kept as the baseline
+uint32_t legacyReadULEB128(const ByteSpan &data, size_t &index) {
+  uint32_t result = 0;
+  uint32_t shift = 0;
+  const int maxBytes = 5;
+
+  for (int byteCount = 0; byteCount < maxBytes; ++byteCount) {
+    if (index >= data.size()) {
+      throw std::out_of_range("ULEB128 encoding is incomplete or data is truncated.");
+    }
+
+    const uint8_t byte = data[index++];
+    result |= (byte & 0x7FU) << shift;
+
+    if ((byte & 0x80U) == 0) {
+      return result;
+    }
+
+    shift += 7;
+  }
+
+  throw std::overflow_error("ULEB128 encoding exceeds the maximum length for 32-bit integers.");
+}
+
+void encodeULEB128(uint32_t value, std::vector<uint8_t> &out) {
+  do {
+    uint8_t byte = value & 0x7FU;
+    value >>= 7U;
+    if (value != 0U) {
+      byte |= 0x80U;
+    }
+    out.push_back(byte);
+  } while (value != 0U);
+}
+
+///
+/// @brief Immediates as they show up in code sections: mostly one byte local indices, branch depths and small constants,
+/// some two byte offsets and counts, a few full width constants
+std::vector<uint8_t> makeCodeSectionImmediates(size_t const count) {
+  std::mt19937 rng(42U);
+  std::uniform_int_distribution<uint32_t> kind(0U, 99U);
+  std::vector<uint8_t> out;
+  for (size_t i = 0U; i < count; ++i) {
+    uint32_t const k = kind(rng);
+    uint32_t value;
+    if (k < 75U) {
+      value = rng() & 0x7FU;
+    } else if (k < 93U) {
+      value = rng() & 0x3FFFU;
+    } else if (k < 98U) {
+      value = rng() & 0x1FFFFFU;
+    } else {
+      value = rng();
+    }
+    encodeULEB128(value, out);
+  }
+  return out;
+}
+
+void benchLEB128() {
+  constexpr size_t numValues = 1U << 16U;
+  std::vector<uint8_t> const stream = makeCodeSectionImmediates(numValues);
+  ByteSpan const bytes{stream};
+  runBenchmark("leb128/legacy_loop", numValues, [&bytes]() {
+    uint64_t sum = 0U;
+    for (size_t index = 0U; index < bytes.size();) {
+      sum += legacyReadULEB128(bytes, index);
+    }
+    return sum;
+  });
+  runBenchmark("leb128/fast_path", numValues, [&bytes]() {
+    uint64_t sum = 0U;
+    for (size_t index = 0U; index < bytes.size();) {
+      sum += readULEB128(bytes, index);
+    }
+    return sum;
+  });
+}
+
+// operand stack used by the parser before the pooled Stack, kept as the baseline
+class LegacyStack {
+private:
+  std::vector<StackElement> elements;
+
+public:
+  void push(const StackElement &value) {
+    elements.push_back(value);
+  }
+
+  void pop() {
+    elements.pop_back();
+  }
+
+  StackElement top() const {
+    return elements.back();
+  }
+
+  std::size_t size() const {
+    return elements.size();
+  }
+};
+
+///
+/// @brief Operand stack traffic of expression heavy function bodies: 0 pushes a local or constant, 1 is a binary operator,
+/// 2 consumes the top (local.set), each function ends with an empty stack
+std::vector<std::vector<uint8_t>> makeOperandTraces(size_t const numFunctions) {
+  std::mt19937 rng(7U);
+  std::vector<std::vector<uint8_t>> traces(numFunctions);
+  for (std::vector<uint8_t> &trace : traces) {
+    size_t depth = 0U;
+    size_t const length = 32U + (rng() % 96U);
+    for (size_t i = 0U; i < length; ++i) {
+      uint32_t const k = rng() % 10U;
+      if ((depth < 2U) || ((k < 5U) && (depth < 12U))) {
+        trace.push_back(0U);
+        depth++;
+      } else if (k < 8U) {
+        trace.push_back(1U);
+        depth--;
+      } else {
+        trace.push_back(2U);
+        depth--;
+      }
+    }
+    for (; depth > 0U; --depth) {
+      trace.push_back(2U);
+    }
+  }
+  return traces;
+}
+
+void benchOperandStack() {
+  constexpr size_t numFunctions = 256U;
+  std::vector<std::vector<uint8_t>> const traces = makeOperandTraces(numFunctions);
+  runBenchmark("stack/legacy_vector (per function)", numFunctions, [&traces]() {
+    uint64_t sum = 0U;
+    for (const std::vector<uint8_t> &trace : traces) {
+      LegacyStack stack;
+      for (uint8_t const op : trace) {
+        if (op == 0U) {
+          stack.push(StackElement::i32Const(static_cast<uint32_t>(stack.size())));
+        } else if (op == 1U) {
+          StackElement right = stack.top();
+          stack.pop();
+          StackElement left = stack.top();
+          stack.pop();
+          stack.push(StackElement::i32Const(left.data.constUnion.u32 + right.data.constUnion.u32));
+        } else {
+          sum += stack.top().data.constUnion.u32;
+          stack.pop();
+        }
+      }
+    }
+    return sum;
+  });
+
+  std::vector<StackElement> storage;
+  runBenchmark("stack/pooled (per function)", numFunctions, [&traces, &storage]() {
+    uint64_t sum = 0U;
+    for (const std::vector<uint8_t> &trace : traces) {
+      Stack stack(storage);
+      stack.reserve(12U);
+      for (uint8_t const op : trace) {
+        if (op == 0U) {
+          stack.push(StackElement::i32Const(static_cast<uint32_t>(stack.size())));
+        } else if (op == 1U) {
+          uint32_t const result = stack.peek(1U).data.constUnion.u32 + stack.peek(0U).data.constUnion.u32;
+          stack.pop();
+          stack.top().data.constUnion.u32 = result;
+        } else {
+          sum += stack.top().data.constUnion.u32;
+          stack.pop();
+        }
+      }
+    }
+    return sum;
+  });
+}
+
+// spec modules of the test suite, relative to the build directory like the spec tests
+char const *const codeSizeModules[] = {"../if.0.wasm",        "../block.0.wasm",           "../spill.0.wasm",
+                                       "../deferred.0.wasm",  "../immediate.0.wasm",       "../fold.0.wasm",
+                                       "../divconst.0.wasm",  "../branch.0.wasm",          "../br.0.wasm",
+                                       "../call.0.wasm",      "../memory.0.wasm",          "../../Chapter04/div.0.wasm",
+                                       "../../Chapter03/arithmetic.0.wasm"};
+
+std::vector<MachineCode> compileModule(const char *const filePath, bool const immediateSelection, bool const constantDivision) {
+  ModuleInfo moduleInfo = processWasmFile(filePath);
+  moduleInfo.immediateSelection = immediateSelection;
+  moduleInfo.constantDivision = constantDivision;
+  compileOpCode(moduleInfo);
+  return moduleInfo.machineCodes;
+}
+
+///
+/// @brief Not timed: instructions per function without and with immediate selection (constants folded into ADD/SUB/logical
+/// immediates, shortest MOVZ/MOVN/MOVK sequences) and division by constants
+void reportCodeSize() {
+  size_t totalBefore = 0U;
+  size_t totalAfter = 0U;
+  for (char const *const filePath : codeSizeModules) {
+    std::vector<MachineCode> const before = compileModule(filePath, false, false);
+    std::vector<MachineCode> const after = compileModule(filePath, true, true);
+    std::map<size_t, std::string> exportNames;
+    for (const auto &entry : processWasmFile(filePath).functionsNameIndex) {
+      exportNames.emplace(entry.second, entry.first);
+    }
+    for (size_t i = 0U; i < after.size(); ++i) {
+      auto const found = exportNames.find(i);
+      std::string const name = std::string(filePath) + " " + ((found != exportNames.end()) ? found->second : std::to_string(i));
+      std::cout << std::left << std::setw(60) << name << std::right << std::setw(6) << before[i].size() << " -> " << std::setw(6)
+                << after[i].size() << " instructions" << std::endl;
+      totalBefore += before[i].size();
+      totalAfter += after[i].size();
+    }
+  }
+  std::cout << std::left << std::setw(60) << "codesize/total" << std::right << std::setw(6) << totalBefore << " -> " << std::setw(6)
+            << totalAfter << " instructions" << std::endl;
+}
+
+///
+/// @brief Calls of the divconst.0.wasm bench functions (sums of div/rem by constants like in div.json) compiled to UDIV/SDIV
+/// with trap checks and to multiply-high and shifts. Runs the generated code, so only on an AArch64 host.
+void benchConstantDivision() {
+  constexpr size_t numCalls = 1024U;
+  std::mt19937_64 rng(11U);
+  std::vector<uint64_t> args(numCalls);
+  for (uint64_t &arg : args) {
+    arg = rng() >> (rng() % 64U);
+  }
+  for (bool const constantDivision : {false, true}) {
+    ModuleInfo moduleInfo = processWasmFile("../divconst.0.wasm");
+    moduleInfo.constantDivision = constantDivision;
+    compileOpCode(moduleInfo);
+    Runtime const runtime(moduleInfo);
+    for (char const *const function : {"bench-i32", "bench-i64"}) {
+      size_t const funcIndex = runtime.exportedFunction(function);
+      std::string const name = std::string("divconst/") + function + (constantDivision ? "/multiply_shift" : "/udiv_sdiv") + " (per call)";
+      runBenchmark(name, numCalls, [&runtime, &args, funcIndex]() {
+        uint64_t sum = 0U;
+        for (uint64_t const arg : args) {
+          sum += runtime.invoke(funcIndex, arg);
+        }
+        return sum;
+      });
+    }
+  }
+}
+
+///
+/// @brief The kernels of simd.0.wasm (an i32 dot product, a copy loop and a byte count) over the same 16 KiB of the linear
+/// memory, once with scalar loads and once with v128 NEON code. Runs the generated code, so only on an AArch64 host.
+void benchSimdKernels() {
+  constexpr uint32_t numBytes = 16384U;
+  ModuleInfo moduleInfo = processWasmFile("../simd.0.wasm");
+  compileOpCode(moduleInfo);
+  Runtime const runtime(moduleInfo);
+  static_cast<void>(runtime.invoke(runtime.exportedFunction("bench-fill")));
+  struct Kernel {
+    char const *name;
+    uint32_t count; ///< first argument: i32 elements for dot, bytes otherwise
+    uint32_t pattern;
+  };
+  for (const Kernel &kernel : {Kernel{"dot", numBytes / 4U, 0U}, Kernel{"copy", numBytes, 0U}, Kernel{"count", numBytes, 0x3CU}}) {
+    for (char const *const variant : {"scalar", "simd"}) {
+      std::string const function = std::string("bench-") + kernel.name + "-" + variant;
+      size_t const funcIndex = runtime.exportedFunction(function);
+      bool const hasPattern = std::strcmp(kernel.name, "count") == 0;
+      runBenchmark("simd/" + std::string(kernel.name) + "/" + variant + " (per byte)", numBytes, [&runtime, &kernel, funcIndex, hasPattern]() {
+        return hasPattern ? runtime.invoke(funcIndex, kernel.count, kernel.pattern) : runtime.invoke(funcIndex, kernel.count);
+      });
+    }
+  }
+}
+
+struct Benchmark {
+  char const *name;
+  void (*run)();
+};
+
+Benchmark const benchmarks[] = {
+    {"leb128", &benchLEB128},
+    {"stack", &benchOperandStack},
+    {"codesize", &reportCodeSize},
+    {"divconst", &benchConstantDivision},
+    {"simd", &benchSimdKernels},
+};
+} // namespace
+
+///
+/// usage: MyBench [name...]  runs the named benchmarks, all of them without arguments
+int main(int argc, char **argv) {
+  for (const Benchmark &benchmark : benchmarks) {
+    bool selected = (argc <= 1);
+    for (int i = 1; i < argc; ++i) {
+      selected = selected || (std::strcmp(argv[i], benchmark.name) == 0);
+    }
+    if (selected) {
+      benchmark.run();
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,62 @@
+(module
+  (type (;0;) (func (param i32 i32) (result i32)))
+  (type (;1;) (func (param i32) (result i32)))
+  (func (;0;) (type 0) (param i32 i32) (result i32)
+    local.get 0
+    if (result i32)  ;; label = @1
+      local.get 1
+      if (result i32)  ;; label = @2
+        i32.const 1
+      else
+        i32.const 2
+      end
+    else
+      local.get 1
+      if (result i32)  ;; label = @2
+        i32.const 3
+      else
+        i32.const 4
+      end
+    end)
+  (func (;1;) (type 1) (param i32) (result i32)
+    block (result i32)  ;; label = @1
+      loop (result i32)  ;; label = @2
+        local.get 0
+        if (result i32)  ;; label = @3
+          i32.const 5
+        else
+          block (result i32)  ;; label = @4
+            i32.const 6
+          end
+        end
+      end
+    end)
+  (func (;2;) (type 1) (param i32) (result i32)
+    local.get 0
+    if  ;; label = @1
+      i32.const 9
+      return
+    end
+    i32.const 10)
+  (func (;3;) (type 1) (param i32) (result i32)
+    (local i32)
+    block (result i32)  ;; label = @1
+      i32.const 3
+    end
+    block (result i32)  ;; label = @1
+      local.get 0
+    end
+    local.set 1)
+  (func (;4;) (type 1) (param i32) (result i32)
+    i32.const 1
+    local.set 0
+    local.get 0
+    if  ;; label = @1
+      nop
+    end
+    local.get 0)
+  (export "nested-if" (func 0))
+  (export "block-in-loop" (func 1))
+  (export "if-return" (func 2))
+  (export "sibling-results" (func 3))
+  (export "if-without-else" (func 4)))
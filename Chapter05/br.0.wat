@@ -0,0 +1,228 @@
+(module
+  (type (;0;) (func (param i32) (result i32)))
+  (type (;1;) (func (param i32) (result i64)))
+  (type (;2;) (func (param i32 i32) (result i32)))
+  (type (;3;) (func (result i32)))
+  (func (;0;) (type 0) (param i32) (result i32)
+    (local i32 i32 i32)
+    i32.const 0
+    local.set 1
+    i32.const 1
+    local.set 2
+    block  ;; label = @1
+      loop  ;; label = @2
+        local.get 0
+        i32.eqz
+        br_if 1
+        local.get 1
+        local.get 2
+        i32.add
+        local.set 3
+        local.get 2
+        local.set 1
+        local.get 3
+        local.set 2
+        local.get 0
+        i32.const 1
+        i32.sub
+        local.set 0
+        br 0
+      end
+    end
+    local.get 1)
+  (func (;1;) (type 1) (param i32) (result i64)
+    (local i64 i64 i64)
+    i64.const 0
+    local.set 1
+    i64.const 1
+    local.set 2
+    block  ;; label = @1
+      loop  ;; label = @2
+        local.get 0
+        i32.const 0
+        i32.le_s
+        br_if 1
+        local.get 1
+        local.get 2
+        i64.add
+        local.set 3
+        local.get 2
+        local.set 1
+        local.get 3
+        local.set 2
+        local.get 0
+        i32.const 1
+        i32.sub
+        local.set 0
+        br 0
+      end
+    end
+    local.get 1)
+  (func (;2;) (type 0) (param i32) (result i32)
+    (local i32)
+    loop  ;; label = @1
+      local.get 1
+      local.get 0
+      i32.add
+      local.set 1
+      local.get 0
+      i32.const 1
+      i32.sub
+      local.tee 0
+      br_if 0
+    end
+    local.get 1)
+  (func (;3;) (type 0) (param i32) (result i32)
+    block (result i32)  ;; label = @1
+      block (result i32)  ;; label = @2
+        i32.const 10
+        local.get 0
+        i32.eqz
+        br_if 0
+        drop
+        i32.const 20
+        br 1
+      end
+      i32.const 1
+      i32.add
+    end)
+  (func (;4;) (type 2) (param i32 i32) (result i32)
+    block (result i32)  ;; label = @1
+      local.get 1
+      local.get 0
+      br_if 0
+      i32.const 3
+      i32.mul
+    end)
+  (func (;5;) (type 0) (param i32) (result i32)
+    block (result i32)  ;; label = @1
+      i32.const 7
+      block  ;; label = @2
+        block  ;; label = @3
+          local.get 0
+          br_if 2
+        end
+      end
+      drop
+      i32.const 8
+    end)
+  (func (;6;) (type 0) (param i32) (result i32)
+    block  ;; label = @1
+      block  ;; label = @2
+        block  ;; label = @3
+          block  ;; label = @4
+            local.get 0
+            br_table 3
+            2 1
+            0 3
+          end
+          i32.const 100
+          return
+        end
+        i32.const 101
+        return
+      end
+      i32.const 102
+      return
+    end
+    i32.const 103)
+  (func (;7;) (type 0) (param i32) (result i32)
+    block (result i32)  ;; label = @1
+      block (result i32)  ;; label = @2
+        i32.const 5
+        local.get 0
+        br_table 2
+        0 1
+        1
+      end
+      i32.const 10
+      i32.add
+    end
+    i32.const 1
+    i32.add)
+  (func (;8;) (type 0) (param i32) (result i32)
+    block (result i32)  ;; label = @1
+      local.get 0
+      local.get 0
+      br_table 1
+      0 1
+    end
+    i32.const 100
+    i32.add)
+  (func (;9;) (type 3) (result i32)
+    block  ;; label = @1
+      block  ;; label = @2
+        i32.const 0
+        br_table 1
+        0 1
+      end
+      i32.const 1
+      return
+    end
+    i32.const 2)
+  (func (;10;) (type 0) (param i32) (result i32)
+    (local i32)
+    block  ;; label = @1
+      loop  ;; label = @2
+        local.get 1
+        i32.const 1
+        i32.add
+        local.set 1
+        local.get 0
+        i32.const 1
+        i32.sub
+        local.tee 0
+        br_table 1
+        1 0
+      end
+    end
+    local.get 1)
+  (func (;11;) (type 0) (param i32) (result i32)
+    i32.const 4
+    local.get 0
+    br_if 0
+    drop
+    i32.const 5)
+  (func (;12;) (type 2) (param i32 i32) (result i32)
+    (local i32)
+    block  ;; label = @1
+      loop  ;; label = @2
+        local.get 2
+        local.get 1
+        i32.add
+        local.set 2
+        local.get 0
+        i32.const 1
+        i32.add
+        local.tee 0
+        local.get 1
+        i32.ge_s
+        br_if 1
+        br 0
+      end
+    end
+    local.get 2)
+  (func (;13;) (type 0) (param i32) (result i32)
+    block (result i32)  ;; label = @1
+      local.get 0
+      if  ;; label = @2
+        i32.const 9
+        br 1
+      else
+      end
+      i32.const 11
+    end)
+  (export "fib" (func 0))
+  (export "fib-i64" (func 1))
+  (export "sum" (func 2))
+  (export "br-value" (func 3))
+  (export "br-if-value" (func 4))
+  (export "br-nested" (func 5))
+  (export "table" (func 6))
+  (export "table-value" (func 7))
+  (export "table-return" (func 8))
+  (export "table-const" (func 9))
+  (export "table-loop" (func 10))
+  (export "br-return" (func 11))
+  (export "br-if-fused" (func 12))
+  (export "br-out-of-if" (func 13)))
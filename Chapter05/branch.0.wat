@@ -0,0 +1,195 @@
+(module
+  (type (;0;) (func (param i32) (result i32)))
+  (type (;1;) (func (param i64) (result i32)))
+  (type (;2;) (func (param i32 i32) (result i32)))
+  (type (;3;) (func (param i32 i32 i32) (result i32)))
+  (type (;4;) (func (param i64 i64) (result i32)))
+  (func (;0;) (type 0) (param i32) (result i32)
+    local.get 0
+    i32.eqz
+    if (result i32)  ;; label = @1
+      i32.const 1
+    else
+      i32.const 2
+    end)
+  (func (;1;) (type 0) (param i32) (result i32)
+    local.get 0
+    i32.const 0
+    i32.lt_s
+    if (result i32)  ;; label = @1
+      i32.const 1
+    else
+      i32.const 2
+    end)
+  (func (;2;) (type 1) (param i64) (result i32)
+    local.get 0
+    i64.const 0
+    i64.ge_s
+    if (result i32)  ;; label = @1
+      i32.const 1
+    else
+      i32.const 2
+    end)
+  (func (;3;) (type 0) (param i32) (result i32)
+    local.get 0
+    i32.const 0
+    i32.gt_u
+    if (result i32)  ;; label = @1
+      i32.const 1
+    else
+      i32.const 2
+    end)
+  (func (;4;) (type 0) (param i32) (result i32)
+    local.get 0
+    i32.const 0
+    i32.le_u
+    if (result i32)  ;; label = @1
+      i32.const 1
+    else
+      i32.const 2
+    end)
+  (func (;5;) (type 0) (param i32) (result i32)
+    local.get 0
+    i32.const -42
+    i32.eq
+    if (result i32)  ;; label = @1
+      i32.const 1
+    else
+      i32.const 2
+    end)
+  (func (;6;) (type 0) (param i32) (result i32)
+    local.get 0
+    i32.const 305419896
+    i32.ne
+    if (result i32)  ;; label = @1
+      i32.const 1
+    else
+      i32.const 2
+    end)
+  (func (;7;) (type 2) (param i32 i32) (result i32)
+    local.get 0
+    local.get 1
+    i32.lt_u
+    if (result i32)  ;; label = @1
+      i32.const 1
+    else
+      i32.const 2
+    end)
+  (func (;8;) (type 3) (param i32 i32 i32) (result i32)
+    local.get 0
+    local.get 1
+    i32.add
+    local.get 2
+    local.get 1
+    i32.mul
+    i32.lt_s
+    if (result i32)  ;; label = @1
+      i32.const 1
+    else
+      i32.const 2
+    end)
+  (func (;9;) (type 4) (param i64 i64) (result i32)
+    local.get 0
+    local.get 1
+    i64.gt_s
+    if (result i32)  ;; label = @1
+      i32.const 1
+    else
+      i32.const 2
+    end)
+  (func (;10;) (type 0) (param i32) (result i32)
+    i32.const 10
+    local.get 0
+    i32.le_s
+    if (result i32)  ;; label = @1
+      i32.const 1
+    else
+      i32.const 2
+    end)
+  (func (;11;) (type 0) (param i32) (result i32)
+    local.get 0
+    i32.const 8
+    i32.and
+    if (result i32)  ;; label = @1
+      i32.const 1
+    else
+      i32.const 2
+    end)
+  (func (;12;) (type 1) (param i64) (result i32)
+    local.get 0
+    i64.const 4611686018427387904
+    i64.and
+    i64.eqz
+    if (result i32)  ;; label = @1
+      i32.const 1
+    else
+      i32.const 2
+    end)
+  (func (;13;) (type 0) (param i32) (result i32)
+    local.get 0
+    if (result i32)  ;; label = @1
+      i32.const 1
+    else
+      i32.const 2
+    end)
+  (func (;14;) (type 0) (param i32) (result i32)
+    local.get 0
+    i32.eqz
+    i32.eqz
+    if (result i32)  ;; label = @1
+      i32.const 1
+    else
+      i32.const 2
+    end)
+  (func (;15;) (type 2) (param i32 i32) (result i32)
+    local.get 0
+    i32.const 100
+    i32.gt_s
+    if (result i32)  ;; label = @1
+      local.get 1
+      i32.const 0
+      i32.ne
+      if (result i32)  ;; label = @2
+        i32.const 3
+      else
+        i32.const 4
+      end
+    else
+      local.get 1
+      local.get 0
+      i32.ge_u
+      if (result i32)  ;; label = @2
+        i32.const 5
+      else
+        i32.const 6
+      end
+    end)
+  (func (;16;) (type 0) (param i32) (result i32)
+    (local i32)
+    i32.const 7
+    local.set 1
+    local.get 0
+    i32.const 1
+    i32.and
+    if  ;; label = @1
+      local.get 0
+      local.set 1
+    end
+    local.get 1)
+  (export "eqz" (func 0))
+  (export "lt-zero" (func 1))
+  (export "ge-zero-i64" (func 2))
+  (export "gt-u-zero" (func 3))
+  (export "le-u-zero" (func 4))
+  (export "eq-imm" (func 5))
+  (export "ne-large" (func 6))
+  (export "lt-u-locals" (func 7))
+  (export "lt-s-scratch" (func 8))
+  (export "gt-s-i64" (func 9))
+  (export "const-left" (func 10))
+  (export "bit-test" (func 11))
+  (export "bit-test-i64" (func 12))
+  (export "value" (func 13))
+  (export "eqz-eqz" (func 14))
+  (export "nested" (func 15))
+  (export "no-else" (func 16)))
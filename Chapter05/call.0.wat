@@ -0,0 +1,158 @@
+(module
+  (type (;0;) (func (param i32) (result i32)))
+  (type (;1;) (func (param i64) (result i64)))
+  (type (;2;) (func (param i32 i32 i32) (result i32)))
+  (type (;3;) (func (param i32 i32) (result i32)))
+  (type (;4;) (func (param i32)))
+  (type (;5;) (func (param i64 i64) (result i64)))
+  (func (;0;) (type 0) (param i32) (result i32)
+    local.get 0
+    i32.const 2
+    i32.lt_u
+    if (result i32)  ;; label = @1
+      local.get 0
+    else
+      local.get 0
+      i32.const 1
+      i32.sub
+      call 0
+      local.get 0
+      i32.const 2
+      i32.sub
+      call 0
+      i32.add
+    end)
+  (func (;1;) (type 1) (param i64) (result i64)
+    local.get 0
+    i64.eqz
+    if (result i64)  ;; label = @1
+      i64.const 1
+    else
+      local.get 0
+      local.get 0
+      i64.const 1
+      i64.sub
+      call 1
+      i64.mul
+    end)
+  (func (;2;) (type 2) (param i32 i32 i32) (result i32)
+    local.get 0
+    local.get 1
+    i32.const 3
+    i32.mul
+    i32.sub
+    local.get 2
+    i32.add)
+  (func (;3;) (type 2) (param i32 i32 i32) (result i32)
+    local.get 2
+    local.get 0
+    local.get 1
+    call 2)
+  (func (;4;) (type 3) (param i32 i32) (result i32)
+    (local i32)
+    local.get 0
+    local.get 1
+    i32.mul
+    local.set 2
+    local.get 0
+    i32.const 7
+    i32.add
+    local.get 1
+    i32.const 1
+    i32.add
+    i32.const 5
+    local.get 0
+    call 2
+    i32.xor
+    local.get 2
+    i32.add
+    local.get 0
+    i32.add
+    local.get 1
+    i32.sub)
+  (func (;5;) (type 0) (param i32) (result i32)
+    local.get 0
+    call 0
+    local.get 0
+    i32.const 1
+    i32.add
+    call 0
+    local.get 0
+    call 0
+    call 2)
+  (func (;6;) (type 0) (param i32) (result i32)
+    local.get 0
+    i32.eqz
+    if (result i32)  ;; label = @1
+      i32.const 1
+    else
+      local.get 0
+      i32.const 1
+      i32.sub
+      call 7
+    end)
+  (func (;7;) (type 0) (param i32) (result i32)
+    local.get 0
+    i32.eqz
+    if (result i32)  ;; label = @1
+      i32.const 0
+    else
+      local.get 0
+      i32.const 1
+      i32.sub
+      call 6
+    end)
+  (func (;8;) (type 0) (param i32) (result i32)
+    (local i32)
+    block  ;; label = @1
+      loop  ;; label = @2
+        local.get 0
+        i32.eqz
+        br_if 1
+        local.get 1
+        local.get 0
+        call 0
+        i32.add
+        local.set 1
+        local.get 0
+        i32.const 1
+        i32.sub
+        local.set 0
+        br 0
+      end
+    end
+    local.get 1)
+  (func (;9;) (type 4) (param i32)
+    local.get 0
+    drop)
+  (func (;10;) (type 0) (param i32) (result i32)
+    local.get 0
+    call 9
+    local.get 0
+    i32.const 1
+    i32.add)
+  (func (;11;) (type 5) (param i64 i64) (result i64)
+    local.get 0
+    local.get 1
+    i64.add)
+  (func (;12;) (type 1) (param i64) (result i64)
+    local.get 0
+    local.get 0
+    call 11
+    local.get 0
+    i64.const 1
+    call 11
+    i64.mul)
+  (export "fib" (func 0))
+  (export "fac" (func 1))
+  (export "mix" (func 2))
+  (export "rotate" (func 3))
+  (export "live" (func 4))
+  (export "nested" (func 5))
+  (export "even" (func 6))
+  (export "odd" (func 7))
+  (export "sum-fib" (func 8))
+  (export "nothing" (func 9))
+  (export "call-void" (func 10))
+  (export "add64" (func 11))
+  (export "twice" (func 12)))
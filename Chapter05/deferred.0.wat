@@ -0,0 +1,69 @@
+(module
+  (type (;0;) (func (param i32 i32) (result i32)))
+  (type (;1;) (func (param i32) (result i32)))
+  (type (;2;) (func (param i64 i64) (result i64)))
+  (func (;0;) (type 0) (param i32 i32) (result i32)
+    (local i32)
+    local.get 0
+    local.get 1
+    i32.add
+    local.set 2
+    local.get 0
+    local.get 2
+    i32.add)
+  (func (;1;) (type 0) (param i32 i32) (result i32)
+    local.get 0
+    local.get 1
+    i32.sub
+    i32.const 5
+    local.set 0
+    local.get 0
+    i32.mul)
+  (func (;2;) (type 1) (param i32) (result i32)
+    local.get 0
+    i32.const 9
+    local.set 0
+    local.get 0
+    i32.add)
+  (func (;3;) (type 0) (param i32 i32) (result i32)
+    local.get 0
+    local.get 1
+    i32.add
+    local.tee 0
+    local.get 0
+    i32.mul)
+  (func (;4;) (type 0) (param i32 i32) (result i32)
+    local.get 0
+    local.get 1
+    i32.sub
+    if (result i32)  ;; label = @1
+      i32.const 1
+    else
+      i32.const 2
+    end)
+  (func (;5;) (type 1) (param i32) (result i32)
+    local.get 0
+    local.get 0
+    i32.add
+    block  ;; label = @1
+      i32.const 3
+      local.set 0
+    end
+    local.get 0
+    i32.add)
+  (func (;6;) (type 2) (param i64 i64) (result i64)
+    (local i64)
+    local.get 0
+    local.get 1
+    i64.mul
+    local.set 2
+    local.get 2
+    local.get 0
+    i64.sub)
+  (export "add-into-local" (func 0))
+  (export "set-operand-local" (func 1))
+  (export "alias-before-set" (func 2))
+  (export "tee-deferred" (func 3))
+  (export "deferred-condition" (func 4))
+  (export "deferred-across-block" (func 5))
+  (export "i64-mul-into-local" (func 6)))
@@ -0,0 +1,186 @@
+(module
+  (type (;0;) (func (param i32) (result i32)))
+  (type (;1;) (func (param i64) (result i64)))
+  (func (;0;) (type 0) (param i32) (result i32)
+    local.get 0
+    i32.const 3
+    i32.div_u)
+  (func (;1;) (type 0) (param i32) (result i32)
+    local.get 0
+    i32.const 7
+    i32.div_u)
+  (func (;2;) (type 0) (param i32) (result i32)
+    local.get 0
+    i32.const 641
+    i32.div_u)
+  (func (;3;) (type 0) (param i32) (result i32)
+    local.get 0
+    i32.const -2147483647
+    i32.div_u)
+  (func (;4;) (type 0) (param i32) (result i32)
+    local.get 0
+    i32.const 16
+    i32.div_u)
+  (func (;5;) (type 0) (param i32) (result i32)
+    local.get 0
+    i32.const 10
+    i32.rem_u)
+  (func (;6;) (type 0) (param i32) (result i32)
+    local.get 0
+    i32.const 64
+    i32.rem_u)
+  (func (;7;) (type 0) (param i32) (result i32)
+    local.get 0
+    i32.const 3
+    i32.div_s)
+  (func (;8;) (type 0) (param i32) (result i32)
+    local.get 0
+    i32.const 7
+    i32.div_s)
+  (func (;9;) (type 0) (param i32) (result i32)
+    local.get 0
+    i32.const -3
+    i32.div_s)
+  (func (;10;) (type 0) (param i32) (result i32)
+    local.get 0
+    i32.const 8
+    i32.div_s)
+  (func (;11;) (type 0) (param i32) (result i32)
+    local.get 0
+    i32.const -16
+    i32.div_s)
+  (func (;12;) (type 0) (param i32) (result i32)
+    local.get 0
+    i32.const -2147483648
+    i32.div_s)
+  (func (;13;) (type 0) (param i32) (result i32)
+    local.get 0
+    i32.const -1
+    i32.div_s)
+  (func (;14;) (type 0) (param i32) (result i32)
+    local.get 0
+    i32.const 7
+    i32.rem_s)
+  (func (;15;) (type 0) (param i32) (result i32)
+    local.get 0
+    i32.const 8
+    i32.rem_s)
+  (func (;16;) (type 0) (param i32) (result i32)
+    local.get 0
+    i32.const -2147483648
+    i32.rem_s)
+  (func (;17;) (type 1) (param i64) (result i64)
+    local.get 0
+    i64.const 10
+    i64.div_u)
+  (func (;18;) (type 1) (param i64) (result i64)
+    local.get 0
+    i64.const 7
+    i64.div_u)
+  (func (;19;) (type 1) (param i64) (result i64)
+    local.get 0
+    i64.const -1
+    i64.rem_u)
+  (func (;20;) (type 1) (param i64) (result i64)
+    local.get 0
+    i64.const -7
+    i64.div_s)
+  (func (;21;) (type 1) (param i64) (result i64)
+    local.get 0
+    i64.const 1024
+    i64.div_s)
+  (func (;22;) (type 1) (param i64) (result i64)
+    local.get 0
+    i64.const 1000
+    i64.rem_s)
+  (func (;23;) (type 1) (param i64) (result i64)
+    local.get 0
+    i64.const -1
+    i64.div_s)
+  (func (;24;) (type 0) (param i32) (result i32)
+    i32.const 100
+    local.get 0
+    i32.div_s)
+  (func (;25;) (type 0) (param i32) (result i32)
+    local.get 0
+    i32.const 3
+    i32.div_u
+    local.get 0
+    i32.const 7
+    i32.div_u
+    i32.add
+    local.get 0
+    i32.const 10
+    i32.rem_u
+    i32.add
+    local.get 0
+    i32.const 641
+    i32.div_u
+    i32.add
+    local.get 0
+    i32.const -5
+    i32.div_s
+    i32.add
+    local.get 0
+    i32.const 13
+    i32.rem_s
+    i32.add
+    local.get 0
+    i32.const 1000
+    i32.div_s
+    i32.add
+    local.get 0
+    i32.const 60
+    i32.rem_u
+    i32.add)
+  (func (;26;) (type 1) (param i64) (result i64)
+    local.get 0
+    i64.const 10
+    i64.div_u
+    local.get 0
+    i64.const 7
+    i64.rem_u
+    i64.add
+    local.get 0
+    i64.const 3
+    i64.div_s
+    i64.add
+    local.get 0
+    i64.const -1000
+    i64.rem_s
+    i64.add
+    local.get 0
+    i64.const 1000000007
+    i64.div_u
+    i64.add
+    local.get 0
+    i64.const 12
+    i64.div_s
+    i64.add)
+  (export "i32-div-u-3" (func 0))
+  (export "i32-div-u-7" (func 1))
+  (export "i32-div-u-641" (func 2))
+  (export "i32-div-u-minus2147483647" (func 3))
+  (export "i32-div-u-16" (func 4))
+  (export "i32-rem-u-10" (func 5))
+  (export "i32-rem-u-64" (func 6))
+  (export "i32-div-s-3" (func 7))
+  (export "i32-div-s-7" (func 8))
+  (export "i32-div-s-minus3" (func 9))
+  (export "i32-div-s-8" (func 10))
+  (export "i32-div-s-minus16" (func 11))
+  (export "i32-div-s-minus2147483648" (func 12))
+  (export "i32-div-s-minus1" (func 13))
+  (export "i32-rem-s-7" (func 14))
+  (export "i32-rem-s-8" (func 15))
+  (export "i32-rem-s-minus2147483648" (func 16))
+  (export "i64-div-u-10" (func 17))
+  (export "i64-div-u-7" (func 18))
+  (export "i64-rem-u-minus1" (func 19))
+  (export "i64-div-s-minus7" (func 20))
+  (export "i64-div-s-1024" (func 21))
+  (export "i64-rem-s-1000" (func 22))
+  (export "i64-div-s-minus1" (func 23))
+  (export "const-dividend" (func 24))
+  (export "bench-i32" (func 25))
+  (export "bench-i64" (func 26)))
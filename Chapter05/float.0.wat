@@ -0,0 +1,972 @@
+(module
+  (type (;0;) (func (param f32 f32) (result f32)))
+  (type (;1;) (func (param f32) (result f32)))
+  (type (;2;) (func (param f32 f32) (result i32)))
+  (type (;3;) (func (param f32) (result i32)))
+  (type (;4;) (func (param f64 f64) (result f64)))
+  (type (;5;) (func (param f64) (result f64)))
+  (type (;6;) (func (param f64 f64) (result i32)))
+  (type (;7;) (func (param f64) (result i32)))
+  (type (;8;) (func (param f32) (result i64)))
+  (type (;9;) (func (param f64) (result i64)))
+  (type (;10;) (func (param i32) (result f32)))
+  (type (;11;) (func (param i64) (result f32)))
+  (type (;12;) (func (param i32) (result f64)))
+  (type (;13;) (func (param i64) (result f64)))
+  (type (;14;) (func (param f64) (result f32)))
+  (type (;15;) (func (param f32) (result f64)))
+  (type (;16;) (func (param i64) (result i32)))
+  (type (;17;) (func (param i32) (result i64)))
+  (type (;18;) (func (result f64)))
+  (type (;19;) (func (result f32)))
+  (type (;20;) (func (param i32 f64 i64 f32 f64) (result f64)))
+  (type (;21;) (func (param f64 f32) (result f64)))
+  (type (;22;) (func (param f32 i32) (result f32)))
+  (type (;23;) (func (param i32 f32) (result f32)))
+  (type (;24;) (func (param i32 f64) (result i64)))
+  (func (;0;) (type 0) (param f32 f32) (result f32)
+    local.get 0
+    local.get 1
+    f32.add)
+  (func (;1;) (type 0) (param f32 f32) (result f32)
+    local.get 0
+    local.get 1
+    f32.sub)
+  (func (;2;) (type 0) (param f32 f32) (result f32)
+    local.get 0
+    local.get 1
+    f32.mul)
+  (func (;3;) (type 0) (param f32 f32) (result f32)
+    local.get 0
+    local.get 1
+    f32.div)
+  (func (;4;) (type 0) (param f32 f32) (result f32)
+    local.get 0
+    local.get 1
+    f32.min)
+  (func (;5;) (type 0) (param f32 f32) (result f32)
+    local.get 0
+    local.get 1
+    f32.max)
+  (func (;6;) (type 0) (param f32 f32) (result f32)
+    local.get 0
+    local.get 1
+    f32.copysign)
+  (func (;7;) (type 1) (param f32) (result f32)
+    local.get 0
+    f32.abs)
+  (func (;8;) (type 1) (param f32) (result f32)
+    local.get 0
+    f32.neg)
+  (func (;9;) (type 1) (param f32) (result f32)
+    local.get 0
+    f32.sqrt)
+  (func (;10;) (type 1) (param f32) (result f32)
+    local.get 0
+    f32.ceil)
+  (func (;11;) (type 1) (param f32) (result f32)
+    local.get 0
+    f32.floor)
+  (func (;12;) (type 1) (param f32) (result f32)
+    local.get 0
+    f32.trunc)
+  (func (;13;) (type 1) (param f32) (result f32)
+    local.get 0
+    f32.nearest)
+  (func (;14;) (type 2) (param f32 f32) (result i32)
+    local.get 0
+    local.get 1
+    f32.eq)
+  (func (;15;) (type 2) (param f32 f32) (result i32)
+    local.get 0
+    local.get 1
+    f32.eq
+    if (result i32)  ;; label = @1
+      i32.const 10
+    else
+      i32.const 20
+    end)
+  (func (;16;) (type 3) (param f32) (result i32)
+    local.get 0
+    f32.const -0x0p+0 (;=-0.0;)
+    f32.eq
+    if (result i32)  ;; label = @1
+      i32.const 10
+    else
+      i32.const 20
+    end)
+  (func (;17;) (type 2) (param f32 f32) (result i32)
+    local.get 0
+    local.get 1
+    f32.ne)
+  (func (;18;) (type 2) (param f32 f32) (result i32)
+    local.get 0
+    local.get 1
+    f32.ne
+    if (result i32)  ;; label = @1
+      i32.const 10
+    else
+      i32.const 20
+    end)
+  (func (;19;) (type 3) (param f32) (result i32)
+    local.get 0
+    f32.const -0x0p+0 (;=-0.0;)
+    f32.ne
+    if (result i32)  ;; label = @1
+      i32.const 10
+    else
+      i32.const 20
+    end)
+  (func (;20;) (type 2) (param f32 f32) (result i32)
+    local.get 0
+    local.get 1
+    f32.lt)
+  (func (;21;) (type 2) (param f32 f32) (result i32)
+    local.get 0
+    local.get 1
+    f32.lt
+    if (result i32)  ;; label = @1
+      i32.const 10
+    else
+      i32.const 20
+    end)
+  (func (;22;) (type 3) (param f32) (result i32)
+    local.get 0
+    f32.const -0x0p+0 (;=-0.0;)
+    f32.lt
+    if (result i32)  ;; label = @1
+      i32.const 10
+    else
+      i32.const 20
+    end)
+  (func (;23;) (type 2) (param f32 f32) (result i32)
+    local.get 0
+    local.get 1
+    f32.gt)
+  (func (;24;) (type 2) (param f32 f32) (result i32)
+    local.get 0
+    local.get 1
+    f32.gt
+    if (result i32)  ;; label = @1
+      i32.const 10
+    else
+      i32.const 20
+    end)
+  (func (;25;) (type 3) (param f32) (result i32)
+    local.get 0
+    f32.const -0x0p+0 (;=-0.0;)
+    f32.gt
+    if (result i32)  ;; label = @1
+      i32.const 10
+    else
+      i32.const 20
+    end)
+  (func (;26;) (type 2) (param f32 f32) (result i32)
+    local.get 0
+    local.get 1
+    f32.le)
+  (func (;27;) (type 2) (param f32 f32) (result i32)
+    local.get 0
+    local.get 1
+    f32.le
+    if (result i32)  ;; label = @1
+      i32.const 10
+    else
+      i32.const 20
+    end)
+  (func (;28;) (type 3) (param f32) (result i32)
+    local.get 0
+    f32.const -0x0p+0 (;=-0.0;)
+    f32.le
+    if (result i32)  ;; label = @1
+      i32.const 10
+    else
+      i32.const 20
+    end)
+  (func (;29;) (type 2) (param f32 f32) (result i32)
+    local.get 0
+    local.get 1
+    f32.ge)
+  (func (;30;) (type 2) (param f32 f32) (result i32)
+    local.get 0
+    local.get 1
+    f32.ge
+    if (result i32)  ;; label = @1
+      i32.const 10
+    else
+      i32.const 20
+    end)
+  (func (;31;) (type 3) (param f32) (result i32)
+    local.get 0
+    f32.const -0x0p+0 (;=-0.0;)
+    f32.ge
+    if (result i32)  ;; label = @1
+      i32.const 10
+    else
+      i32.const 20
+    end)
+  (func (;32;) (type 2) (param f32 f32) (result i32)
+    local.get 0
+    local.get 1
+    f32.lt
+    i32.eqz
+    if (result i32)  ;; label = @1
+      i32.const 1
+    else
+      i32.const 2
+    end)
+  (func (;33;) (type 3) (param f32) (result i32)
+    local.get 0
+    f32.const 0x0p+0 (;=0.0;)
+    f32.gt)
+  (func (;34;) (type 4) (param f64 f64) (result f64)
+    local.get 0
+    local.get 1
+    f64.add)
+  (func (;35;) (type 4) (param f64 f64) (result f64)
+    local.get 0
+    local.get 1
+    f64.sub)
+  (func (;36;) (type 4) (param f64 f64) (result f64)
+    local.get 0
+    local.get 1
+    f64.mul)
+  (func (;37;) (type 4) (param f64 f64) (result f64)
+    local.get 0
+    local.get 1
+    f64.div)
+  (func (;38;) (type 4) (param f64 f64) (result f64)
+    local.get 0
+    local.get 1
+    f64.min)
+  (func (;39;) (type 4) (param f64 f64) (result f64)
+    local.get 0
+    local.get 1
+    f64.max)
+  (func (;40;) (type 4) (param f64 f64) (result f64)
+    local.get 0
+    local.get 1
+    f64.copysign)
+  (func (;41;) (type 5) (param f64) (result f64)
+    local.get 0
+    f64.abs)
+  (func (;42;) (type 5) (param f64) (result f64)
+    local.get 0
+    f64.neg)
+  (func (;43;) (type 5) (param f64) (result f64)
+    local.get 0
+    f64.sqrt)
+  (func (;44;) (type 5) (param f64) (result f64)
+    local.get 0
+    f64.ceil)
+  (func (;45;) (type 5) (param f64) (result f64)
+    local.get 0
+    f64.floor)
+  (func (;46;) (type 5) (param f64) (result f64)
+    local.get 0
+    f64.trunc)
+  (func (;47;) (type 5) (param f64) (result f64)
+    local.get 0
+    f64.nearest)
+  (func (;48;) (type 6) (param f64 f64) (result i32)
+    local.get 0
+    local.get 1
+    f64.eq)
+  (func (;49;) (type 6) (param f64 f64) (result i32)
+    local.get 0
+    local.get 1
+    f64.eq
+    if (result i32)  ;; label = @1
+      i32.const 10
+    else
+      i32.const 20
+    end)
+  (func (;50;) (type 7) (param f64) (result i32)
+    local.get 0
+    f64.const -0x0p+0 (;=-0.0;)
+    f64.eq
+    if (result i32)  ;; label = @1
+      i32.const 10
+    else
+      i32.const 20
+    end)
+  (func (;51;) (type 6) (param f64 f64) (result i32)
+    local.get 0
+    local.get 1
+    f64.ne)
+  (func (;52;) (type 6) (param f64 f64) (result i32)
+    local.get 0
+    local.get 1
+    f64.ne
+    if (result i32)  ;; label = @1
+      i32.const 10
+    else
+      i32.const 20
+    end)
+  (func (;53;) (type 7) (param f64) (result i32)
+    local.get 0
+    f64.const -0x0p+0 (;=-0.0;)
+    f64.ne
+    if (result i32)  ;; label = @1
+      i32.const 10
+    else
+      i32.const 20
+    end)
+  (func (;54;) (type 6) (param f64 f64) (result i32)
+    local.get 0
+    local.get 1
+    f64.lt)
+  (func (;55;) (type 6) (param f64 f64) (result i32)
+    local.get 0
+    local.get 1
+    f64.lt
+    if (result i32)  ;; label = @1
+      i32.const 10
+    else
+      i32.const 20
+    end)
+  (func (;56;) (type 7) (param f64) (result i32)
+    local.get 0
+    f64.const -0x0p+0 (;=-0.0;)
+    f64.lt
+    if (result i32)  ;; label = @1
+      i32.const 10
+    else
+      i32.const 20
+    end)
+  (func (;57;) (type 6) (param f64 f64) (result i32)
+    local.get 0
+    local.get 1
+    f64.gt)
+  (func (;58;) (type 6) (param f64 f64) (result i32)
+    local.get 0
+    local.get 1
+    f64.gt
+    if (result i32)  ;; label = @1
+      i32.const 10
+    else
+      i32.const 20
+    end)
+  (func (;59;) (type 7) (param f64) (result i32)
+    local.get 0
+    f64.const -0x0p+0 (;=-0.0;)
+    f64.gt
+    if (result i32)  ;; label = @1
+      i32.const 10
+    else
+      i32.const 20
+    end)
+  (func (;60;) (type 6) (param f64 f64) (result i32)
+    local.get 0
+    local.get 1
+    f64.le)
+  (func (;61;) (type 6) (param f64 f64) (result i32)
+    local.get 0
+    local.get 1
+    f64.le
+    if (result i32)  ;; label = @1
+      i32.const 10
+    else
+      i32.const 20
+    end)
+  (func (;62;) (type 7) (param f64) (result i32)
+    local.get 0
+    f64.const -0x0p+0 (;=-0.0;)
+    f64.le
+    if (result i32)  ;; label = @1
+      i32.const 10
+    else
+      i32.const 20
+    end)
+  (func (;63;) (type 6) (param f64 f64) (result i32)
+    local.get 0
+    local.get 1
+    f64.ge)
+  (func (;64;) (type 6) (param f64 f64) (result i32)
+    local.get 0
+    local.get 1
+    f64.ge
+    if (result i32)  ;; label = @1
+      i32.const 10
+    else
+      i32.const 20
+    end)
+  (func (;65;) (type 7) (param f64) (result i32)
+    local.get 0
+    f64.const -0x0p+0 (;=-0.0;)
+    f64.ge
+    if (result i32)  ;; label = @1
+      i32.const 10
+    else
+      i32.const 20
+    end)
+  (func (;66;) (type 6) (param f64 f64) (result i32)
+    local.get 0
+    local.get 1
+    f64.lt
+    i32.eqz
+    if (result i32)  ;; label = @1
+      i32.const 1
+    else
+      i32.const 2
+    end)
+  (func (;67;) (type 7) (param f64) (result i32)
+    local.get 0
+    f64.const 0x0p+0 (;=0.0;)
+    f64.gt)
+  (func (;68;) (type 3) (param f32) (result i32)
+    local.get 0
+    i32.trunc_f32_s)
+  (func (;69;) (type 3) (param f32) (result i32)
+    local.get 0
+    i32.trunc_f32_u)
+  (func (;70;) (type 7) (param f64) (result i32)
+    local.get 0
+    i32.trunc_f64_s)
+  (func (;71;) (type 7) (param f64) (result i32)
+    local.get 0
+    i32.trunc_f64_u)
+  (func (;72;) (type 8) (param f32) (result i64)
+    local.get 0
+    i64.trunc_f32_s)
+  (func (;73;) (type 8) (param f32) (result i64)
+    local.get 0
+    i64.trunc_f32_u)
+  (func (;74;) (type 9) (param f64) (result i64)
+    local.get 0
+    i64.trunc_f64_s)
+  (func (;75;) (type 9) (param f64) (result i64)
+    local.get 0
+    i64.trunc_f64_u)
+  (func (;76;) (type 3) (param f32) (result i32)
+    local.get 0
+    i32.trunc_sat_f32_s)
+  (func (;77;) (type 3) (param f32) (result i32)
+    local.get 0
+    i32.trunc_sat_f32_u)
+  (func (;78;) (type 7) (param f64) (result i32)
+    local.get 0
+    i32.trunc_sat_f64_s)
+  (func (;79;) (type 7) (param f64) (result i32)
+    local.get 0
+    i32.trunc_sat_f64_u)
+  (func (;80;) (type 8) (param f32) (result i64)
+    local.get 0
+    i64.trunc_sat_f32_s)
+  (func (;81;) (type 8) (param f32) (result i64)
+    local.get 0
+    i64.trunc_sat_f32_u)
+  (func (;82;) (type 9) (param f64) (result i64)
+    local.get 0
+    i64.trunc_sat_f64_s)
+  (func (;83;) (type 9) (param f64) (result i64)
+    local.get 0
+    i64.trunc_sat_f64_u)
+  (func (;84;) (type 10) (param i32) (result f32)
+    local.get 0
+    f32.convert_i32_s)
+  (func (;85;) (type 10) (param i32) (result f32)
+    local.get 0
+    f32.convert_i32_u)
+  (func (;86;) (type 11) (param i64) (result f32)
+    local.get 0
+    f32.convert_i64_s)
+  (func (;87;) (type 11) (param i64) (result f32)
+    local.get 0
+    f32.convert_i64_u)
+  (func (;88;) (type 12) (param i32) (result f64)
+    local.get 0
+    f64.convert_i32_s)
+  (func (;89;) (type 12) (param i32) (result f64)
+    local.get 0
+    f64.convert_i32_u)
+  (func (;90;) (type 13) (param i64) (result f64)
+    local.get 0
+    f64.convert_i64_s)
+  (func (;91;) (type 13) (param i64) (result f64)
+    local.get 0
+    f64.convert_i64_u)
+  (func (;92;) (type 14) (param f64) (result f32)
+    local.get 0
+    f32.demote_f64)
+  (func (;93;) (type 15) (param f32) (result f64)
+    local.get 0
+    f64.promote_f32)
+  (func (;94;) (type 3) (param f32) (result i32)
+    local.get 0
+    i32.reinterpret_f32)
+  (func (;95;) (type 9) (param f64) (result i64)
+    local.get 0
+    i64.reinterpret_f64)
+  (func (;96;) (type 10) (param i32) (result f32)
+    local.get 0
+    f32.reinterpret_i32)
+  (func (;97;) (type 13) (param i64) (result f64)
+    local.get 0
+    f64.reinterpret_i64)
+  (func (;98;) (type 16) (param i64) (result i32)
+    local.get 0
+    i32.wrap_i64)
+  (func (;99;) (type 17) (param i32) (result i64)
+    local.get 0
+    i64.extend_i32_s)
+  (func (;100;) (type 17) (param i32) (result i64)
+    local.get 0
+    i64.extend_i32_u)
+  (func (;101;) (type 18) (result f64)
+    f64.const 0x1.8p+0 (;=1.5;)
+    f64.const 0x1.999999999999ap-4 (;=0.1;)
+    f64.add
+    f64.const 0x0p+0 (;=0.0;)
+    f64.add
+    f64.const -0x0p+0 (;=-0.0;)
+    f64.add
+    f64.const -0x1.6p+1 (;=-2.75;)
+    f64.mul)
+  (func (;102;) (type 19) (result f32)
+    f32.const 0x1.8p+0 (;=1.5;)
+    f32.const 0x1.99999ap-4 (;=0.10000000149011612;)
+    f32.add
+    f32.const 0x0p+0 (;=0.0;)
+    f32.add
+    f32.const 0x1.93e594p+99 (;=1.0000000150474662e+30;)
+    f32.mul)
+  (func (;103;) (type 18) (result f64)
+    f64.const -0x0p+0 (;=-0.0;))
+  (func (;104;) (type 20) (param i32 f64 i64 f32 f64) (result f64)
+    local.get 1
+    local.get 0
+    f64.convert_i32_s
+    f64.mul
+    local.get 2
+    f64.convert_i64_s
+    f64.add
+    local.get 3
+    f64.promote_f32
+    f64.sub
+    local.get 4
+    f64.div)
+  (func (;105;) (type 21) (param f64 f32) (result f64)
+    (local f32)
+    local.get 0
+    f64.const 0x1p+1 (;=2.0;)
+    f64.mul
+    local.get 1
+    local.set 2
+    i32.const 3
+    local.get 0
+    i64.const 4
+    local.get 1
+    f64.const 0x1p-1 (;=0.5;)
+    call 104
+    f64.add
+    local.get 2
+    f64.promote_f32
+    f64.add
+    local.get 0
+    f64.add)
+  (func (;106;) (type 5) (param f64) (result f64)
+    (local f64 f64 f64 f64 f64 f64 f64 f64 f64 f64 f64 f64 f64 f64 f64 f64 f64 f64 f64 f64)
+    local.get 0
+    f64.const 0x1p+0 (;=1.0;)
+    f64.mul
+    local.set 1
+    local.get 0
+    f64.const 0x1p+1 (;=2.0;)
+    f64.mul
+    local.set 2
+    local.get 0
+    f64.const 0x1.8p+1 (;=3.0;)
+    f64.mul
+    local.set 3
+    local.get 0
+    f64.const 0x1p+2 (;=4.0;)
+    f64.mul
+    local.set 4
+    local.get 0
+    f64.const 0x1.4p+2 (;=5.0;)
+    f64.mul
+    local.set 5
+    local.get 0
+    f64.const 0x1.8p+2 (;=6.0;)
+    f64.mul
+    local.set 6
+    local.get 0
+    f64.const 0x1.cp+2 (;=7.0;)
+    f64.mul
+    local.set 7
+    local.get 0
+    f64.const 0x1p+3 (;=8.0;)
+    f64.mul
+    local.set 8
+    local.get 0
+    f64.const 0x1.2p+3 (;=9.0;)
+    f64.mul
+    local.set 9
+    local.get 0
+    f64.const 0x1.4p+3 (;=10.0;)
+    f64.mul
+    local.set 10
+    local.get 0
+    f64.const 0x1.6p+3 (;=11.0;)
+    f64.mul
+    local.set 11
+    local.get 0
+    f64.const 0x1.8p+3 (;=12.0;)
+    f64.mul
+    local.set 12
+    local.get 0
+    f64.const 0x1.ap+3 (;=13.0;)
+    f64.mul
+    local.set 13
+    local.get 0
+    f64.const 0x1.cp+3 (;=14.0;)
+    f64.mul
+    local.set 14
+    local.get 0
+    f64.const 0x1.ep+3 (;=15.0;)
+    f64.mul
+    local.set 15
+    local.get 0
+    f64.const 0x1p+4 (;=16.0;)
+    f64.mul
+    local.set 16
+    local.get 0
+    f64.const 0x1.1p+4 (;=17.0;)
+    f64.mul
+    local.set 17
+    local.get 0
+    f64.const 0x1.2p+4 (;=18.0;)
+    f64.mul
+    local.set 18
+    local.get 0
+    f64.const 0x1.3p+4 (;=19.0;)
+    f64.mul
+    local.set 19
+    local.get 0
+    f64.const 0x1.4p+4 (;=20.0;)
+    f64.mul
+    local.set 20
+    local.get 0
+    local.get 1
+    f64.add
+    local.get 2
+    f64.add
+    local.get 3
+    f64.add
+    local.get 4
+    f64.add
+    local.get 5
+    f64.add
+    local.get 6
+    f64.add
+    local.get 7
+    f64.add
+    local.get 8
+    f64.add
+    local.get 9
+    f64.add
+    local.get 10
+    f64.add
+    local.get 11
+    f64.add
+    local.get 12
+    f64.add
+    local.get 13
+    f64.add
+    local.get 14
+    f64.add
+    local.get 15
+    f64.add
+    local.get 16
+    f64.add
+    local.get 17
+    f64.add
+    local.get 18
+    f64.add
+    local.get 19
+    f64.add
+    local.get 20
+    f64.add
+    local.get 1
+    f64.sub
+    local.get 4
+    f64.sub
+    local.get 7
+    f64.sub
+    local.get 10
+    f64.sub
+    local.get 13
+    f64.sub
+    local.get 16
+    f64.sub
+    local.get 19
+    f64.sub)
+  (func (;107;) (type 22) (param f32 i32) (result f32)
+    block (result f32)  ;; label = @1
+      local.get 0
+      local.get 1
+      br_if 0
+      drop
+      f32.const 0x1.cp+2 (;=7.0;)
+    end
+    f32.const 0x1p-1 (;=0.5;)
+    f32.mul)
+  (func (;108;) (type 5) (param f64) (result f64)
+    local.get 0
+    f64.const 0x0p+0 (;=0.0;)
+    f64.lt
+    if (result f64)  ;; label = @1
+      local.get 0
+      f64.neg
+    else
+      local.get 0
+      f64.sqrt
+    end
+    f64.const 0x1p+0 (;=1.0;)
+    f64.add)
+  (func (;109;) (type 12) (param i32) (result f64)
+    (local f64)
+    block  ;; label = @1
+      loop  ;; label = @2
+        local.get 0
+        i32.eqz
+        br_if 1
+        local.get 1
+        f64.const 0x1p+0 (;=1.0;)
+        local.get 0
+        f64.convert_i32_u
+        f64.div
+        f64.add
+        local.set 1
+        local.get 0
+        i32.const 1
+        i32.sub
+        local.set 0
+        br 0
+      end
+    end
+    local.get 1)
+  (func (;110;) (type 7) (param f64) (result i32)
+    (local i32)
+    block  ;; label = @1
+      loop  ;; label = @2
+        local.get 0
+        f64.const 0x1p+0 (;=1.0;)
+        f64.le
+        br_if 1
+        local.get 0
+        f64.const 0x1p-1 (;=0.5;)
+        f64.mul
+        local.set 0
+        local.get 1
+        i32.const 1
+        i32.add
+        local.set 1
+        br 0
+      end
+    end
+    local.get 1)
+  (func (;111;) (type 23) (param i32 f32) (result f32)
+    local.get 0
+    local.get 1
+    f32.store offset=4
+    local.get 0
+    f32.load offset=4
+    local.get 0
+    f32.load offset=4
+    f32.add)
+  (func (;112;) (type 24) (param i32 f64) (result i64)
+    local.get 0
+    local.get 1
+    f64.store offset=8
+    local.get 0
+    i64.load offset=8)
+  (func (;113;) (type 17) (param i32) (result i64)
+    local.get 0
+    i64.const -1
+    i64.store
+    local.get 0
+    f64.const 0x0p+0 (;=0.0;)
+    f64.store
+    local.get 0
+    i64.load
+    local.get 0
+    f32.const -0x0p+0 (;=-0.0;)
+    f32.store
+    local.get 0
+    i64.load
+    i64.add)
+  (func (;114;) (type 18) (result f64)
+    i32.const 16
+    f64.load
+    i32.const 24
+    f32.load
+    f64.promote_f32
+    f64.add)
+  (func (;115;) (type 5) (param f64) (result f64)
+    local.get 0
+    f64.const 0x0p+0 (;=0.0;)
+    f64.add
+    local.get 0
+    f64.const 0x1p+0 (;=1.0;)
+    f64.add
+    local.get 0
+    f64.const 0x1p+1 (;=2.0;)
+    f64.add
+    local.get 0
+    f64.const 0x1.8p+1 (;=3.0;)
+    f64.add
+    local.get 0
+    f64.const 0x1p+2 (;=4.0;)
+    f64.add
+    local.get 0
+    f64.const 0x1.4p+2 (;=5.0;)
+    f64.add
+    local.get 0
+    f64.const 0x1.8p+2 (;=6.0;)
+    f64.add
+    local.get 0
+    f64.const 0x1.cp+2 (;=7.0;)
+    f64.add
+    local.get 0
+    f64.const 0x1p+3 (;=8.0;)
+    f64.add
+    local.get 0
+    f64.const 0x1.2p+3 (;=9.0;)
+    f64.add
+    local.get 0
+    f64.const 0x1.4p+3 (;=10.0;)
+    f64.add
+    local.get 0
+    f64.const 0x1.6p+3 (;=11.0;)
+    f64.add
+    f64.mul
+    f64.mul
+    f64.mul
+    f64.mul
+    f64.mul
+    f64.mul
+    f64.mul
+    f64.mul
+    f64.mul
+    f64.mul
+    f64.mul)
+  (memory (;0;) 1)
+  (export "f32.add" (func 0))
+  (export "f32.sub" (func 1))
+  (export "f32.mul" (func 2))
+  (export "f32.div" (func 3))
+  (export "f32.min" (func 4))
+  (export "f32.max" (func 5))
+  (export "f32.copysign" (func 6))
+  (export "f32.abs" (func 7))
+  (export "f32.neg" (func 8))
+  (export "f32.sqrt" (func 9))
+  (export "f32.ceil" (func 10))
+  (export "f32.floor" (func 11))
+  (export "f32.trunc" (func 12))
+  (export "f32.nearest" (func 13))
+  (export "f32.eq" (func 14))
+  (export "f32.eq-if" (func 15))
+  (export "f32.eq-zero-if" (func 16))
+  (export "f32.ne" (func 17))
+  (export "f32.ne-if" (func 18))
+  (export "f32.ne-zero-if" (func 19))
+  (export "f32.lt" (func 20))
+  (export "f32.lt-if" (func 21))
+  (export "f32.lt-zero-if" (func 22))
+  (export "f32.gt" (func 23))
+  (export "f32.gt-if" (func 24))
+  (export "f32.gt-zero-if" (func 25))
+  (export "f32.le" (func 26))
+  (export "f32.le-if" (func 27))
+  (export "f32.le-zero-if" (func 28))
+  (export "f32.ge" (func 29))
+  (export "f32.ge-if" (func 30))
+  (export "f32.ge-zero-if" (func 31))
+  (export "f32.ne-eqz-if" (func 32))
+  (export "f32.gt-zero" (func 33))
+  (export "f64.add" (func 34))
+  (export "f64.sub" (func 35))
+  (export "f64.mul" (func 36))
+  (export "f64.div" (func 37))
+  (export "f64.min" (func 38))
+  (export "f64.max" (func 39))
+  (export "f64.copysign" (func 40))
+  (export "f64.abs" (func 41))
+  (export "f64.neg" (func 42))
+  (export "f64.sqrt" (func 43))
+  (export "f64.ceil" (func 44))
+  (export "f64.floor" (func 45))
+  (export "f64.trunc" (func 46))
+  (export "f64.nearest" (func 47))
+  (export "f64.eq" (func 48))
+  (export "f64.eq-if" (func 49))
+  (export "f64.eq-zero-if" (func 50))
+  (export "f64.ne" (func 51))
+  (export "f64.ne-if" (func 52))
+  (export "f64.ne-zero-if" (func 53))
+  (export "f64.lt" (func 54))
+  (export "f64.lt-if" (func 55))
+  (export "f64.lt-zero-if" (func 56))
+  (export "f64.gt" (func 57))
+  (export "f64.gt-if" (func 58))
+  (export "f64.gt-zero-if" (func 59))
+  (export "f64.le" (func 60))
+  (export "f64.le-if" (func 61))
+  (export "f64.le-zero-if" (func 62))
+  (export "f64.ge" (func 63))
+  (export "f64.ge-if" (func 64))
+  (export "f64.ge-zero-if" (func 65))
+  (export "f64.ne-eqz-if" (func 66))
+  (export "f64.gt-zero" (func 67))
+  (export "i32.trunc_f32_s" (func 68))
+  (export "i32.trunc_f32_u" (func 69))
+  (export "i32.trunc_f64_s" (func 70))
+  (export "i32.trunc_f64_u" (func 71))
+  (export "i64.trunc_f32_s" (func 72))
+  (export "i64.trunc_f32_u" (func 73))
+  (export "i64.trunc_f64_s" (func 74))
+  (export "i64.trunc_f64_u" (func 75))
+  (export "i32.trunc_sat_f32_s" (func 76))
+  (export "i32.trunc_sat_f32_u" (func 77))
+  (export "i32.trunc_sat_f64_s" (func 78))
+  (export "i32.trunc_sat_f64_u" (func 79))
+  (export "i64.trunc_sat_f32_s" (func 80))
+  (export "i64.trunc_sat_f32_u" (func 81))
+  (export "i64.trunc_sat_f64_s" (func 82))
+  (export "i64.trunc_sat_f64_u" (func 83))
+  (export "f32.convert_i32_s" (func 84))
+  (export "f32.convert_i32_u" (func 85))
+  (export "f32.convert_i64_s" (func 86))
+  (export "f32.convert_i64_u" (func 87))
+  (export "f64.convert_i32_s" (func 88))
+  (export "f64.convert_i32_u" (func 89))
+  (export "f64.convert_i64_s" (func 90))
+  (export "f64.convert_i64_u" (func 91))
+  (export "f32.demote_f64" (func 92))
+  (export "f64.promote_f32" (func 93))
+  (export "i32.reinterpret_f32" (func 94))
+  (export "i64.reinterpret_f64" (func 95))
+  (export "f32.reinterpret_i32" (func 96))
+  (export "f64.reinterpret_i64" (func 97))
+  (export "i32.wrap_i64" (func 98))
+  (export "i64.extend_i32_s" (func 99))
+  (export "i64.extend_i32_u" (func 100))
+  (export "consts" (func 101))
+  (export "consts32" (func 102))
+  (export "neg-zero" (func 103))
+  (export "mixed" (func 104))
+  (export "call-mixed" (func 105))
+  (export "spill" (func 106))
+  (export "select-block" (func 107))
+  (export "if-result" (func 108))
+  (export "harmonic" (func 109))
+  (export "halve" (func 110))
+  (export "store-load32" (func 111))
+  (export "store-load64" (func 112))
+  (export "store-zero" (func 113))
+  (export "load-data" (func 114))
+  (export "deep" (func 115))
+  (data (;0;) (i32.const 16) "\00\00\00\00\00\00\04@\00\00\80>"))
@@ -0,0 +1,170 @@
+(module
+  (type (;0;) (func (result i32)))
+  (type (;1;) (func (result i64)))
+  (type (;2;) (func (param i32) (result i32)))
+  (type (;3;) (func (param i64 i64) (result i64)))
+  (type (;4;) (func (param i32 i32) (result i32)))
+  (type (;5;) (func (param i64 i64) (result i32)))
+  (func (;0;) (type 0) (result i32)
+    i32.const 7
+    i32.const 3
+    i32.sub
+    i32.const 6
+    i32.mul
+    i32.const -5
+    i32.div_s
+    i32.const 3
+    i32.shl
+    i32.const 5
+    i32.rem_u)
+  (func (;1;) (type 0) (result i32)
+    i32.const -17
+    i32.const 5
+    i32.rem_s
+    i32.const -2147483648
+    i32.const -1
+    i32.rem_s
+    i32.add
+    i32.const 1
+    i32.shr_s)
+  (func (;2;) (type 1) (result i64)
+    i64.const -1
+    i64.const 60
+    i64.shr_u
+    i64.const 0
+    i64.const 1
+    i64.sub
+    i64.const 68
+    i64.shl
+    i64.xor)
+  (func (;3;) (type 0) (result i32)
+    i32.const -1
+    i32.const 1
+    i32.lt_u
+    i32.const -1
+    i32.const 1
+    i32.lt_s
+    i32.const 3
+    i32.shl
+    i32.or
+    i64.const 5
+    i64.eqz
+    i32.add)
+  (func (;4;) (type 2) (param i32) (result i32)
+    local.get 0
+    i32.const 0
+    i32.div_u)
+  (func (;5;) (type 0) (result i32)
+    i32.const 5
+    i32.const 0
+    i32.rem_s)
+  (func (;6;) (type 0) (result i32)
+    i32.const -2147483648
+    i32.const -1
+    i32.div_s)
+  (func (;7;) (type 1) (result i64)
+    i64.const -9223372036854775808
+    i64.const -1
+    i64.div_s)
+  (func (;8;) (type 2) (param i32) (result i32)
+    local.get 0
+    i32.const 0
+    i32.add
+    i32.const 1
+    i32.mul
+    i32.const -1
+    i32.and
+    i32.const 1
+    i32.div_s
+    i32.const 8
+    i32.mul)
+  (func (;9;) (type 2) (param i32) (result i32)
+    local.get 0
+    i32.const 0
+    i32.mul
+    local.get 0
+    i32.const 1
+    i32.rem_u
+    i32.add
+    i32.const 0
+    local.get 0
+    i32.add
+    i32.add)
+  (func (;10;) (type 3) (param i64 i64) (result i64)
+    local.get 0
+    local.get 1
+    i64.shl
+    local.get 0
+    i64.const 3
+    i64.shr_s
+    i64.add
+    local.get 0
+    local.get 1
+    i64.shr_u
+    i64.xor)
+  (func (;11;) (type 4) (param i32 i32) (result i32)
+    local.get 0
+    local.get 1
+    i32.rem_s)
+  (func (;12;) (type 3) (param i64 i64) (result i64)
+    local.get 0
+    local.get 1
+    i64.rem_u)
+  (func (;13;) (type 2) (param i32) (result i32)
+    i32.const 5
+    local.get 0
+    i32.lt_s)
+  (func (;14;) (type 5) (param i64 i64) (result i32)
+    local.get 0
+    local.get 1
+    i64.gt_u
+    local.get 0
+    i64.const -4096
+    i64.ge_s
+    i32.const 1
+    i32.shl
+    i32.or
+    local.get 1
+    i64.eqz
+    i32.const 2
+    i32.shl
+    i32.or)
+  (func (;15;) (type 4) (param i32 i32) (result i32)
+    i32.const 74565
+    local.get 0
+    local.get 1
+    i32.div_u
+    i32.lt_s)
+  (func (;16;) (type 5) (param i64 i64) (result i32)
+    i64.const 81985529216486896
+    local.get 0
+    local.get 1
+    i64.div_u
+    i64.ge_u)
+  (func (;17;) (type 2) (param i32) (result i32)
+    local.get 0
+    i32.const 100
+    i32.le_u
+    if (result i32)  ;; label = @1
+      i32.const 1
+    else
+      i32.const 2
+    end)
+  (export "fold-arithmetic" (func 0))
+  (export "fold-signed" (func 1))
+  (export "fold-i64" (func 2))
+  (export "fold-compare" (func 3))
+  (export "div-by-zero" (func 4))
+  (export "rem-by-zero" (func 5))
+  (export "div-overflow" (func 6))
+  (export "div-overflow-i64" (func 7))
+  (export "identities" (func 8))
+  (export "zero-identities" (func 9))
+  (export "shifts" (func 10))
+  (export "rem-s" (func 11))
+  (export "rem-u" (func 12))
+  (export "const-left-compare" (func 13))
+  (export "compare-i64" (func 14))
+  (export "const-left-compare-computed" (func 15))
+  (export "i64-const-left-compare-computed" (func 16))
+  (export "compare-condition" (func 17)))
@@ -0,0 +1,103 @@
+(module
+  (type (;0;) (func (param i32) (result i32)))
+  (type (;1;) (func (param i32 i32) (result i32)))
+  (type (;2;) (func (param i64) (result i64)))
+  (type (;3;) (func (result i64)))
+  (type (;4;) (func (param i64 i64) (result i64)))
+  (func (;0;) (type 0) (param i32) (result i32)
+    local.get 0
+    i32.const 4095
+    i32.add)
+  (func (;1;) (type 0) (param i32) (result i32)
+    local.get 0
+    i32.const -7
+    i32.add)
+  (func (;2;) (type 0) (param i32) (result i32)
+    local.get 0
+    i32.const 20480
+    i32.sub)
+  (func (;3;) (type 0) (param i32) (result i32)
+    local.get 0
+    i32.const 74565
+    i32.add)
+  (func (;4;) (type 0) (param i32) (result i32)
+    i32.const 3
+    local.get 0
+    i32.add)
+  (func (;5;) (type 0) (param i32) (result i32)
+    i32.const 3
+    local.get 0
+    i32.sub)
+  (func (;6;) (type 1) (param i32 i32) (result i32)
+    local.get 0
+    i32.const 255
+    i32.and
+    local.get 1
+    i32.const -16
+    i32.or
+    i32.xor
+    i32.const 1431655765
+    i32.xor)
+  (func (;7;) (type 1) (param i32 i32) (result i32)
+    local.get 0
+    local.get 1
+    i32.and
+    local.get 0
+    local.get 1
+    i32.or
+    i32.xor
+    i32.const 305419896
+    i32.xor)
+  (func (;8;) (type 2) (param i64) (result i64)
+    local.get 0
+    i64.const -4294967296
+    i64.and)
+  (func (;9;) (type 2) (param i64) (result i64)
+    local.get 0
+    i64.const -81985529216486896
+    i64.sub)
+  (func (;10;) (type 3) (result i64)
+    i64.const -74566)
+  (func (;11;) (type 1) (param i32 i32) (result i32)
+    i32.const 74565
+    local.get 0
+    local.get 1
+    i32.div_u
+    i32.add)
+  (func (;12;) (type 1) (param i32 i32) (result i32)
+    i32.const 1000
+    local.get 0
+    local.get 1
+    i32.div_u
+    i32.mul)
+  (func (;13;) (type 4) (param i64 i64) (result i64)
+    i64.const 81985529216486896
+    local.get 0
+    local.get 1
+    i64.div_u
+    i64.xor)
+  (func (;14;) (type 0) (param i32) (result i32)
+    (local i32)
+    local.get 0
+    i32.const 1
+    i32.add
+    local.tee 1
+    local.get 1
+    i32.const 2
+    i32.sub
+    i32.mul)
+  (export "add-imm12" (func 0))
+  (export "add-negative" (func 1))
+  (export "sub-shifted" (func 2))
+  (export "add-wide" (func 3))
+  (export "const-left-add" (func 4))
+  (export "const-left-sub" (func 5))
+  (export "logic-imm" (func 6))
+  (export "logic-reg" (func 7))
+  (export "i64-and-high" (func 8))
+  (export "i64-sub-wide" (func 9))
+  (export "i64-movn" (func 10))
+  (export "const-left-add-computed" (func 11))
+  (export "const-left-mul-computed" (func 12))
+  (export "i64-const-left-xor-computed" (func 13))
+  (export "imm-into-local" (func 14)))
@@ -0,0 +1,167 @@
+(module
+  (type (;0;) (func (param i32) (result i32)))
+  (type (;1;) (func (result i64)))
+  (type (;2;) (func (param i32) (result i64)))
+  (type (;3;) (func (param i32 i32) (result i32)))
+  (type (;4;) (func (param i32 i64) (result i64)))
+  (type (;5;) (func (result i32)))
+  (type (;6;) (func (param i32 i32)))
+  (func (;0;) (type 0) (param i32) (result i32)
+    local.get 0
+    i32.load8_u)
+  (func (;1;) (type 0) (param i32) (result i32)
+    local.get 0
+    i32.load8_s)
+  (func (;2;) (type 0) (param i32) (result i32)
+    local.get 0
+    i32.load16_s offset=1)
+  (func (;3;) (type 0) (param i32) (result i32)
+    local.get 0
+    i32.load16_u offset=2)
+  (func (;4;) (type 0) (param i32) (result i32)
+    local.get 0
+    i32.load)
+  (func (;5;) (type 0) (param i32) (result i32)
+    local.get 0
+    i32.load offset=4)
+  (func (;6;) (type 0) (param i32) (result i32)
+    local.get 0
+    i32.load offset=3)
+  (func (;7;) (type 0) (param i32) (result i32)
+    local.get 0
+    i32.load offset=65536)
+  (func (;8;) (type 1) (result i64)
+    i32.const 100
+    i64.load)
+  (func (;9;) (type 2) (param i32) (result i64)
+    local.get 0
+    i64.load8_s
+    local.get 0
+    i64.load16_u
+    i64.xor
+    local.get 0
+    i64.load32_s
+    i64.add
+    local.get 0
+    i64.load32_u offset=4
+    i64.sub
+    local.get 0
+    i64.load16_s offset=2
+    i64.add
+    local.get 0
+    i64.load8_u offset=1
+    i64.add)
+  (func (;10;) (type 3) (param i32 i32) (result i32)
+    local.get 0
+    local.get 1
+    i32.store
+    local.get 0
+    i32.load)
+  (func (;11;) (type 4) (param i32 i64) (result i64)
+    local.get 0
+    local.get 1
+    i64.store
+    local.get 0
+    local.get 1
+    i64.store8 offset=8
+    local.get 0
+    local.get 1
+    i64.store16 offset=9
+    local.get 0
+    local.get 1
+    i64.store32 offset=11
+    local.get 0
+    i64.load
+    local.get 0
+    i64.load offset=8
+    i64.xor)
+  (func (;12;) (type 0) (param i32) (result i32)
+    local.get 0
+    i32.const -1
+    i32.store offset=8
+    local.get 0
+    i32.const 0
+    i32.store16 offset=9
+    local.get 0
+    i32.load offset=8)
+  (func (;13;) (type 0) (param i32) (result i32)
+    local.get 0
+    i32.const 4
+    i32.add
+    i32.load
+    local.get 0
+    i32.const 1
+    i32.shl
+    i32.load8_u
+    i32.add)
+  (func (;14;) (type 5) (result i32)
+    memory.size)
+  (func (;15;) (type 0) (param i32) (result i32)
+    local.get 0
+    memory.grow)
+  (func (;16;) (type 3) (param i32 i32) (result i32)
+    (local i32)
+    local.get 0
+    local.get 1
+    i32.add
+    local.set 2
+    local.get 0
+    local.get 1
+    i32.mul
+    local.get 1
+    memory.grow
+    i32.add
+    local.get 2
+    i32.add
+    local.get 0
+    i32.add)
+  (func (;17;) (type 5) (result i32)
+    i32.const -1
+    i32.load8_u)
+  (func (;18;) (type 6) (param i32 i32)
+    local.get 0
+    local.get 1
+    i32.store8)
+  (func (;19;) (type 0) (param i32) (result i32)
+    (local i32)
+    block  ;; label = @1
+      loop  ;; label = @2
+        local.get 0
+        i32.eqz
+        br_if 1
+        local.get 0
+        i32.const 1
+        i32.sub
+        local.tee 0
+        i32.load8_u
+        local.get 1
+        i32.add
+        local.set 1
+        br 0
+      end
+    end
+    local.get 1)
+  (memory (;0;) 1 2)
+  (export "load8_u" (func 0))
+  (export "load8_s" (func 1))
+  (export "load16_s" (func 2))
+  (export "load16_u" (func 3))
+  (export "load" (func 4))
+  (export "load-offset4" (func 5))
+  (export "load-offset3" (func 6))
+  (export "load-offset64k" (func 7))
+  (export "load64-const" (func 8))
+  (export "load64-extend" (func 9))
+  (export "store-load" (func 10))
+  (export "store64-narrow" (func 11))
+  (export "store-zero" (func 12))
+  (export "deferred-address" (func 13))
+  (export "size" (func 14))
+  (export "grow" (func 15))
+  (export "grow-live" (func 16))
+  (export "load-const-oob" (func 17))
+  (export "store8" (func 18))
+  (export "sum-bytes" (func 19))
+  (export "mem" (memory 0))
+  (data (;0;) (i32.const 0) "\80\81\82\83\84\85\86\87\88\89\8a\8b\8c\8d\8e\8fabcdefgh")
+  (data (;1;) (i32.const 100) "\88wfUD3\22\11"))
@@ -0,0 +1,62 @@
+#ifndef BYTESPAN_HPP
+#define BYTESPAN_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+///
+/// @brief Non-owning read-only view (pointer + length) into a byte buffer, e.g. a memory mapped wasm file.
+/// The owner of the underlying memory has to outlive every view created from it.
+///
+class ByteSpan final {
+public:
+  constexpr ByteSpan() = default;
+
+  constexpr ByteSpan(uint8_t const *const data, size_t const size) : data_(data), size_(size) {
+  }
+
+  // NOLINTNEXTLINE(google-explicit-constructor)
+  ByteSpan(std::vector<uint8_t> const &vec) : data_(vec.data()), size_(vec.size()) {
+  }
+
+  constexpr uint8_t const *data() const {
+    return data_;
+  }
+
+  constexpr size_t size() const {
+    return size_;
+  }
+
+  constexpr bool empty() const {
+    return size_ == 0U;
+  }
+
+  constexpr uint8_t operator[](size_t const index) const {
+    return data_[index];
+  }
+
+  constexpr uint8_t const *begin() const {
+    return data_;
+  }
+
+  constexpr uint8_t const *end() const {
+    return data_ + size_;
+  }
+
+  ///
+  /// @brief View of [offset, offset + length) of this span
+  ByteSpan subspan(size_t const offset, size_t const length) const {
+    if (offset > size_ || length > size_ - offset) {
+      throw std::out_of_range("subspan exceeds the range of the byte span.");
+    }
+    return ByteSpan{data_ + offset, length};
+  }
+
+private:
+  uint8_t const *data_ = nullptr;
+  size_t size_ = 0U;
+};
+
+#endif
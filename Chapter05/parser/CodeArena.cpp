@@ -0,0 +1,67 @@
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "CodeArena.hpp"
+
+CodeArena::CodeArena(const std::vector<MachineCode> &machineCodes, const std::vector<std::vector<ModuleInfo::CallSite>> &callSites,
+                     const std::vector<std::vector<ModuleInfo::TrapSite>> &trapSites) {
+  entryOffsets_.reserve(machineCodes.size());
+  for (const MachineCode &code : machineCodes) {
+    size_ = (size_ + functionAlignment - 1U) & ~(functionAlignment - 1U);
+    entryOffsets_.push_back(size_);
+    size_ += code.size() * sizeof(uint32_t);
+  }
+
+  size_t const pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  mappedSize_ = (std::max(size_, static_cast<size_t>(1U)) + pageSize - 1U) & ~(pageSize - 1U);
+  void *const mapping = mmap(nullptr, mappedSize_, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (mapping == MAP_FAILED) {
+    throw std::runtime_error("Failed to map code arena.");
+  }
+  base_ = static_cast<uint8_t *>(mapping); // anonymous memory is zero, and 0x00000000 encodes UDF #0
+
+  for (size_t i = 0U; i < machineCodes.size(); ++i) {
+    std::memcpy(base_ + entryOffsets_[i], machineCodes[i].data(), machineCodes[i].size() * sizeof(uint32_t));
+  }
+  for (size_t i = 0U; i < callSites.size(); ++i) {
+    for (const ModuleInfo::CallSite &callSite : callSites[i]) {
+      size_t const site = entryOffsets_[i] + callSite.instructionIndex * sizeof(uint32_t);
+      int64_t const offset = static_cast<int64_t>(entryOffsets_[callSite.callee]) - static_cast<int64_t>(site);
+      if ((offset < -(INT64_C(1) << 27)) || (offset >= (INT64_C(1) << 27))) {
+        munmap(mapping, mappedSize_);
+        throw std::runtime_error("Call target is out of the BL range.");
+      }
+      // bl: imm26 word offset
+      uint32_t const instruction = 0x94000000U | (static_cast<uint32_t>(offset >> 2) & 0x3FFFFFFU);
+      std::memcpy(base_ + site, &instruction, sizeof(instruction));
+    }
+  }
+
+  // the functions are laid out in index order and their sites are ascending, so the table comes out sorted
+  for (size_t i = 0U; i < trapSites.size(); ++i) {
+    for (const ModuleInfo::TrapSite &trapSite : trapSites[i]) {
+      trapOffsets_.emplace_back(entryOffsets_[i] + trapSite.instructionIndex * sizeof(uint32_t), trapSite.trapCode);
+    }
+  }
+
+  if (mprotect(mapping, mappedSize_, PROT_READ | PROT_EXEC) != 0) {
+    munmap(mapping, mappedSize_);
+    throw std::runtime_error("Failed to make code arena executable.");
+  }
+  __builtin___clear_cache(reinterpret_cast<char *>(base_), reinterpret_cast<char *>(base_ + size_));
+}
+
+uint32_t CodeArena::trapCodeAt(size_t const offset) const {
+  auto const found = std::lower_bound(trapOffsets_.begin(), trapOffsets_.end(), offset,
+                                      [](const std::pair<size_t, uint32_t> &trapOffset, size_t const value) {
+                                        return trapOffset.first < value;
+                                      });
+  return ((found != trapOffsets_.end()) && (found->first == offset)) ? found->second : 0U;
+}
+
+CodeArena::~CodeArena() {
+  munmap(base_, mappedSize_);
+}
@@ -0,0 +1,73 @@
+#ifndef CODEARENA_HPP
+#define CODEARENA_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "ModuleInfo.hpp"
+
+///
+/// @brief One executable memory region holding the machine code of every function of a module.
+/// The region is written once while it is still R+W, then switched to R+X (W^X) and the instruction cache is flushed a single time.
+/// Functions start on cache line boundaries, padding is filled with UDF so a stray jump traps instead of sliding into the next function.
+/// Calls between the functions are direct BLs, their offsets are patched in while the code is copied.
+/// The BRKs of the trap checks are kept in a table sorted by offset, the signal handler of the runtime looks the trap code up there.
+///
+class CodeArena final {
+public:
+  static constexpr size_t functionAlignment = 64U;
+
+  ///
+  /// @brief Lay out, copy and finalize the given function bodies
+  /// @param callSites Per function, the BLs to point at the entry of their callee
+  /// @param trapSites Per function, its trap instructions
+  /// @throws std::runtime_error if the region can not be mapped or protected, or a callee is out of the BL range
+  explicit CodeArena(const std::vector<MachineCode> &machineCodes, const std::vector<std::vector<ModuleInfo::CallSite>> &callSites = {},
+                     const std::vector<std::vector<ModuleInfo::TrapSite>> &trapSites = {});
+  CodeArena(const CodeArena &) = delete;
+  CodeArena &operator=(const CodeArena &) = delete;
+  ~CodeArena();
+
+  uint8_t const *base() const {
+    return base_;
+  }
+
+  size_t size() const {
+    return size_;
+  }
+
+  size_t numFunctions() const {
+    return entryOffsets_.size();
+  }
+
+  size_t entryOffset(size_t const funcIndex) const {
+    return entryOffsets_[funcIndex];
+  }
+
+  void const *entry(size_t const funcIndex) const {
+    return base_ + entryOffsets_[funcIndex];
+  }
+
+  template <typename FunctionPointer> FunctionPointer function(size_t const funcIndex) const {
+    return reinterpret_cast<FunctionPointer>(const_cast<void *>(entry(funcIndex)));
+  }
+
+  bool contains(uintptr_t const address) const {
+    return (address >= reinterpret_cast<uintptr_t>(base_)) && (address < reinterpret_cast<uintptr_t>(base_) + size_);
+  }
+
+  ///
+  /// @brief Trap code of the trap instruction at offset, 0 if there is none. Async-signal-safe.
+  uint32_t trapCodeAt(size_t offset) const;
+
+private:
+  uint8_t *base_ = nullptr;
+  size_t size_ = 0U;
+  size_t mappedSize_ = 0U;
+  std::vector<size_t> entryOffsets_;
+  std::vector<std::pair<size_t, uint32_t>> trapOffsets_; ///< (offset, trap code), ascending
+};
+
+#endif
@@ -0,0 +1,348 @@
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <unistd.h>
+#include <utility>
+
+#include "CodeArena.hpp"
+#include "CodeCache.hpp"
+#include "Logger.hpp"
+#include "MappedFile.hpp"
+#include "Sha256.hpp"
+#include "parser.hpp"
+
+// Layout of an entry, every field in host byte order (the entries are as little portable as the machine code in them):
+//   header   magic, format version, compiler version, key, module size, SHA-256 of the module, payload size, FNV-1a of the payload
+//   payload  signatures (length, chars)
+//            functions (type index, entry offset, instructions, call sites, trap sites)
+//            linear memory (has memory, initial and maximum pages, data segments (offset, length, bytes))
+//            exports (function index, name length, name)
+namespace {
+constexpr char entryMagic[8] = {'W', 'A', 'S', 'M', 'J', 'I', 'T', 'C'};
+constexpr uint32_t formatVersion = 2U;
+constexpr size_t headerSize = sizeof(entryMagic) + 2U * sizeof(uint32_t) + 4U * sizeof(uint64_t) + sizeof(Sha256Digest);
+
+constexpr uint64_t fnvOffsetBasis = 0xCBF29CE484222325U;
+constexpr uint64_t fnvPrime = 0x100000001B3U;
+
+uint64_t fnv1a(uint64_t hash, uint8_t const *const data, size_t const size) {
+  for (size_t i = 0U; i < size; i++) {
+    hash = (hash ^ data[i]) * fnvPrime;
+  }
+  return hash;
+}
+
+class EntryWriter final {
+public:
+  template <typename T> void put(T const value) {
+    uint8_t bytes[sizeof(T)];
+    std::memcpy(bytes, &value, sizeof(T));
+    bytes_.insert(bytes_.end(), bytes, bytes + sizeof(T));
+  }
+
+  void putBytes(void const *const data, size_t const size) {
+    put(static_cast<uint32_t>(size));
+    bytes_.insert(bytes_.end(), static_cast<uint8_t const *>(data), static_cast<uint8_t const *>(data) + size);
+  }
+
+  std::vector<uint8_t> &bytes() {
+    return bytes_;
+  }
+
+private:
+  std::vector<uint8_t> bytes_;
+};
+
+class EntryReader final {
+public:
+  explicit EntryReader(const ByteSpan &bytes) : bytes_(bytes) {
+  }
+
+  template <typename T> T get() {
+    T value;
+    std::memcpy(&value, take(sizeof(T)), sizeof(T));
+    return value;
+  }
+
+  ///
+  /// @brief Number of elements of a table, checked against the bytes left so a corrupt count can not allocate gigabytes
+  uint32_t getCount(size_t const minElementSize) {
+    uint32_t const count = get<uint32_t>();
+    if (static_cast<uint64_t>(count) * minElementSize > bytes_.size() - index_) {
+      throw std::runtime_error("error: table of the cache entry exceeds the entry.");
+    }
+    return count;
+  }
+
+  uint8_t const *take(size_t const size) {
+    if (size > bytes_.size() - index_) {
+      throw std::runtime_error("error: cache entry is truncated.");
+    }
+    uint8_t const *const data = bytes_.data() + index_;
+    index_ += size;
+    return data;
+  }
+
+  bool atEnd() const {
+    return index_ == bytes_.size();
+  }
+
+private:
+  ByteSpan bytes_;
+  size_t index_ = 0U;
+};
+
+// rebuild a module from the payload of an entry, checks every index before it is used
+ModuleInfo readPayload(const ByteSpan &payload) {
+  EntryReader reader(payload);
+  ModuleInfo moduleInfo;
+
+  uint32_t const numSignatures = reader.getCount(sizeof(uint32_t));
+  for (uint32_t i = 0U; i < numSignatures; i++) {
+    uint32_t const length = reader.getCount(1U);
+    std::string signature(reinterpret_cast<char const *>(reader.take(length)), length);
+    if ((signature.size() < 2U) || (signature.front() != static_cast<char>(SignatureType::PARAMSTART)) ||
+        (signature.find(static_cast<char>(SignatureType::PARAMEND)) == std::string::npos)) {
+      throw std::runtime_error("error: malformed signature in the cache entry.");
+    }
+    moduleInfo.signatureTypes.emplace_back(std::move(signature));
+  }
+
+  uint32_t const numFunctions = reader.getCount(5U * sizeof(uint32_t));
+  std::vector<uint32_t> entryOffsets;
+  for (uint32_t funcIndex = 0U; funcIndex < numFunctions; funcIndex++) {
+    ModuleInfo::FunctionInfo functionInfo;
+    functionInfo.typeIndex = reader.get<uint32_t>();
+    if (functionInfo.typeIndex >= numSignatures) {
+      throw std::runtime_error("error: type index in the cache entry is out of range.");
+    }
+    functionInfo.numParams = moduleInfo.getNumParamsForSignature(functionInfo.typeIndex);
+    moduleInfo.functionInfos.push_back(functionInfo);
+    entryOffsets.push_back(reader.get<uint32_t>());
+
+    uint32_t const numInstructions = reader.getCount(sizeof(uint32_t));
+    if (numInstructions == 0U) {
+      throw std::runtime_error("error: function without machine code in the cache entry.");
+    }
+    MachineCode machineCode(numInstructions);
+    std::memcpy(machineCode.data(), reader.take(numInstructions * sizeof(uint32_t)), numInstructions * sizeof(uint32_t));
+    moduleInfo.machineCodes.emplace_back(std::move(machineCode));
+
+    std::vector<ModuleInfo::CallSite> callSites(reader.getCount(2U * sizeof(uint32_t)));
+    for (ModuleInfo::CallSite &callSite : callSites) {
+      callSite.instructionIndex = reader.get<uint32_t>();
+      callSite.callee = reader.get<uint32_t>();
+      if ((callSite.instructionIndex >= numInstructions) || (callSite.callee >= numFunctions)) {
+        throw std::runtime_error("error: call site in the cache entry is out of range.");
+      }
+    }
+    moduleInfo.callSites.emplace_back(std::move(callSites));
+
+    std::vector<ModuleInfo::TrapSite> trapSites(reader.getCount(2U * sizeof(uint32_t)));
+    for (size_t i = 0U; i < trapSites.size(); i++) {
+      trapSites[i].instructionIndex = reader.get<uint32_t>();
+      trapSites[i].trapCode = reader.get<uint32_t>();
+      if ((trapSites[i].instructionIndex >= numInstructions) || ((i > 0U) && (trapSites[i].instructionIndex <= trapSites[i - 1U].instructionIndex))) {
+        throw std::runtime_error("error: trap site in the cache entry is out of range or out of order.");
+      }
+    }
+    moduleInfo.trapSites.emplace_back(std::move(trapSites));
+  }
+  moduleInfo.functionNums = numFunctions;
+
+  moduleInfo.hasMemory = reader.get<uint8_t>() != 0U;
+  moduleInfo.memoryInitialPages = reader.get<uint32_t>();
+  moduleInfo.memoryMaximumPages = reader.get<uint32_t>();
+  if ((moduleInfo.memoryInitialPages > moduleInfo.memoryMaximumPages) || (moduleInfo.memoryMaximumPages > 65536U)) {
+    throw std::runtime_error("error: memory limits in the cache entry are invalid.");
+  }
+  uint32_t const numDataSegments = reader.getCount(2U * sizeof(uint32_t));
+  for (uint32_t i = 0U; i < numDataSegments; i++) {
+    ModuleInfo::DataSegment segment;
+    segment.offset = reader.get<uint32_t>();
+    uint32_t const length = reader.getCount(1U);
+    uint8_t const *const bytes = reader.take(length);
+    segment.bytes.assign(bytes, bytes + length);
+    moduleInfo.dataSegments.emplace_back(std::move(segment));
+  }
+
+  uint32_t const numExports = reader.getCount(2U * sizeof(uint32_t));
+  for (uint32_t i = 0U; i < numExports; i++) {
+    uint32_t const funcIndex = reader.get<uint32_t>();
+    uint32_t const length = reader.getCount(1U);
+    std::string name(reinterpret_cast<char const *>(reader.take(length)), length);
+    if (funcIndex >= numFunctions) {
+      throw std::runtime_error("error: export in the cache entry is out of range.");
+    }
+    moduleInfo.functionsIndexName[funcIndex] = name;
+    moduleInfo.functionsNameIndex[name] = funcIndex;
+  }
+  if (!reader.atEnd()) {
+    throw std::runtime_error("error: trailing bytes after the payload of the cache entry.");
+  }
+
+  moduleInfo.codeArena = std::make_shared<CodeArena>(moduleInfo.machineCodes, moduleInfo.callSites, moduleInfo.trapSites);
+  // the layout is deterministic, a different one means the entry was not written by this arena
+  for (uint32_t funcIndex = 0U; funcIndex < numFunctions; funcIndex++) {
+    if (moduleInfo.codeArena->entryOffset(funcIndex) != entryOffsets[funcIndex]) {
+      throw std::runtime_error("error: entry offsets of the cache entry do not match the code arena.");
+    }
+  }
+  return moduleInfo;
+}
+} // namespace
+
+CodeCache::CodeCache(std::string directory) : directory_(std::move(directory)) {
+}
+
+uint64_t CodeCache::moduleKey(const ByteSpan &wasmBytes) {
+  uint64_t hash = fnv1a(fnvOffsetBasis, reinterpret_cast<uint8_t const *>(&compilerVersion), sizeof(compilerVersion));
+  return fnv1a(hash, wasmBytes.data(), wasmBytes.size());
+}
+
+std::string CodeCache::entryPath(uint64_t const key) const {
+  static constexpr char hexDigits[] = "0123456789abcdef";
+  std::string fileName(16U, '0');
+  for (size_t i = 0U; i < 16U; i++) {
+    fileName[15U - i] = hexDigits[(key >> (i * 4U)) & 0xFU];
+  }
+  return directory_ + "/" + fileName + ".wjc";
+}
+
+bool CodeCache::load(const ByteSpan &wasmBytes, ModuleInfo &moduleInfo) const {
+  uint64_t const key = moduleKey(wasmBytes);
+  std::string const path = entryPath(key);
+  if (access(path.c_str(), F_OK) != 0) {
+    return false;
+  }
+
+  try {
+    std::shared_ptr<MappedFile> const mappedFile = MappedFile::open(path);
+    EntryReader header(mappedFile->bytes());
+    if (std::memcmp(header.take(sizeof(entryMagic)), entryMagic, sizeof(entryMagic)) != 0) {
+      throw std::runtime_error("error: not a cache entry.");
+    }
+    if ((header.get<uint32_t>() != formatVersion) || (header.get<uint32_t>() != compilerVersion)) {
+      throw std::runtime_error("error: cache entry was written by another compiler version.");
+    }
+    if (header.get<uint64_t>() != key) {
+      throw std::runtime_error("error: cache entry belongs to another module.");
+    }
+    // the key is only a 64 bit hash, a module with the same key must not get the code of another one
+    if ((header.get<uint64_t>() != wasmBytes.size()) ||
+        (std::memcmp(header.take(sizeof(Sha256Digest)), sha256(wasmBytes).data(), sizeof(Sha256Digest)) != 0)) {
+      throw std::runtime_error("error: cache entry belongs to another module.");
+    }
+    uint64_t const payloadSize = header.get<uint64_t>();
+    uint64_t const payloadChecksum = header.get<uint64_t>();
+    if (payloadSize != mappedFile->bytes().size() - headerSize) {
+      throw std::runtime_error("error: cache entry is truncated.");
+    }
+    ByteSpan const payload = mappedFile->bytes().subspan(headerSize, payloadSize);
+    if (fnv1a(fnvOffsetBasis, payload.data(), payload.size()) != payloadChecksum) {
+      throw std::runtime_error("error: checksum of the cache entry does not match.");
+    }
+    moduleInfo = readPayload(payload);
+  } catch (const std::runtime_error &error) {
+    LOG_INFO("rejected cache entry " << path << ": " << error.what());
+    return false;
+  }
+  LOG_INFO("loaded compiled module from cache entry " << path);
+  return true;
+}
+
+void CodeCache::store(const ByteSpan &wasmBytes, const ModuleInfo &moduleInfo) const {
+  if (!moduleInfo.codeArena) {
+    throw std::runtime_error("error: module has to be compiled before it can be cached.");
+  }
+
+  EntryWriter payload;
+  payload.put(static_cast<uint32_t>(moduleInfo.signatureTypes.size()));
+  for (const std::string &signature : moduleInfo.signatureTypes) {
+    payload.putBytes(signature.data(), signature.size());
+  }
+  payload.put(static_cast<uint32_t>(moduleInfo.machineCodes.size()));
+  for (size_t funcIndex = 0U; funcIndex < moduleInfo.machineCodes.size(); funcIndex++) {
+    payload.put(moduleInfo.functionInfos[funcIndex].typeIndex);
+    payload.put(static_cast<uint32_t>(moduleInfo.codeArena->entryOffset(funcIndex)));
+    const MachineCode &machineCode = moduleInfo.machineCodes[funcIndex];
+    payload.put(static_cast<uint32_t>(machineCode.size()));
+    for (uint32_t const instruction : machineCode) {
+      payload.put(instruction);
+    }
+    payload.put(static_cast<uint32_t>(moduleInfo.callSites[funcIndex].size()));
+    for (const ModuleInfo::CallSite &callSite : moduleInfo.callSites[funcIndex]) {
+      payload.put(callSite.instructionIndex);
+      payload.put(callSite.callee);
+    }
+    payload.put(static_cast<uint32_t>(moduleInfo.trapSites[funcIndex].size()));
+    for (const ModuleInfo::TrapSite &trapSite : moduleInfo.trapSites[funcIndex]) {
+      payload.put(trapSite.instructionIndex);
+      payload.put(trapSite.trapCode);
+    }
+  }
+  payload.put(static_cast<uint8_t>(moduleInfo.hasMemory ? 1U : 0U));
+  payload.put(moduleInfo.memoryInitialPages);
+  payload.put(moduleInfo.memoryMaximumPages);
+  payload.put(static_cast<uint32_t>(moduleInfo.dataSegments.size()));
+  for (const ModuleInfo::DataSegment &segment : moduleInfo.dataSegments) {
+    payload.put(segment.offset);
+    payload.putBytes(segment.bytes.data(), segment.bytes.size());
+  }
+  payload.put(static_cast<uint32_t>(moduleInfo.functionsNameIndex.size()));
+  for (const auto &exported : moduleInfo.functionsNameIndex) {
+    payload.put(static_cast<uint32_t>(exported.second));
+    payload.putBytes(exported.first.data(), exported.first.size());
+  }
+
+  uint64_t const key = moduleKey(wasmBytes);
+  EntryWriter header;
+  for (char const magic : entryMagic) {
+    header.put(magic);
+  }
+  header.put(formatVersion);
+  header.put(compilerVersion);
+  header.put(key);
+  header.put(static_cast<uint64_t>(wasmBytes.size()));
+  for (uint8_t const digestByte : sha256(wasmBytes)) {
+    header.put(digestByte);
+  }
+  header.put(static_cast<uint64_t>(payload.bytes().size()));
+  header.put(fnv1a(fnvOffsetBasis, payload.bytes().data(), payload.bytes().size()));
+
+  // written next to the entry and renamed over it, a reader sees either the old or the new entry but never a partial one
+  std::string const path = entryPath(key);
+  std::string const temporaryPath = path + ".tmp" + std::to_string(getpid());
+  {
+    std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<char const *>(header.bytes().data()), static_cast<std::streamsize>(header.bytes().size()));
+    file.write(reinterpret_cast<char const *>(payload.bytes().data()), static_cast<std::streamsize>(payload.bytes().size()));
+    if (!file) {
+      std::remove(temporaryPath.c_str());
+      throw std::runtime_error("error: failed to write cache entry " + temporaryPath);
+    }
+  }
+  if (std::rename(temporaryPath.c_str(), path.c_str()) != 0) {
+    std::remove(temporaryPath.c_str());
+    throw std::runtime_error("error: failed to write cache entry " + path);
+  }
+}
+
+ModuleInfo compileWasmFileCached(const char *const filePath, const CodeCache &codeCache) {
+  std::shared_ptr<MappedFile> const wasmFile = MappedFile::open(filePath);
+  ModuleInfo moduleInfo;
+  if (codeCache.load(wasmFile->bytes(), moduleInfo)) {
+    return moduleInfo;
+  }
+
+  moduleInfo = processWasmFile(filePath);
+  compileOpCode(moduleInfo);
+  try {
+    codeCache.store(wasmFile->bytes(), moduleInfo);
+  } catch (const std::runtime_error &error) {
+    // the module is compiled anyway, the next run just misses again
+    LOG_ERROR(error.what());
+  }
+  return moduleInfo;
+}
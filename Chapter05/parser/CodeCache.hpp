@@ -0,0 +1,53 @@
+#ifndef CODECACHE_HPP
+#define CODECACHE_HPP
+
+#include <cstdint>
+#include <string>
+
+#include "ByteSpan.hpp"
+#include "ModuleInfo.hpp"
+
+///
+/// @brief On-disk cache of compiled modules, one file per module in a directory.
+/// An entry is keyed by a hash of the wasm bytes and compilerVersion. It holds the machine code, call and trap sites, entry offsets,
+/// signatures, exports and the linear memory of the module, a hit rebuilds the code arena from the memory mapped file without
+/// parsing or compiling anything. The size and SHA-256 of the module in the entry have to match as well, so a module whose key
+/// collides with another one never runs its code. Entries of another compiler version, of another module, with a wrong checksum,
+/// or with inconsistent tables are rejected and count as a miss.
+///
+class CodeCache final {
+public:
+  ///
+  /// @brief Bump whenever the generated machine code or the layout of an entry changes, older entries are then never hit
+  static constexpr uint32_t compilerVersion = 1U;
+
+  ///
+  /// @param directory Existing directory the entries are read from and written to
+  explicit CodeCache(std::string directory);
+
+  ///
+  /// @brief Cache key of a module: 64 bit FNV-1a over compilerVersion and the wasm bytes, names the file of its entry
+  static uint64_t moduleKey(const ByteSpan &wasmBytes);
+
+  std::string entryPath(uint64_t key) const;
+
+  ///
+  /// @brief Look up the compiled module of wasmBytes. On a hit moduleInfo is ready to run (code arena, signatures, exports, memory and
+  /// data segments), it has no function bodies and can not be compiled again.
+  /// @return false if there is no entry for the module or it was rejected, moduleInfo is left untouched then
+  bool load(const ByteSpan &wasmBytes, ModuleInfo &moduleInfo) const;
+
+  ///
+  /// @brief Write the entry of moduleInfo compiled from wasmBytes, replaces an existing entry atomically
+  /// @throws std::runtime_error if the module is not compiled or the entry can not be written
+  void store(const ByteSpan &wasmBytes, const ModuleInfo &moduleInfo) const;
+
+private:
+  std::string directory_;
+};
+
+///
+/// @brief processWasmFile and compileOpCode with the cache in front: a hit skips both, a miss compiles and stores the entry
+ModuleInfo compileWasmFileCached(const char *filePath, const CodeCache &codeCache);
+
+#endif
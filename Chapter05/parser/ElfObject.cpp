@@ -0,0 +1,298 @@
+#include <cstring>
+#include <elf.h>
+#include <map>
+#include <stdexcept>
+#include <utility>
+
+#include "CodeArena.hpp"
+#include "ElfObject.hpp"
+#include "LinearMemory.hpp"
+#include "Runtime.hpp"
+
+namespace {
+enum SectionIndex : uint16_t { TEXT = 1, RODATA, DATA_REL_RO, RELA_TEXT, RELA_DATA_REL_RO, SYMTAB, STRTAB, SHSTRTAB, NOTE_GNU_STACK, NUM_SECTIONS };
+
+constexpr size_t trampolineAlignment = 64U;
+constexpr size_t exportStubAlignment = 16U;
+constexpr size_t exportStubSize = 16U;
+constexpr size_t moduleDescriptorSize = 72U;
+constexpr size_t tableEntrySize = 16U;
+
+template <typename T> void append(std::vector<uint8_t> &bytes, T const &value) {
+  uint8_t raw[sizeof(T)];
+  std::memcpy(raw, &value, sizeof(T));
+  bytes.insert(bytes.end(), raw, raw + sizeof(T));
+}
+
+void alignTo(std::vector<uint8_t> &bytes, size_t const alignment) {
+  bytes.resize((bytes.size() + alignment - 1U) & ~(alignment - 1U), 0U); // 0x00000000 encodes UDF #0 in .text
+}
+
+void patchInstruction(std::vector<uint8_t> &text, size_t const offset, uint32_t const instruction) {
+  std::memcpy(text.data() + offset, &instruction, sizeof(instruction));
+}
+
+void appendRela(std::vector<uint8_t> &relocations, size_t const offset, uint32_t const symbol, uint32_t const type, int64_t const addend) {
+  Elf64_Rela rela{};
+  rela.r_offset = offset;
+  rela.r_info = ELF64_R_INFO(symbol, type);
+  rela.r_addend = addend;
+  append(relocations, rela);
+}
+
+class SymbolTable final {
+public:
+  SymbolTable() {
+    strings_.push_back('\0');
+    append(symbols_, Elf64_Sym{});
+  }
+
+  uint32_t add(const std::string &name, uint8_t const info, uint16_t const section, size_t const value, size_t const size) {
+    Elf64_Sym symbol{};
+    if (!name.empty()) {
+      symbol.st_name = static_cast<uint32_t>(strings_.size());
+      strings_.insert(strings_.end(), name.begin(), name.end());
+      strings_.push_back('\0');
+    }
+    symbol.st_info = info;
+    symbol.st_shndx = section;
+    symbol.st_value = value;
+    symbol.st_size = size;
+    append(symbols_, symbol);
+    return numSymbols_++;
+  }
+
+  uint32_t numSymbols() const {
+    return numSymbols_;
+  }
+
+  const std::vector<uint8_t> &symbols() const {
+    return symbols_;
+  }
+
+  const std::vector<uint8_t> &strings() const {
+    return strings_;
+  }
+
+private:
+  std::vector<uint8_t> symbols_;
+  std::vector<uint8_t> strings_;
+  uint32_t numSymbols_ = 1U;
+};
+
+std::string exportSymbolName(const std::string &symbolPrefix, const std::string &exportName) {
+  std::string name = symbolPrefix + exportName;
+  for (char &c : name) {
+    bool const isIdentifierChar = ((c >= 'a') && (c <= 'z')) || ((c >= 'A') && (c <= 'Z')) || ((c >= '0') && (c <= '9')) || (c == '_');
+    if (!isIdentifierChar) {
+      c = '_';
+    }
+  }
+  return name;
+}
+
+class ExportStub final {
+public:
+  std::string symbolName;
+  size_t funcIndex;
+  uint32_t trampolineSymbol;
+};
+
+class Section final {
+public:
+  const char *name;
+  uint32_t type;
+  uint64_t flags;
+  std::vector<uint8_t> const *bytes;
+  uint64_t alignment;
+  uint32_t link;
+  uint32_t info;
+  uint64_t entrySize;
+};
+} // namespace
+
+std::vector<uint8_t> emitElfObject(const ModuleInfo &moduleInfo, const std::string &symbolPrefix) {
+  if (!moduleInfo.codeArena) {
+    throw std::runtime_error("error: module has to be compiled before it can be written as an object.");
+  }
+
+  SymbolTable symbolTable;
+  uint32_t const textSymbol = symbolTable.add("", ELF64_ST_INFO(STB_LOCAL, STT_SECTION), TEXT, 0U, 0U);
+  uint32_t const rodataSymbol = symbolTable.add("", ELF64_ST_INFO(STB_LOCAL, STT_SECTION), RODATA, 0U, 0U);
+  uint32_t const relroSymbol = symbolTable.add("", ELF64_ST_INFO(STB_LOCAL, STT_SECTION), DATA_REL_RO, 0U, 0U);
+
+  // the functions keep the offsets they have in the code arena
+  std::vector<uint8_t> text;
+  std::vector<uint8_t> textRelocations;
+  std::vector<uint32_t> functionSymbols;
+  for (size_t funcIndex = 0U; funcIndex < moduleInfo.machineCodes.size(); funcIndex++) {
+    size_t const entryOffset = moduleInfo.codeArena->entryOffset(funcIndex);
+    const MachineCode &machineCode = moduleInfo.machineCodes[funcIndex];
+    text.resize(entryOffset, 0U);
+    for (uint32_t const instruction : machineCode) {
+      append(text, instruction);
+    }
+    functionSymbols.push_back(symbolTable.add(symbolPrefix + "function_" + std::to_string(funcIndex), ELF64_ST_INFO(STB_LOCAL, STT_FUNC), TEXT,
+                                              entryOffset, machineCode.size() * sizeof(uint32_t)));
+  }
+  for (size_t funcIndex = 0U; funcIndex < moduleInfo.callSites.size(); funcIndex++) {
+    for (const ModuleInfo::CallSite &callSite : moduleInfo.callSites[funcIndex]) {
+      size_t const site = moduleInfo.codeArena->entryOffset(funcIndex) + callSite.instructionIndex * sizeof(uint32_t);
+      patchInstruction(text, site, 0x94000000U); // bl: imm26 filled in by the linker
+      appendRela(textRelocations, site, functionSymbols[callSite.callee], R_AARCH64_CALL26, 0);
+    }
+  }
+
+  // one trampoline per signature of the exports, like the runtime generates them
+  std::map<std::string, std::string> exportNames; // by symbol name
+  std::map<std::string, uint32_t> signatureTrampolines;
+  std::vector<ExportStub> exportStubs;
+  for (const auto &exported : moduleInfo.functionsNameIndex) {
+    const std::string &signature = moduleInfo.signatureTypes[moduleInfo.functionInfos[exported.second].typeIndex];
+    if (signature.find(static_cast<char>(SignatureType::V128)) != std::string::npos) {
+      continue; // a v128 does not fit into a 64 bit slot, such functions are only called from compiled code
+    }
+    std::string symbolName = exportSymbolName(symbolPrefix, exported.first);
+    if (!exportNames.emplace(symbolName, exported.first).second) {
+      throw std::runtime_error("error: exports " + exportNames[symbolName] + " and " + exported.first + " map to the same symbol " + symbolName);
+    }
+    auto trampoline = signatureTrampolines.find(signature);
+    if (trampoline == signatureTrampolines.end()) {
+      MachineCode const machineCode = generateTrampoline(signature, moduleInfo);
+      alignTo(text, trampolineAlignment);
+      uint32_t const symbol = symbolTable.add(symbolPrefix + "trampoline_" + std::to_string(signatureTrampolines.size()),
+                                              ELF64_ST_INFO(STB_LOCAL, STT_FUNC), TEXT, text.size(), machineCode.size() * sizeof(uint32_t));
+      for (uint32_t const instruction : machineCode) {
+        append(text, instruction);
+      }
+      trampoline = signatureTrampolines.emplace(signature, symbol).first;
+    }
+    exportStubs.push_back(ExportStub{std::move(symbolName), exported.second, trampoline->second});
+  }
+  uint32_t const firstGlobalSymbol = symbolTable.numSymbols();
+
+  // an export moves the memory base into place and tail calls the trampoline with its entry
+  alignTo(text, exportStubAlignment);
+  for (const ExportStub &exportStub : exportStubs) {
+    symbolTable.add(exportStub.symbolName, ELF64_ST_INFO(STB_GLOBAL, STT_FUNC), TEXT, text.size(), exportStubSize);
+    append(text, 0xAA0103E2U); // mov x2, x1
+    appendRela(textRelocations, text.size(), functionSymbols[exportStub.funcIndex], R_AARCH64_ADR_PREL_PG_HI21, 0);
+    append(text, 0x90000001U); // adrp x1, entry
+    appendRela(textRelocations, text.size(), functionSymbols[exportStub.funcIndex], R_AARCH64_ADD_ABS_LO12_NC, 0);
+    append(text, 0x91000021U); // add x1, x1, :lo12:entry
+    appendRela(textRelocations, text.size(), exportStub.trampolineSymbol, R_AARCH64_JUMP26, 0);
+    append(text, 0x14000000U); // b trampoline
+  }
+
+  // Module descriptor, then the trap sites and the data segment table. Every pointer in them is an R_AARCH64_ABS64 relocation,
+  // so they go to .data.rel.ro: a PIE link turns them into RELATIVE relocations the loader applies before the segment becomes
+  // read-only, in .rodata they would need text relocations. The data segment bytes have no pointers and stay in .rodata.
+  size_t numTrapSites = 0U;
+  for (const std::vector<ModuleInfo::TrapSite> &trapSites : moduleInfo.trapSites) {
+    numTrapSites += trapSites.size();
+  }
+  size_t const trapSitesOffset = moduleDescriptorSize;
+  size_t const dataSegmentsOffset = trapSitesOffset + numTrapSites * tableEntrySize;
+  std::vector<uint8_t> relro;
+  std::vector<uint8_t> relroRelocations;
+  append(relro, static_cast<uint32_t>(moduleInfo.hasMemory ? 1U : 0U));
+  append(relro, moduleInfo.memoryInitialPages);
+  append(relro, moduleInfo.memoryMaximumPages);
+  append(relro, static_cast<uint32_t>(moduleInfo.dataSegments.size()));
+  if (!moduleInfo.dataSegments.empty()) {
+    appendRela(relroRelocations, relro.size(), relroSymbol, R_AARCH64_ABS64, static_cast<int64_t>(dataSegmentsOffset));
+  }
+  append(relro, uint64_t{0U});
+  if (numTrapSites != 0U) {
+    appendRela(relroRelocations, relro.size(), relroSymbol, R_AARCH64_ABS64, static_cast<int64_t>(trapSitesOffset));
+  }
+  append(relro, uint64_t{0U});
+  append(relro, static_cast<uint64_t>(numTrapSites));
+  // what the host has to set up around the memory base, memory.grow calls the host through the header
+  append(relro, static_cast<uint64_t>(LinearMemory::reservationSize));
+  append(relro, static_cast<uint32_t>(LinearMemory::headerSize));
+  append(relro, LinearMemory::growFunctionOffset);
+  append(relro, LinearMemory::pagesOffset);
+  append(relro, LinearMemory::outOfBoundsTrapCode);
+  if (moduleInfo.hasMemory) {
+    uint32_t const growSymbol = symbolTable.add(symbolPrefix + "memory_grow", ELF64_ST_INFO(STB_GLOBAL, STT_NOTYPE), SHN_UNDEF, 0U, 0U);
+    appendRela(relroRelocations, relro.size(), growSymbol, R_AARCH64_ABS64, 0);
+  }
+  append(relro, uint64_t{0U});
+  symbolTable.add(symbolPrefix + "module", ELF64_ST_INFO(STB_GLOBAL, STT_OBJECT), DATA_REL_RO, 0U, moduleDescriptorSize);
+
+  // the functions are laid out in index order and their sites are ascending, so the table comes out sorted
+  for (size_t funcIndex = 0U; funcIndex < moduleInfo.trapSites.size(); funcIndex++) {
+    for (const ModuleInfo::TrapSite &trapSite : moduleInfo.trapSites[funcIndex]) {
+      size_t const site = moduleInfo.codeArena->entryOffset(funcIndex) + trapSite.instructionIndex * sizeof(uint32_t);
+      appendRela(relroRelocations, relro.size(), textSymbol, R_AARCH64_ABS64, static_cast<int64_t>(site));
+      append(relro, uint64_t{0U});
+      append(relro, trapSite.trapCode);
+      append(relro, uint32_t{0U});
+    }
+  }
+  std::vector<uint8_t> rodata;
+  for (const ModuleInfo::DataSegment &segment : moduleInfo.dataSegments) {
+    append(relro, segment.offset);
+    append(relro, static_cast<uint32_t>(segment.bytes.size()));
+    appendRela(relroRelocations, relro.size(), rodataSymbol, R_AARCH64_ABS64, static_cast<int64_t>(rodata.size()));
+    append(relro, uint64_t{0U});
+    rodata.insert(rodata.end(), segment.bytes.begin(), segment.bytes.end());
+  }
+
+  std::vector<uint8_t> const noBytes;
+  std::vector<uint8_t> sectionNames(1U, '\0');
+  Section const sections[NUM_SECTIONS] = {
+      {"", SHT_NULL, 0U, &noBytes, 0U, 0U, 0U, 0U},
+      {".text", SHT_PROGBITS, SHF_ALLOC | SHF_EXECINSTR, &text, CodeArena::functionAlignment, 0U, 0U, 0U},
+      {".rodata", SHT_PROGBITS, SHF_ALLOC, &rodata, 8U, 0U, 0U, 0U},
+      {".data.rel.ro", SHT_PROGBITS, SHF_ALLOC | SHF_WRITE, &relro, 8U, 0U, 0U, 0U},
+      {".rela.text", SHT_RELA, SHF_INFO_LINK, &textRelocations, 8U, SYMTAB, TEXT, sizeof(Elf64_Rela)},
+      {".rela.data.rel.ro", SHT_RELA, SHF_INFO_LINK, &relroRelocations, 8U, SYMTAB, DATA_REL_RO, sizeof(Elf64_Rela)},
+      {".symtab", SHT_SYMTAB, 0U, &symbolTable.symbols(), 8U, STRTAB, firstGlobalSymbol, sizeof(Elf64_Sym)},
+      {".strtab", SHT_STRTAB, 0U, &symbolTable.strings(), 1U, 0U, 0U, 0U},
+      {".shstrtab", SHT_STRTAB, 0U, &sectionNames, 1U, 0U, 0U, 0U},
+      {".note.GNU-stack", SHT_PROGBITS, 0U, &noBytes, 1U, 0U, 0U, 0U}, // the object does not need an executable stack
+  };
+  std::vector<Elf64_Shdr> sectionHeaders(NUM_SECTIONS);
+  for (size_t i = 1U; i < NUM_SECTIONS; i++) {
+    sectionHeaders[i].sh_name = static_cast<uint32_t>(sectionNames.size());
+    sectionNames.insert(sectionNames.end(), sections[i].name, sections[i].name + std::strlen(sections[i].name) + 1U);
+  }
+
+  std::vector<uint8_t> object(sizeof(Elf64_Ehdr), 0U);
+  for (size_t i = 1U; i < NUM_SECTIONS; i++) {
+    alignTo(object, sections[i].alignment);
+    Elf64_Shdr &header = sectionHeaders[i];
+    header.sh_type = sections[i].type;
+    header.sh_flags = sections[i].flags;
+    header.sh_offset = object.size();
+    header.sh_size = sections[i].bytes->size();
+    header.sh_link = sections[i].link;
+    header.sh_info = sections[i].info;
+    header.sh_addralign = sections[i].alignment;
+    header.sh_entsize = sections[i].entrySize;
+    object.insert(object.end(), sections[i].bytes->begin(), sections[i].bytes->end());
+  }
+  alignTo(object, 8U);
+
+  Elf64_Ehdr elfHeader{};
+  std::memcpy(elfHeader.e_ident, ELFMAG, SELFMAG);
+  elfHeader.e_ident[EI_CLASS] = ELFCLASS64;
+  elfHeader.e_ident[EI_DATA] = ELFDATA2LSB;
+  elfHeader.e_ident[EI_VERSION] = EV_CURRENT;
+  elfHeader.e_ident[EI_OSABI] = ELFOSABI_NONE;
+  elfHeader.e_type = ET_REL;
+  elfHeader.e_machine = EM_AARCH64;
+  elfHeader.e_version = EV_CURRENT;
+  elfHeader.e_shoff = object.size();
+  elfHeader.e_ehsize = sizeof(Elf64_Ehdr);
+  elfHeader.e_shentsize = sizeof(Elf64_Shdr);
+  elfHeader.e_shnum = NUM_SECTIONS;
+  elfHeader.e_shstrndx = SHSTRTAB;
+  std::memcpy(object.data(), &elfHeader, sizeof(elfHeader));
+  for (const Elf64_Shdr &header : sectionHeaders) {
+    append(object, header);
+  }
+  return object;
+}
@@ -0,0 +1,42 @@
+#ifndef ELFOBJECT_HPP
+#define ELFOBJECT_HPP
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "ModuleInfo.hpp"
+
+///
+/// @brief Write a compiled module as an AArch64 ELF64 relocatable object, so a C host links it statically instead of compiling at startup.
+/// .text holds the functions in the layout of the code arena, followed by one trampoline per signature and the exports.
+/// Calls between the functions are left to the linker as R_AARCH64_CALL26 relocations, the pointers of the module descriptor and
+/// its tables as R_AARCH64_ABS64 ones. Those live in .data.rel.ro, so the object links into a PIE as well as a static executable.
+/// Global symbols, non-identifier characters of the export names replaced by '_':
+///   uint64_t <prefix><export>(uint64_t const *args, uint8_t *memoryBase)
+///     per export without v128 in its signature, arguments packed like Runtime::invoke, memoryBase like LinearMemory::base()
+///   struct { uint32_t hasMemory, initialPages, maximumPages, numDataSegments;
+///            struct { uint32_t offset, size; uint8_t const *bytes; } const *dataSegments;
+///            struct { void const *address; uint32_t trapCode, reserved; } const *trapSites; uint64_t numTrapSites;
+///            uint64_t reservationSize; uint32_t headerSize; int32_t growFunctionOffset, pagesOffset; uint32_t outOfBoundsTrapCode;
+///            uint32_t (*grow)(uint8_t *memoryBase, uint32_t delta); } <prefix>module
+///     the trap sites are sorted by address, the SIGTRAP handler of the host maps the PC of a BRK to its trap code with them
+/// Undefined symbol, only if the module has a memory:
+///   uint32_t <prefix>memory_grow(uint8_t *memoryBase, uint32_t delta)
+///     grows by delta pages and returns the previous size in pages, UINT32_MAX if it can not (like LinearMemory::grow)
+///
+/// The compiled code expects the host to provide the linear memory like LinearMemory does:
+/// - reservationSize bytes (8 GiB + 64 KiB) from memoryBase are reserved PROT_NONE, only the current pages are readable and
+///   writable. Accesses are not bounds checked, an out of bounds access faults inside the reservation.
+/// - headerSize bytes right in front of memoryBase are readable: the current size in pages as uint64_t at memoryBase + pagesOffset
+///   (-8), read by memory.size, and the grow function at memoryBase + growFunctionOffset (-16), called by memory.grow with
+///   memoryBase in X0 and the delta in W1. The first 8 bytes (-24) are left to the host, e.g. its memory object. The grow function
+///   (usually module.grow) makes the new pages accessible and updates the pages field.
+/// - a SIGSEGV of an instruction in .text at an address inside the reservation is the trap outOfBoundsTrapCode, a SIGTRAP at a
+///   trap site has the trap code of the site. Both handlers leave the compiled code without returning to it (e.g. siglongjmp),
+///   SIGSEGV needs SA_NODEFER or the jump has to restore the signal mask.
+/// - the active data segments are copied to their offsets before the first call.
+/// @throws std::runtime_error if the module is not compiled, two exports map to the same symbol or an export has no trampoline
+std::vector<uint8_t> emitElfObject(const ModuleInfo &moduleInfo, const std::string &symbolPrefix);
+
+#endif
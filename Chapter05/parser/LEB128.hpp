@@ -0,0 +1,156 @@
+#ifndef LEB128_HPP
+#define LEB128_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+
+#include "ByteSpan.hpp"
+
+namespace leb128 {
+///
+/// @brief Longest encoding of any LEB128 value, the fast path is taken when at least this many bytes remain
+constexpr size_t maxEncodedBytes = 10U;
+
+template <typename T> constexpr size_t maxBytes() {
+  return (sizeof(T) * 8U + 6U) / 7U;
+}
+
+///
+/// @brief Check the unused high bits of the last byte of a maximum length encoding, they have to be zero (unsigned) or a
+/// copy of the sign bit (signed)
+template <typename T> inline void checkLastByte(uint8_t const byte) {
+  constexpr uint32_t usedBits = sizeof(T) * 8U - (maxBytes<T>() - 1U) * 7U;
+  if constexpr (std::is_signed<T>::value) {
+    uint32_t const unused = byte & (0x7FU & ~((1U << (usedBits - 1U)) - 1U));
+    if ((unused != 0U) && (unused != (0x7FU & ~((1U << (usedBits - 1U)) - 1U)))) {
+      throw std::overflow_error("SLEB128 encoding has unused bits that do not match the sign.");
+    }
+  } else {
+    if ((byte >> usedBits) != 0U) {
+      throw std::overflow_error("ULEB128 encoding does not fit the integer type.");
+    }
+  }
+}
+
+template <typename T> inline T finish(uint64_t const result, uint32_t const numBytes) {
+  if constexpr (std::is_signed<T>::value) {
+    uint32_t const bits = numBytes * 7U;
+    if (bits < 64U) {
+      // sign-extend from the last decoded bit
+      uint32_t const shift = 64U - bits;
+      return static_cast<T>(static_cast<int64_t>(result << shift) >> shift);
+    }
+  } else {
+    static_cast<void>(numBytes);
+  }
+  return static_cast<T>(result);
+}
+
+///
+/// @brief Byte by byte decoder with a bounds check per byte, used near the end of the buffer
+template <typename T> T readSlow(const ByteSpan &data, size_t &index) {
+  uint64_t result = 0U;
+  for (uint32_t byteCount = 0U; byteCount < maxBytes<T>(); ++byteCount) {
+    if (index >= data.size()) {
+      throw std::out_of_range("LEB128 encoding is incomplete or data is truncated.");
+    }
+    uint8_t const byte = data[index++];
+    result |= static_cast<uint64_t>(byte & 0x7FU) << (byteCount * 7U);
+    if ((byte & 0x80U) == 0U) {
+      if (byteCount + 1U == maxBytes<T>()) {
+        checkLastByte<T>(byte);
+      }
+      return finish<T>(result, byteCount + 1U);
+    }
+  }
+  throw std::overflow_error("LEB128 encoding exceeds the maximum length for its integer type.");
+}
+
+///
+/// @brief Decoder without per-byte bounds checks, the caller guarantees at least maxEncodedBytes readable bytes.
+/// Beyond one byte, the first 8 bytes are loaded as one word, the terminator is found with a count of trailing zeros and the
+/// 7 bit groups are packed with three shift/mask steps instead of a loop. Only encodings longer than 8 bytes continue byte-wise.
+template <typename T> inline T readFast(uint8_t const *const bytes, size_t &index) {
+  // most immediates (local indices, branch depths, small constants) fit one byte
+  if (__builtin_expect((bytes[0] & 0x80U) == 0U, 1)) {
+    index++;
+    return finish<T>(bytes[0], 1U);
+  }
+  uint64_t word;
+  std::memcpy(&word, bytes, sizeof(word));
+  uint64_t const stopBits = ~word & 0x8080808080808080ULL;
+  if (stopBits == 0U) {
+    // no terminator in the first 8 bytes, only valid for 64 bit values
+    if constexpr (maxBytes<T>() <= 8U) {
+      throw std::overflow_error("LEB128 encoding exceeds the maximum length for its integer type.");
+    } else {
+      uint64_t result = 0U;
+      for (uint32_t byteCount = 0U; byteCount < maxBytes<T>(); ++byteCount) {
+        uint8_t const byte = bytes[byteCount];
+        result |= static_cast<uint64_t>(byte & 0x7FU) << (byteCount * 7U);
+        if ((byte & 0x80U) == 0U) {
+          if (byteCount + 1U == maxBytes<T>()) {
+            checkLastByte<T>(byte);
+          }
+          index += byteCount + 1U;
+          return finish<T>(result, byteCount + 1U);
+        }
+      }
+      throw std::overflow_error("LEB128 encoding exceeds the maximum length for its integer type.");
+    }
+  }
+
+  uint32_t const numBytes = static_cast<uint32_t>(__builtin_ctzll(stopBits)) / 8U + 1U;
+  if (numBytes > maxBytes<T>()) {
+    throw std::overflow_error("LEB128 encoding exceeds the maximum length for its integer type.");
+  }
+  if (numBytes == maxBytes<T>()) {
+    checkLastByte<T>(bytes[numBytes - 1U]);
+  }
+
+  uint64_t value = word & 0x7F7F7F7F7F7F7F7FULL;
+  if (numBytes < 8U) {
+    value &= (1ULL << (numBytes * 8U)) - 1U;
+  }
+  value = (value & 0x007F007F007F007FULL) | ((value & 0x7F007F007F007F00ULL) >> 1U);
+  value = (value & 0x00003FFF00003FFFULL) | ((value & 0x3FFF00003FFF0000ULL) >> 2U);
+  value = (value & 0x000000000FFFFFFFULL) | ((value & 0x0FFFFFFF00000000ULL) >> 4U);
+  index += numBytes;
+  return finish<T>(value, numBytes);
+}
+} // namespace leb128
+
+///
+/// @brief Decode one LEB128 integer at data[index] and advance index past it
+/// @tparam T uint32_t/uint64_t (ULEB128) or int32_t/int64_t (SLEB128)
+/// @throws std::out_of_range if the encoding is truncated, std::overflow_error if it is too long or does not fit T
+template <typename T> inline T readLEB128(const ByteSpan &data, size_t &index) {
+  static_assert(std::is_integral<T>::value && (sizeof(T) == 4U || sizeof(T) == 8U), "LEB128 decoding supports 32 and 64 bit integers");
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+  if ((index < data.size()) && (data.size() - index >= leb128::maxEncodedBytes)) {
+    return leb128::readFast<T>(data.data() + index, index);
+  }
+#endif
+  return leb128::readSlow<T>(data, index);
+}
+
+inline uint32_t readULEB128(const ByteSpan &data, size_t &index) {
+  return readLEB128<uint32_t>(data, index);
+}
+
+inline uint64_t readULEB128_64(const ByteSpan &data, size_t &index) {
+  return readLEB128<uint64_t>(data, index);
+}
+
+inline int32_t readSLEB128(const ByteSpan &data, size_t &index) {
+  return readLEB128<int32_t>(data, index);
+}
+
+inline int64_t readSLEB128_64(const ByteSpan &data, size_t &index) {
+  return readLEB128<int64_t>(data, index);
+}
+
+#endif
@@ -0,0 +1,72 @@
+#include <cstddef>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "LinearMemory.hpp"
+
+// the last bytes of the page in front of base
+struct LinearMemory::Header {
+  LinearMemory *memory;
+  GrowFunction grow;
+  uint64_t pages;
+};
+
+namespace {
+// target of the grow function pointer in the header, the header leads from the base back to the memory
+uint32_t growMemory(uint8_t *const base, uint32_t const delta) {
+  void *const header = base - sizeof(LinearMemory::Header);
+  return static_cast<LinearMemory::Header *>(header)->memory->grow(delta);
+}
+} // namespace
+
+static_assert(sizeof(LinearMemory::Header) == LinearMemory::headerSize, "compiled code addresses the header fields relative to the base");
+static_assert(sizeof(LinearMemory::Header) - offsetof(LinearMemory::Header, pages) == static_cast<size_t>(-LinearMemory::pagesOffset),
+              "pages has to be the last header field");
+static_assert(sizeof(LinearMemory::Header) - offsetof(LinearMemory::Header, grow) == static_cast<size_t>(-LinearMemory::growFunctionOffset),
+              "grow has to precede pages");
+
+LinearMemory::LinearMemory(uint32_t const initialPages, uint32_t const maximumPages) : maximumPages_(maximumPages) {
+  size_t const hostPageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  mappedSize_ = hostPageSize + reservationSize;
+  // nothing is committed for the reservation, only the header page and the pages in use ever get backing memory
+  void *const mapping = mmap(nullptr, mappedSize_, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+  if (mapping == MAP_FAILED) {
+    throw std::runtime_error("Failed to reserve linear memory.");
+  }
+  mapping_ = static_cast<uint8_t *>(mapping);
+  base_ = mapping_ + hostPageSize;
+  if (mprotect(mapping_, hostPageSize, PROT_READ | PROT_WRITE) != 0) {
+    munmap(mapping_, mappedSize_);
+    throw std::runtime_error("Failed to protect the linear memory header.");
+  }
+  void *const header = base_ - sizeof(Header);
+  *static_cast<Header *>(header) = Header{this, &growMemory, 0U};
+  if (grow(initialPages) == UINT32_MAX) {
+    munmap(mapping_, mappedSize_);
+    throw std::runtime_error("Failed to make the initial linear memory accessible.");
+  }
+}
+
+LinearMemory::~LinearMemory() {
+  munmap(mapping_, mappedSize_);
+}
+
+bool LinearMemory::reserves(uintptr_t const address) const {
+  uintptr_t const begin = reinterpret_cast<uintptr_t>(base_);
+  return (address >= begin) && (address - begin < reservationSize);
+}
+
+uint32_t LinearMemory::grow(uint32_t const delta) {
+  uint32_t const previous = pages_;
+  if (delta > maximumPages_ - pages_) {
+    return UINT32_MAX;
+  }
+  if ((delta != 0U) && (mprotect(base_ + size(), static_cast<size_t>(delta) * pageSize, PROT_READ | PROT_WRITE) != 0)) {
+    return UINT32_MAX;
+  }
+  pages_ += delta;
+  void *const header = base_ - sizeof(Header);
+  static_cast<Header *>(header)->pages = pages_;
+  return previous;
+}
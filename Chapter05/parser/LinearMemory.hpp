@@ -0,0 +1,77 @@
+#ifndef LINEARMEMORY_HPP
+#define LINEARMEMORY_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+///
+/// @brief The linear memory of a module instance.
+/// The whole range a 32 bit index plus a 32 bit offset can reach is reserved up front without access rights, only the pages
+/// of the current size are readable and writable. Compiled code therefore accesses memory without any bounds check, an out of
+/// bounds access faults on the reservation and the runtime turns the fault into a trap. The memory never moves, so the base
+/// can stay in a register for the whole invocation. A small header in front of the base holds what compiled code needs for
+/// memory.size and memory.grow.
+///
+class LinearMemory final {
+public:
+  static constexpr size_t pageSize = 65536U;
+
+  // any uint32 index plus uint32 offset plus access size (at most 8) lands inside, the tail is a guard region
+  static constexpr size_t reservationSize = (static_cast<size_t>(1U) << 33U) + pageSize;
+
+  // header fields relative to base(): the current size in pages (uint64_t) and the grow function, the first field of the
+  // header belongs to the host (the LinearMemory in the runtime), compiled code never reads it
+  static constexpr size_t headerSize = 24U;
+  static constexpr int32_t pagesOffset = -8;
+  static constexpr int32_t growFunctionOffset = -16;
+
+  // trap code of an access of compiled code to the reserved but inaccessible range
+  static constexpr uint32_t outOfBoundsTrapCode = 3U;
+
+  ///
+  /// @brief Called by memory.grow with the memory base in X0 and the delta in W1
+  /// @return The previous size in pages, UINT32_MAX if the memory can not grow by delta pages
+  using GrowFunction = uint32_t (*)(uint8_t *base, uint32_t delta);
+
+  ///
+  /// @brief Reserve the address range and make the initial pages accessible, they are zero
+  /// @throws std::runtime_error if the range can not be reserved or protected
+  LinearMemory(uint32_t initialPages, uint32_t maximumPages);
+  LinearMemory(const LinearMemory &) = delete;
+  LinearMemory &operator=(const LinearMemory &) = delete;
+  ~LinearMemory();
+
+  uint8_t *base() const {
+    return base_;
+  }
+
+  uint32_t pages() const {
+    return pages_;
+  }
+
+  size_t size() const {
+    return static_cast<size_t>(pages_) * pageSize;
+  }
+
+  ///
+  /// @brief true if address is inside the reserved range (accessible or not)
+  bool reserves(uintptr_t address) const;
+
+  ///
+  /// @brief Grow by delta pages, the new pages are zero
+  /// @return The previous size in pages, UINT32_MAX if the maximum would be exceeded (the memory is unchanged then)
+  uint32_t grow(uint32_t delta);
+
+  ///
+  /// @brief Layout of the header, it ends right at the base
+  struct Header;
+
+private:
+  uint8_t *mapping_ = nullptr;
+  size_t mappedSize_ = 0U;
+  uint8_t *base_ = nullptr;
+  uint32_t pages_ = 0U;
+  uint32_t maximumPages_ = 0U;
+};
+
+#endif
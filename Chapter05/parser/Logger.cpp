@@ -0,0 +1,45 @@
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+
+#include "Logger.hpp"
+
+namespace {
+// WASM_LOG_LEVEL=0..3 in the environment overrides the default without recompiling
+uint8_t initialLevel() {
+  char const *const env = std::getenv("WASM_LOG_LEVEL");
+  if ((env != nullptr) && (env[0] >= '0') && (env[0] <= '3') && (env[1] == '\0')) {
+    return static_cast<uint8_t>(env[0] - '0');
+  }
+  return static_cast<uint8_t>(LogLevel::ERROR);
+}
+} // namespace
+
+std::atomic<uint8_t> &Logger::currentLevel() {
+  static std::atomic<uint8_t> level{initialLevel()};
+  return level;
+}
+
+void Logger::write(LogLevel const level, const std::string &message) {
+  static std::mutex writeMutex;
+  char const *prefix = "";
+  switch (level) {
+  case LogLevel::ERROR: {
+    prefix = "[error] ";
+    break;
+  }
+  case LogLevel::INFO: {
+    prefix = "[info] ";
+    break;
+  }
+  case LogLevel::TRACE: {
+    prefix = "[trace] ";
+    break;
+  }
+  default: {
+    break;
+  }
+  }
+  std::lock_guard<std::mutex> const lock(writeMutex);
+  std::cerr << prefix << message << '\n';
+}
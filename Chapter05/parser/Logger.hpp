@@ -0,0 +1,61 @@
+#ifndef LOGGER_HPP
+#define LOGGER_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <sstream>
+#include <string>
+
+///
+/// @brief Verbosity of the compiler diagnostics, every level includes the ones before it
+///
+enum class LogLevel : uint8_t { OFF = 0, ERROR = 1, INFO = 2, TRACE = 3 };
+
+///
+/// @brief Highest level that is compiled in at all. Messages above it are removed by the compiler, including the evaluation of
+/// their arguments. Override with e.g. -DWASM_MAX_LOG_LEVEL=1 to keep only errors in the binary.
+///
+#ifndef WASM_MAX_LOG_LEVEL
+#define WASM_MAX_LOG_LEVEL 3
+#endif
+
+class Logger final {
+public:
+  ///
+  /// @brief Set the runtime level. Defaults to ERROR (or WASM_LOG_LEVEL from the environment), so a successful run does not print anything.
+  static void setLevel(LogLevel const level) {
+    currentLevel().store(static_cast<uint8_t>(level), std::memory_order_relaxed);
+  }
+
+  static LogLevel getLevel() {
+    return static_cast<LogLevel>(currentLevel().load(std::memory_order_relaxed));
+  }
+
+  static inline bool isEnabled(LogLevel const level) {
+    return (static_cast<uint8_t>(level) <= WASM_MAX_LOG_LEVEL) && (static_cast<uint8_t>(level) <= currentLevel().load(std::memory_order_relaxed));
+  }
+
+  ///
+  /// @brief Write one complete message line to stderr
+  static void write(LogLevel level, const std::string &message);
+
+private:
+  static std::atomic<uint8_t> &currentLevel();
+};
+
+// NOLINTBEGIN(bugprone-macro-parentheses)
+#define WASM_LOG(level, message)                                                                                                                     \
+  do {                                                                                                                                               \
+    if (Logger::isEnabled(level)) {                                                                                                                  \
+      std::ostringstream wasmLogStream_;                                                                                                             \
+      wasmLogStream_ << message;                                                                                                                     \
+      Logger::write(level, wasmLogStream_.str());                                                                                                    \
+    }                                                                                                                                                \
+  } while (false)
+// NOLINTEND(bugprone-macro-parentheses)
+
+#define LOG_ERROR(message) WASM_LOG(LogLevel::ERROR, message)
+#define LOG_INFO(message) WASM_LOG(LogLevel::INFO, message)
+#define LOG_TRACE(message) WASM_LOG(LogLevel::TRACE, message)
+
+#endif
@@ -0,0 +1,45 @@
+#include <fcntl.h>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "MappedFile.hpp"
+
+MappedFile::MappedFile(uint8_t const *data, size_t size) : data_(data), size_(size) {
+}
+
+MappedFile::~MappedFile() {
+  if (data_ != nullptr) {
+    munmap(const_cast<uint8_t *>(data_), size_);
+  }
+}
+
+std::shared_ptr<MappedFile> MappedFile::open(const std::string &filePath) {
+  int const fd = ::open(filePath.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    throw std::runtime_error("Failed to open file: " + filePath);
+  }
+
+  struct stat fileStat {};
+  if (fstat(fd, &fileStat) != 0) {
+    close(fd);
+    throw std::runtime_error("Failed to stat file: " + filePath);
+  }
+
+  size_t const size = static_cast<size_t>(fileStat.st_size);
+  if (size == 0U) { // mmap does not accept zero length mappings
+    close(fd);
+    return std::shared_ptr<MappedFile>(new MappedFile(nullptr, 0U));
+  }
+
+  void *const mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd); // the mapping keeps its own reference to the file
+  if (mapping == MAP_FAILED) {
+    throw std::runtime_error("Failed to map file: " + filePath);
+  }
+  // sections are parsed front to back exactly once
+  static_cast<void>(madvise(mapping, size, MADV_SEQUENTIAL));
+
+  return std::shared_ptr<MappedFile>(new MappedFile(static_cast<uint8_t const *>(mapping), size));
+}
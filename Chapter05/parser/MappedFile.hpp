@@ -0,0 +1,36 @@
+#ifndef MAPPEDFILE_HPP
+#define MAPPEDFILE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "ByteSpan.hpp"
+
+///
+/// @brief Read-only memory mapping of a whole file. The mapping is released when the last owner goes away.
+///
+class MappedFile final {
+public:
+  ///
+  /// @brief Map the file at filePath read-only into memory
+  /// @throws std::runtime_error if the file can not be opened or mapped
+  static std::shared_ptr<MappedFile> open(const std::string &filePath);
+
+  MappedFile(const MappedFile &) = delete;
+  MappedFile &operator=(const MappedFile &) = delete;
+  ~MappedFile();
+
+  ByteSpan bytes() const {
+    return ByteSpan{data_, size_};
+  }
+
+private:
+  MappedFile(uint8_t const *data, size_t size);
+
+  uint8_t const *data_;
+  size_t size_;
+};
+
+#endif
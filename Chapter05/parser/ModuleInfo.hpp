@@ -4,12 +4,14 @@
 #include <cassert>
 #include <cstdint>
 #include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
+#include "ByteSpan.hpp"
 #include "aarch64_common.hpp"
 
-enum class SignatureType : uint8_t { I32 = 'i', I64 = 'I', F32 = 'f', F64 = 'F', PARAMSTART = '(', PARAMEND = ')' };
+enum class SignatureType : uint8_t { I32 = 'i', I64 = 'I', F32 = 'f', F64 = 'F', V128 = 'v', PARAMSTART = '(', PARAMEND = ')' };
 
 enum class WasmType : uint8_t {
   EXTERN_REF = 0x6F,
@@ -23,6 +25,12 @@ enum class WasmType : uint8_t {
   INVALID = 0x00
 };
 
+class CodeArena;
+
+///
+/// @brief AArch64 machine code of one function, one element per 32 bit instruction in host (little endian) byte order
+using MachineCode = std::vector<uint32_t>;
+
 enum class StorageType : uint8_t { STACKMEMORY, LINKDATA, REGISTER, CONSTANT, INVALID };
 
 class ModuleInfo final {
@@ -38,7 +46,12 @@ public:
     uint32_t numLocalsInFPR = 0U;
     uint32_t paramWidth = 0U;
     uint32_t directLocalsWidth = 0U;
-    uint32_t stackFrameSize = 0U;
+    uint32_t stackFrameSize = 0U;             ///< bytes of spill slots below SP, a multiple of 16
+    uint32_t numSpilledLocals = 0U;           ///< params and locals the register allocator placed in the stack frame
+    std::vector<uint64_t> callSaveMasks = {}; ///< per CALL and memory.grow of the body in order: registers of locals live across it (bit n =
+                                              ///< TReg n, F registers from bit 32)
+
+    bool usesVectorRegisters = false; ///< a param or local is a v128, calls then save the whole 128 bit V registers
 
     bool unreachable = false;
     bool properlyTerminated = false;
@@ -51,6 +64,7 @@ public:
 
     TReg reg{};                       ///<  CPU register this variable is stored in (Index defined by the backend, if type is REGISTER)
     uint32_t stackFramePosition = 0U; ///< Offset in the current stack frame (if type is STACKMEMORY)
+    bool zeroOnEntry = true;          ///< set to zero by the prologue, false if the implicit zero can never be read (or for params)
   };
 
   class FuncParm final {
@@ -62,10 +76,57 @@ public:
     uint32_t stackFramePosition = 0U; ///< Offset in the current stack frame (if type is STACKMEMORY)
   };
 
-  WasmType getReturnTypeForSignature(uint32_t const sigIndex) {
-    auto funcSignature = signatureTypes[sigIndex];
-    auto lastChar = funcSignature.back();
-    return (lastChar == static_cast<char>(SignatureType::PARAMEND)) ? WasmType::TVOID : static_cast<WasmType>(lastChar);
+  ///
+  /// @brief A BL in the machine code of a function, its offset is patched in once the code arena placed the callee
+  class CallSite final {
+  public:
+    uint32_t instructionIndex = 0U;
+    uint32_t callee = 0U;
+  };
+
+  ///
+  /// @brief A BRK of a trap check in the machine code of a function, the runtime maps the faulting PC back to the trap code
+  class TrapSite final {
+  public:
+    uint32_t instructionIndex = 0U;
+    uint32_t trapCode = 0U;
+  };
+
+  ///
+  /// @brief An active data segment, copied into the linear memory when the module is instantiated
+  class DataSegment final {
+  public:
+    uint32_t offset = 0U;       ///< byte offset in the linear memory, from the i32.const offset expression
+    std::vector<uint8_t> bytes; ///< copied, a streamed section does not outlive the parser buffer
+  };
+
+  WasmType getReturnTypeForSignature(uint32_t const sigIndex) const {
+    const std::string &funcSignature = signatureTypes[sigIndex];
+    switch (static_cast<SignatureType>(funcSignature.back())) {
+    case SignatureType::I32: {
+      return WasmType::I32;
+    }
+    case SignatureType::I64: {
+      return WasmType::I64;
+    }
+    case SignatureType::F32: {
+      return WasmType::F32;
+    }
+    case SignatureType::F64: {
+      return WasmType::F64;
+    }
+    case SignatureType::V128: {
+      return WasmType::VEC_TYPE;
+    }
+    default: {
+      return WasmType::TVOID;
+    }
+    }
+  }
+
+  uint32_t getNumParamsForSignature(uint32_t const sigIndex) const {
+    const std::string &funcSignature = signatureTypes[sigIndex];
+    return static_cast<uint32_t>(funcSignature.find(static_cast<char>(SignatureType::PARAMEND)) - 1U);
   }
 
   size_t functionNums = 0;
@@ -73,11 +134,30 @@ public:
   // every index is func
   std::vector<std::vector<LocalVar>> functionsLocalVars;
   std::vector<std::vector<FuncParm>> functionsParams;
-  std::vector<std::vector<uint8_t>> functionsInstructions;
+  std::vector<ByteSpan> functionsInstructions; ///< views into byteStreamOwner, function bodies are never copied
   std::vector<FunctionInfo> functionInfos;
   // every index is func end
 
-  std::vector<std::vector<uint8_t>> machineCodes;
+  std::vector<MachineCode> machineCodes;
+  std::vector<std::vector<CallSite>> callSites; ///< per function like machineCodes, the calls it makes
+  std::vector<std::vector<TrapSite>> trapSites; ///< per function like machineCodes, its trap instructions in ascending order
+  // all machineCodes laid out in one executable region, created once compilation finished
+  std::shared_ptr<CodeArena> codeArena;
+
+  // the linear memory (at most one), sizes in 64 KiB pages
+  bool hasMemory = false;
+  uint32_t memoryInitialPages = 0U;
+  uint32_t memoryMaximumPages = 65536U; ///< declared maximum, else all of the 32 bit address space
+  std::vector<DataSegment> dataSegments;
+
+  // keeps the (memory mapped) wasm byte stream that functionsInstructions points into alive
+  std::shared_ptr<void const> byteStreamOwner;
+
+  // fold constants into instruction immediates and load the rest with the shortest sequence, only turned off to measure it
+  bool immediateSelection = true;
+
+  // divide by constants with multiply-high and shifts instead of UDIV/SDIV and trap checks, only turned off to measure it
+  bool constantDivision = true;
 
   // 函数名称到函数索引
   std::map<size_t, std::string> functionsIndexName;
@@ -17,6 +17,7 @@ enum class OPCode : uint16_t {
   SCALAR_EXTEND_OP_CODE = 0xFC,
   SCALAR_EXTEND_OP_CODE_PREFIX = SCALAR_EXTEND_OP_CODE << 8U,
   VECTOR_EXTEND_OP_CODE = 0xFD,
+  VECTOR_EXTEND_OP_CODE_PREFIX = VECTOR_EXTEND_OP_CODE << 8U,
 
   // CONTROL FLOW OPERATORS
   UNREACHABLE = 0x00,
@@ -257,6 +258,244 @@ enum class OPCode : uint16_t {
   I64_TRUNC_SAT_F32_U = SCALAR_EXTEND_OP_CODE_PREFIX | 5U,
   I64_TRUNC_SAT_F64_S = SCALAR_EXTEND_OP_CODE_PREFIX | 6U,
   I64_TRUNC_SAT_F64_U = SCALAR_EXTEND_OP_CODE_PREFIX | 7U,
+
+  // SIMD, the sub opcode after VECTOR_EXTEND_OP_CODE is a LEB128 in the binary
+  V128_LOAD = VECTOR_EXTEND_OP_CODE_PREFIX | 0x00U,
+  V128_LOAD8X8_S = VECTOR_EXTEND_OP_CODE_PREFIX | 0x01U,
+  V128_LOAD8X8_U = VECTOR_EXTEND_OP_CODE_PREFIX | 0x02U,
+  V128_LOAD16X4_S = VECTOR_EXTEND_OP_CODE_PREFIX | 0x03U,
+  V128_LOAD16X4_U = VECTOR_EXTEND_OP_CODE_PREFIX | 0x04U,
+  V128_LOAD32X2_S = VECTOR_EXTEND_OP_CODE_PREFIX | 0x05U,
+  V128_LOAD32X2_U = VECTOR_EXTEND_OP_CODE_PREFIX | 0x06U,
+  V128_LOAD8_SPLAT = VECTOR_EXTEND_OP_CODE_PREFIX | 0x07U,
+  V128_LOAD16_SPLAT = VECTOR_EXTEND_OP_CODE_PREFIX | 0x08U,
+  V128_LOAD32_SPLAT = VECTOR_EXTEND_OP_CODE_PREFIX | 0x09U,
+  V128_LOAD64_SPLAT = VECTOR_EXTEND_OP_CODE_PREFIX | 0x0AU,
+  V128_STORE = VECTOR_EXTEND_OP_CODE_PREFIX | 0x0BU,
+  V128_CONST = VECTOR_EXTEND_OP_CODE_PREFIX | 0x0CU,
+  I8X16_SHUFFLE = VECTOR_EXTEND_OP_CODE_PREFIX | 0x0DU,
+  I8X16_SWIZZLE = VECTOR_EXTEND_OP_CODE_PREFIX | 0x0EU,
+  I8X16_SPLAT = VECTOR_EXTEND_OP_CODE_PREFIX | 0x0FU,
+  I16X8_SPLAT = VECTOR_EXTEND_OP_CODE_PREFIX | 0x10U,
+  I32X4_SPLAT = VECTOR_EXTEND_OP_CODE_PREFIX | 0x11U,
+  I64X2_SPLAT = VECTOR_EXTEND_OP_CODE_PREFIX | 0x12U,
+  F32X4_SPLAT = VECTOR_EXTEND_OP_CODE_PREFIX | 0x13U,
+  F64X2_SPLAT = VECTOR_EXTEND_OP_CODE_PREFIX | 0x14U,
+  I8X16_EXTRACT_LANE_S = VECTOR_EXTEND_OP_CODE_PREFIX | 0x15U,
+  I8X16_EXTRACT_LANE_U = VECTOR_EXTEND_OP_CODE_PREFIX | 0x16U,
+  I8X16_REPLACE_LANE = VECTOR_EXTEND_OP_CODE_PREFIX | 0x17U,
+  I16X8_EXTRACT_LANE_S = VECTOR_EXTEND_OP_CODE_PREFIX | 0x18U,
+  I16X8_EXTRACT_LANE_U = VECTOR_EXTEND_OP_CODE_PREFIX | 0x19U,
+  I16X8_REPLACE_LANE = VECTOR_EXTEND_OP_CODE_PREFIX | 0x1AU,
+  I32X4_EXTRACT_LANE = VECTOR_EXTEND_OP_CODE_PREFIX | 0x1BU,
+  I32X4_REPLACE_LANE = VECTOR_EXTEND_OP_CODE_PREFIX | 0x1CU,
+  I64X2_EXTRACT_LANE = VECTOR_EXTEND_OP_CODE_PREFIX | 0x1DU,
+  I64X2_REPLACE_LANE = VECTOR_EXTEND_OP_CODE_PREFIX | 0x1EU,
+  F32X4_EXTRACT_LANE = VECTOR_EXTEND_OP_CODE_PREFIX | 0x1FU,
+  F32X4_REPLACE_LANE = VECTOR_EXTEND_OP_CODE_PREFIX | 0x20U,
+  F64X2_EXTRACT_LANE = VECTOR_EXTEND_OP_CODE_PREFIX | 0x21U,
+  F64X2_REPLACE_LANE = VECTOR_EXTEND_OP_CODE_PREFIX | 0x22U,
+  I8X16_EQ = VECTOR_EXTEND_OP_CODE_PREFIX | 0x23U,
+  I8X16_NE = VECTOR_EXTEND_OP_CODE_PREFIX | 0x24U,
+  I8X16_LT_S = VECTOR_EXTEND_OP_CODE_PREFIX | 0x25U,
+  I8X16_LT_U = VECTOR_EXTEND_OP_CODE_PREFIX | 0x26U,
+  I8X16_GT_S = VECTOR_EXTEND_OP_CODE_PREFIX | 0x27U,
+  I8X16_GT_U = VECTOR_EXTEND_OP_CODE_PREFIX | 0x28U,
+  I8X16_LE_S = VECTOR_EXTEND_OP_CODE_PREFIX | 0x29U,
+  I8X16_LE_U = VECTOR_EXTEND_OP_CODE_PREFIX | 0x2AU,
+  I8X16_GE_S = VECTOR_EXTEND_OP_CODE_PREFIX | 0x2BU,
+  I8X16_GE_U = VECTOR_EXTEND_OP_CODE_PREFIX | 0x2CU,
+  I16X8_EQ = VECTOR_EXTEND_OP_CODE_PREFIX | 0x2DU,
+  I16X8_NE = VECTOR_EXTEND_OP_CODE_PREFIX | 0x2EU,
+  I16X8_LT_S = VECTOR_EXTEND_OP_CODE_PREFIX | 0x2FU,
+  I16X8_LT_U = VECTOR_EXTEND_OP_CODE_PREFIX | 0x30U,
+  I16X8_GT_S = VECTOR_EXTEND_OP_CODE_PREFIX | 0x31U,
+  I16X8_GT_U = VECTOR_EXTEND_OP_CODE_PREFIX | 0x32U,
+  I16X8_LE_S = VECTOR_EXTEND_OP_CODE_PREFIX | 0x33U,
+  I16X8_LE_U = VECTOR_EXTEND_OP_CODE_PREFIX | 0x34U,
+  I16X8_GE_S = VECTOR_EXTEND_OP_CODE_PREFIX | 0x35U,
+  I16X8_GE_U = VECTOR_EXTEND_OP_CODE_PREFIX | 0x36U,
+  I32X4_EQ = VECTOR_EXTEND_OP_CODE_PREFIX | 0x37U,
+  I32X4_NE = VECTOR_EXTEND_OP_CODE_PREFIX | 0x38U,
+  I32X4_LT_S = VECTOR_EXTEND_OP_CODE_PREFIX | 0x39U,
+  I32X4_LT_U = VECTOR_EXTEND_OP_CODE_PREFIX | 0x3AU,
+  I32X4_GT_S = VECTOR_EXTEND_OP_CODE_PREFIX | 0x3BU,
+  I32X4_GT_U = VECTOR_EXTEND_OP_CODE_PREFIX | 0x3CU,
+  I32X4_LE_S = VECTOR_EXTEND_OP_CODE_PREFIX | 0x3DU,
+  I32X4_LE_U = VECTOR_EXTEND_OP_CODE_PREFIX | 0x3EU,
+  I32X4_GE_S = VECTOR_EXTEND_OP_CODE_PREFIX | 0x3FU,
+  I32X4_GE_U = VECTOR_EXTEND_OP_CODE_PREFIX | 0x40U,
+  F32X4_EQ = VECTOR_EXTEND_OP_CODE_PREFIX | 0x41U,
+  F32X4_NE = VECTOR_EXTEND_OP_CODE_PREFIX | 0x42U,
+  F32X4_LT = VECTOR_EXTEND_OP_CODE_PREFIX | 0x43U,
+  F32X4_GT = VECTOR_EXTEND_OP_CODE_PREFIX | 0x44U,
+  F32X4_LE = VECTOR_EXTEND_OP_CODE_PREFIX | 0x45U,
+  F32X4_GE = VECTOR_EXTEND_OP_CODE_PREFIX | 0x46U,
+  F64X2_EQ = VECTOR_EXTEND_OP_CODE_PREFIX | 0x47U,
+  F64X2_NE = VECTOR_EXTEND_OP_CODE_PREFIX | 0x48U,
+  F64X2_LT = VECTOR_EXTEND_OP_CODE_PREFIX | 0x49U,
+  F64X2_GT = VECTOR_EXTEND_OP_CODE_PREFIX | 0x4AU,
+  F64X2_LE = VECTOR_EXTEND_OP_CODE_PREFIX | 0x4BU,
+  F64X2_GE = VECTOR_EXTEND_OP_CODE_PREFIX | 0x4CU,
+  V128_NOT = VECTOR_EXTEND_OP_CODE_PREFIX | 0x4DU,
+  V128_AND = VECTOR_EXTEND_OP_CODE_PREFIX | 0x4EU,
+  V128_ANDNOT = VECTOR_EXTEND_OP_CODE_PREFIX | 0x4FU,
+  V128_OR = VECTOR_EXTEND_OP_CODE_PREFIX | 0x50U,
+  V128_XOR = VECTOR_EXTEND_OP_CODE_PREFIX | 0x51U,
+  V128_BITSELECT = VECTOR_EXTEND_OP_CODE_PREFIX | 0x52U,
+  V128_ANY_TRUE = VECTOR_EXTEND_OP_CODE_PREFIX | 0x53U,
+  V128_LOAD8_LANE = VECTOR_EXTEND_OP_CODE_PREFIX | 0x54U,
+  V128_LOAD16_LANE = VECTOR_EXTEND_OP_CODE_PREFIX | 0x55U,
+  V128_LOAD32_LANE = VECTOR_EXTEND_OP_CODE_PREFIX | 0x56U,
+  V128_LOAD64_LANE = VECTOR_EXTEND_OP_CODE_PREFIX | 0x57U,
+  V128_STORE8_LANE = VECTOR_EXTEND_OP_CODE_PREFIX | 0x58U,
+  V128_STORE16_LANE = VECTOR_EXTEND_OP_CODE_PREFIX | 0x59U,
+  V128_STORE32_LANE = VECTOR_EXTEND_OP_CODE_PREFIX | 0x5AU,
+  V128_STORE64_LANE = VECTOR_EXTEND_OP_CODE_PREFIX | 0x5BU,
+  V128_LOAD32_ZERO = VECTOR_EXTEND_OP_CODE_PREFIX | 0x5CU,
+  V128_LOAD64_ZERO = VECTOR_EXTEND_OP_CODE_PREFIX | 0x5DU,
+  F32X4_DEMOTE_F64X2_ZERO = VECTOR_EXTEND_OP_CODE_PREFIX | 0x5EU,
+  F64X2_PROMOTE_LOW_F32X4 = VECTOR_EXTEND_OP_CODE_PREFIX | 0x5FU,
+  I8X16_ABS = VECTOR_EXTEND_OP_CODE_PREFIX | 0x60U,
+  I8X16_NEG = VECTOR_EXTEND_OP_CODE_PREFIX | 0x61U,
+  I8X16_POPCNT = VECTOR_EXTEND_OP_CODE_PREFIX | 0x62U,
+  I8X16_ALL_TRUE = VECTOR_EXTEND_OP_CODE_PREFIX | 0x63U,
+  I8X16_BITMASK = VECTOR_EXTEND_OP_CODE_PREFIX | 0x64U,
+  I8X16_NARROW_I16X8_S = VECTOR_EXTEND_OP_CODE_PREFIX | 0x65U,
+  I8X16_NARROW_I16X8_U = VECTOR_EXTEND_OP_CODE_PREFIX | 0x66U,
+  F32X4_CEIL = VECTOR_EXTEND_OP_CODE_PREFIX | 0x67U,
+  F32X4_FLOOR = VECTOR_EXTEND_OP_CODE_PREFIX | 0x68U,
+  F32X4_TRUNC = VECTOR_EXTEND_OP_CODE_PREFIX | 0x69U,
+  F32X4_NEAREST = VECTOR_EXTEND_OP_CODE_PREFIX | 0x6AU,
+  I8X16_SHL = VECTOR_EXTEND_OP_CODE_PREFIX | 0x6BU,
+  I8X16_SHR_S = VECTOR_EXTEND_OP_CODE_PREFIX | 0x6CU,
+  I8X16_SHR_U = VECTOR_EXTEND_OP_CODE_PREFIX | 0x6DU,
+  I8X16_ADD = VECTOR_EXTEND_OP_CODE_PREFIX | 0x6EU,
+  I8X16_ADD_SAT_S = VECTOR_EXTEND_OP_CODE_PREFIX | 0x6FU,
+  I8X16_ADD_SAT_U = VECTOR_EXTEND_OP_CODE_PREFIX | 0x70U,
+  I8X16_SUB = VECTOR_EXTEND_OP_CODE_PREFIX | 0x71U,
+  I8X16_SUB_SAT_S = VECTOR_EXTEND_OP_CODE_PREFIX | 0x72U,
+  I8X16_SUB_SAT_U = VECTOR_EXTEND_OP_CODE_PREFIX | 0x73U,
+  F64X2_CEIL = VECTOR_EXTEND_OP_CODE_PREFIX | 0x74U,
+  F64X2_FLOOR = VECTOR_EXTEND_OP_CODE_PREFIX | 0x75U,
+  I8X16_MIN_S = VECTOR_EXTEND_OP_CODE_PREFIX | 0x76U,
+  I8X16_MIN_U = VECTOR_EXTEND_OP_CODE_PREFIX | 0x77U,
+  I8X16_MAX_S = VECTOR_EXTEND_OP_CODE_PREFIX | 0x78U,
+  I8X16_MAX_U = VECTOR_EXTEND_OP_CODE_PREFIX | 0x79U,
+  F64X2_TRUNC = VECTOR_EXTEND_OP_CODE_PREFIX | 0x7AU,
+  I8X16_AVGR_U = VECTOR_EXTEND_OP_CODE_PREFIX | 0x7BU,
+  I16X8_EXTADD_PAIRWISE_I8X16_S = VECTOR_EXTEND_OP_CODE_PREFIX | 0x7CU,
+  I16X8_EXTADD_PAIRWISE_I8X16_U = VECTOR_EXTEND_OP_CODE_PREFIX | 0x7DU,
+  I32X4_EXTADD_PAIRWISE_I16X8_S = VECTOR_EXTEND_OP_CODE_PREFIX | 0x7EU,
+  I32X4_EXTADD_PAIRWISE_I16X8_U = VECTOR_EXTEND_OP_CODE_PREFIX | 0x7FU,
+  I16X8_ABS = VECTOR_EXTEND_OP_CODE_PREFIX | 0x80U,
+  I16X8_NEG = VECTOR_EXTEND_OP_CODE_PREFIX | 0x81U,
+  I16X8_Q15MULR_SAT_S = VECTOR_EXTEND_OP_CODE_PREFIX | 0x82U,
+  I16X8_ALL_TRUE = VECTOR_EXTEND_OP_CODE_PREFIX | 0x83U,
+  I16X8_BITMASK = VECTOR_EXTEND_OP_CODE_PREFIX | 0x84U,
+  I16X8_NARROW_I32X4_S = VECTOR_EXTEND_OP_CODE_PREFIX | 0x85U,
+  I16X8_NARROW_I32X4_U = VECTOR_EXTEND_OP_CODE_PREFIX | 0x86U,
+  I16X8_EXTEND_LOW_I8X16_S = VECTOR_EXTEND_OP_CODE_PREFIX | 0x87U,
+  I16X8_EXTEND_HIGH_I8X16_S = VECTOR_EXTEND_OP_CODE_PREFIX | 0x88U,
+  I16X8_EXTEND_LOW_I8X16_U = VECTOR_EXTEND_OP_CODE_PREFIX | 0x89U,
+  I16X8_EXTEND_HIGH_I8X16_U = VECTOR_EXTEND_OP_CODE_PREFIX | 0x8AU,
+  I16X8_SHL = VECTOR_EXTEND_OP_CODE_PREFIX | 0x8BU,
+  I16X8_SHR_S = VECTOR_EXTEND_OP_CODE_PREFIX | 0x8CU,
+  I16X8_SHR_U = VECTOR_EXTEND_OP_CODE_PREFIX | 0x8DU,
+  I16X8_ADD = VECTOR_EXTEND_OP_CODE_PREFIX | 0x8EU,
+  I16X8_ADD_SAT_S = VECTOR_EXTEND_OP_CODE_PREFIX | 0x8FU,
+  I16X8_ADD_SAT_U = VECTOR_EXTEND_OP_CODE_PREFIX | 0x90U,
+  I16X8_SUB = VECTOR_EXTEND_OP_CODE_PREFIX | 0x91U,
+  I16X8_SUB_SAT_S = VECTOR_EXTEND_OP_CODE_PREFIX | 0x92U,
+  I16X8_SUB_SAT_U = VECTOR_EXTEND_OP_CODE_PREFIX | 0x93U,
+  F64X2_NEAREST = VECTOR_EXTEND_OP_CODE_PREFIX | 0x94U,
+  I16X8_MUL = VECTOR_EXTEND_OP_CODE_PREFIX | 0x95U,
+  I16X8_MIN_S = VECTOR_EXTEND_OP_CODE_PREFIX | 0x96U,
+  I16X8_MIN_U = VECTOR_EXTEND_OP_CODE_PREFIX | 0x97U,
+  I16X8_MAX_S = VECTOR_EXTEND_OP_CODE_PREFIX | 0x98U,
+  I16X8_MAX_U = VECTOR_EXTEND_OP_CODE_PREFIX | 0x99U,
+  I16X8_AVGR_U = VECTOR_EXTEND_OP_CODE_PREFIX | 0x9BU,
+  I16X8_EXTMUL_LOW_I8X16_S = VECTOR_EXTEND_OP_CODE_PREFIX | 0x9CU,
+  I16X8_EXTMUL_HIGH_I8X16_S = VECTOR_EXTEND_OP_CODE_PREFIX | 0x9DU,
+  I16X8_EXTMUL_LOW_I8X16_U = VECTOR_EXTEND_OP_CODE_PREFIX | 0x9EU,
+  I16X8_EXTMUL_HIGH_I8X16_U = VECTOR_EXTEND_OP_CODE_PREFIX | 0x9FU,
+  I32X4_ABS = VECTOR_EXTEND_OP_CODE_PREFIX | 0xA0U,
+  I32X4_NEG = VECTOR_EXTEND_OP_CODE_PREFIX | 0xA1U,
+  I32X4_ALL_TRUE = VECTOR_EXTEND_OP_CODE_PREFIX | 0xA3U,
+  I32X4_BITMASK = VECTOR_EXTEND_OP_CODE_PREFIX | 0xA4U,
+  I32X4_EXTEND_LOW_I16X8_S = VECTOR_EXTEND_OP_CODE_PREFIX | 0xA7U,
+  I32X4_EXTEND_HIGH_I16X8_S = VECTOR_EXTEND_OP_CODE_PREFIX | 0xA8U,
+  I32X4_EXTEND_LOW_I16X8_U = VECTOR_EXTEND_OP_CODE_PREFIX | 0xA9U,
+  I32X4_EXTEND_HIGH_I16X8_U = VECTOR_EXTEND_OP_CODE_PREFIX | 0xAAU,
+  I32X4_SHL = VECTOR_EXTEND_OP_CODE_PREFIX | 0xABU,
+  I32X4_SHR_S = VECTOR_EXTEND_OP_CODE_PREFIX | 0xACU,
+  I32X4_SHR_U = VECTOR_EXTEND_OP_CODE_PREFIX | 0xADU,
+  I32X4_ADD = VECTOR_EXTEND_OP_CODE_PREFIX | 0xAEU,
+  I32X4_SUB = VECTOR_EXTEND_OP_CODE_PREFIX | 0xB1U,
+  I32X4_MUL = VECTOR_EXTEND_OP_CODE_PREFIX | 0xB5U,
+  I32X4_MIN_S = VECTOR_EXTEND_OP_CODE_PREFIX | 0xB6U,
+  I32X4_MIN_U = VECTOR_EXTEND_OP_CODE_PREFIX | 0xB7U,
+  I32X4_MAX_S = VECTOR_EXTEND_OP_CODE_PREFIX | 0xB8U,
+  I32X4_MAX_U = VECTOR_EXTEND_OP_CODE_PREFIX | 0xB9U,
+  I32X4_DOT_I16X8_S = VECTOR_EXTEND_OP_CODE_PREFIX | 0xBAU,
+  I32X4_EXTMUL_LOW_I16X8_S = VECTOR_EXTEND_OP_CODE_PREFIX | 0xBCU,
+  I32X4_EXTMUL_HIGH_I16X8_S = VECTOR_EXTEND_OP_CODE_PREFIX | 0xBDU,
+  I32X4_EXTMUL_LOW_I16X8_U = VECTOR_EXTEND_OP_CODE_PREFIX | 0xBEU,
+  I32X4_EXTMUL_HIGH_I16X8_U = VECTOR_EXTEND_OP_CODE_PREFIX | 0xBFU,
+  I64X2_ABS = VECTOR_EXTEND_OP_CODE_PREFIX | 0xC0U,
+  I64X2_NEG = VECTOR_EXTEND_OP_CODE_PREFIX | 0xC1U,
+  I64X2_ALL_TRUE = VECTOR_EXTEND_OP_CODE_PREFIX | 0xC3U,
+  I64X2_BITMASK = VECTOR_EXTEND_OP_CODE_PREFIX | 0xC4U,
+  I64X2_EXTEND_LOW_I32X4_S = VECTOR_EXTEND_OP_CODE_PREFIX | 0xC7U,
+  I64X2_EXTEND_HIGH_I32X4_S = VECTOR_EXTEND_OP_CODE_PREFIX | 0xC8U,
+  I64X2_EXTEND_LOW_I32X4_U = VECTOR_EXTEND_OP_CODE_PREFIX | 0xC9U,
+  I64X2_EXTEND_HIGH_I32X4_U = VECTOR_EXTEND_OP_CODE_PREFIX | 0xCAU,
+  I64X2_SHL = VECTOR_EXTEND_OP_CODE_PREFIX | 0xCBU,
+  I64X2_SHR_S = VECTOR_EXTEND_OP_CODE_PREFIX | 0xCCU,
+  I64X2_SHR_U = VECTOR_EXTEND_OP_CODE_PREFIX | 0xCDU,
+  I64X2_ADD = VECTOR_EXTEND_OP_CODE_PREFIX | 0xCEU,
+  I64X2_SUB = VECTOR_EXTEND_OP_CODE_PREFIX | 0xD1U,
+  I64X2_MUL = VECTOR_EXTEND_OP_CODE_PREFIX | 0xD5U,
+  I64X2_EQ = VECTOR_EXTEND_OP_CODE_PREFIX | 0xD6U,
+  I64X2_NE = VECTOR_EXTEND_OP_CODE_PREFIX | 0xD7U,
+  I64X2_LT_S = VECTOR_EXTEND_OP_CODE_PREFIX | 0xD8U,
+  I64X2_GT_S = VECTOR_EXTEND_OP_CODE_PREFIX | 0xD9U,
+  I64X2_LE_S = VECTOR_EXTEND_OP_CODE_PREFIX | 0xDAU,
+  I64X2_GE_S = VECTOR_EXTEND_OP_CODE_PREFIX | 0xDBU,
+  I64X2_EXTMUL_LOW_I32X4_S = VECTOR_EXTEND_OP_CODE_PREFIX | 0xDCU,
+  I64X2_EXTMUL_HIGH_I32X4_S = VECTOR_EXTEND_OP_CODE_PREFIX | 0xDDU,
+  I64X2_EXTMUL_LOW_I32X4_U = VECTOR_EXTEND_OP_CODE_PREFIX | 0xDEU,
+  I64X2_EXTMUL_HIGH_I32X4_U = VECTOR_EXTEND_OP_CODE_PREFIX | 0xDFU,
+  F32X4_ABS = VECTOR_EXTEND_OP_CODE_PREFIX | 0xE0U,
+  F32X4_NEG = VECTOR_EXTEND_OP_CODE_PREFIX | 0xE1U,
+  F32X4_SQRT = VECTOR_EXTEND_OP_CODE_PREFIX | 0xE3U,
+  F32X4_ADD = VECTOR_EXTEND_OP_CODE_PREFIX | 0xE4U,
+  F32X4_SUB = VECTOR_EXTEND_OP_CODE_PREFIX | 0xE5U,
+  F32X4_MUL = VECTOR_EXTEND_OP_CODE_PREFIX | 0xE6U,
+  F32X4_DIV = VECTOR_EXTEND_OP_CODE_PREFIX | 0xE7U,
+  F32X4_MIN = VECTOR_EXTEND_OP_CODE_PREFIX | 0xE8U,
+  F32X4_MAX = VECTOR_EXTEND_OP_CODE_PREFIX | 0xE9U,
+  F32X4_PMIN = VECTOR_EXTEND_OP_CODE_PREFIX | 0xEAU,
+  F32X4_PMAX = VECTOR_EXTEND_OP_CODE_PREFIX | 0xEBU,
+  F64X2_ABS = VECTOR_EXTEND_OP_CODE_PREFIX | 0xECU,
+  F64X2_NEG = VECTOR_EXTEND_OP_CODE_PREFIX | 0xEDU,
+  F64X2_SQRT = VECTOR_EXTEND_OP_CODE_PREFIX | 0xEFU,
+  F64X2_ADD = VECTOR_EXTEND_OP_CODE_PREFIX | 0xF0U,
+  F64X2_SUB = VECTOR_EXTEND_OP_CODE_PREFIX | 0xF1U,
+  F64X2_MUL = VECTOR_EXTEND_OP_CODE_PREFIX | 0xF2U,
+  F64X2_DIV = VECTOR_EXTEND_OP_CODE_PREFIX | 0xF3U,
+  F64X2_MIN = VECTOR_EXTEND_OP_CODE_PREFIX | 0xF4U,
+  F64X2_MAX = VECTOR_EXTEND_OP_CODE_PREFIX | 0xF5U,
+  F64X2_PMIN = VECTOR_EXTEND_OP_CODE_PREFIX | 0xF6U,
+  F64X2_PMAX = VECTOR_EXTEND_OP_CODE_PREFIX | 0xF7U,
+  I32X4_TRUNC_SAT_F32X4_S = VECTOR_EXTEND_OP_CODE_PREFIX | 0xF8U,
+  I32X4_TRUNC_SAT_F32X4_U = VECTOR_EXTEND_OP_CODE_PREFIX | 0xF9U,
+  F32X4_CONVERT_I32X4_S = VECTOR_EXTEND_OP_CODE_PREFIX | 0xFAU,
+  F32X4_CONVERT_I32X4_U = VECTOR_EXTEND_OP_CODE_PREFIX | 0xFBU,
+  I32X4_TRUNC_SAT_F64X2_S_ZERO = VECTOR_EXTEND_OP_CODE_PREFIX | 0xFCU,
+  I32X4_TRUNC_SAT_F64X2_U_ZERO = VECTOR_EXTEND_OP_CODE_PREFIX | 0xFDU,
+  F64X2_CONVERT_LOW_I32X4_S = VECTOR_EXTEND_OP_CODE_PREFIX | 0xFEU,
+  F64X2_CONVERT_LOW_I32X4_U = VECTOR_EXTEND_OP_CODE_PREFIX | 0xFFU,
 };
 
 ///
@@ -269,4 +508,170 @@ inline uint8_t operator-(OPCode const lhs, OPCode const rhs) {
   return static_cast<uint8_t>(static_cast<uint8_t>(lhs) - static_cast<uint8_t>(rhs));
 }
 
+///
+/// @brief Comparisons of two floats (F32_EQ to F64_GE), the result is an i32
+inline bool isFloatComparison(OPCode const opcode) {
+  return (opcode >= OPCode::F32_EQ) && (opcode <= OPCode::F64_GE);
+}
+
+///
+/// @brief Float operators with two operands: the comparisons and ADD to COPYSIGN of F32 and F64
+inline bool isFloatBinaryOperation(OPCode const opcode) {
+  return isFloatComparison(opcode) || ((opcode >= OPCode::F32_ADD) && (opcode <= OPCode::F32_COPYSIGN)) ||
+         ((opcode >= OPCode::F64_ADD) && (opcode <= OPCode::F64_COPYSIGN));
+}
+
+///
+/// @brief Operators that replace their single operand by the result: ABS to SQRT of F32 and F64, the conversions and
+/// reinterpretations (I32_WRAP_I64 to F64_REINTERPRET_I64) and the saturating truncations
+inline bool isUnaryOperation(OPCode const opcode) {
+  return ((opcode >= OPCode::F32_ABS) && (opcode <= OPCode::F32_SQRT)) || ((opcode >= OPCode::F64_ABS) && (opcode <= OPCode::F64_SQRT)) ||
+         ((opcode >= OPCode::I32_WRAP_I64) && (opcode <= OPCode::F64_REINTERPRET_I64)) ||
+         ((opcode >= OPCode::I32_TRUNC_SAT_F32_S) && (opcode <= OPCode::I64_TRUNC_SAT_F64_U));
+}
+
+///
+/// @brief Whether the sub opcode after VECTOR_EXTEND_OP_CODE is a SIMD instruction of the specification (0x00 to 0xFF with
+/// some gaps)
+inline bool isVectorOperation(uint32_t const subOpcode) {
+  if (subOpcode > 0xFFU) {
+    return false;
+  }
+  switch (subOpcode) {
+  case 0x9AU:
+  case 0xA2U:
+  case 0xA5U:
+  case 0xA6U:
+  case 0xAFU:
+  case 0xB0U:
+  case 0xB2U:
+  case 0xB3U:
+  case 0xB4U:
+  case 0xBBU:
+  case 0xC2U:
+  case 0xC5U:
+  case 0xC6U:
+  case 0xCFU:
+  case 0xD0U:
+  case 0xD2U:
+  case 0xD3U:
+  case 0xD4U:
+  case 0xE2U:
+  case 0xEEU:
+    return false;
+  default:
+    return true;
+  }
+}
+
+///
+/// @brief SIMD instructions followed by a memory argument (alignment and offset): the loads, v128.store and the lane loads and stores
+inline bool hasVectorMemoryArgument(OPCode const opcode) {
+  return ((opcode >= OPCode::V128_LOAD) && (opcode <= OPCode::V128_STORE)) ||
+         ((opcode >= OPCode::V128_LOAD8_LANE) && (opcode <= OPCode::V128_LOAD64_ZERO));
+}
+
+///
+/// @brief SIMD instructions followed by a lane index byte: extract_lane, replace_lane and the lane loads and stores
+inline bool hasVectorLaneIndex(OPCode const opcode) {
+  return ((opcode >= OPCode::I8X16_EXTRACT_LANE_S) && (opcode <= OPCode::F64X2_REPLACE_LANE)) ||
+         ((opcode >= OPCode::V128_LOAD8_LANE) && (opcode <= OPCode::V128_STORE64_LANE));
+}
+
+///
+/// @brief Bytes of the fixed size immediates of a SIMD instruction: the 16 of v128.const and i8x16.shuffle, or a lane index. A
+/// memory argument (LEB128s) comes before the lane index.
+inline uint32_t vectorImmediateBytes(OPCode const opcode) {
+  if ((opcode == OPCode::V128_CONST) || (opcode == OPCode::I8X16_SHUFFLE)) {
+    return 16U;
+  }
+  return hasVectorLaneIndex(opcode) ? 1U : 0U;
+}
+
+///
+/// @brief SIMD instructions that push nothing: v128.store and the lane stores
+inline bool isVectorStore(OPCode const opcode) {
+  return (opcode == OPCode::V128_STORE) || ((opcode >= OPCode::V128_STORE8_LANE) && (opcode <= OPCode::V128_STORE64_LANE));
+}
+
+///
+/// @brief Number of operands a SIMD instruction (isVectorOperation) pops, the address of a memory access included
+inline uint32_t vectorOperandCount(OPCode const opcode) {
+  if (opcode == OPCode::V128_CONST) {
+    return 0U;
+  }
+  if (opcode == OPCode::V128_BITSELECT) {
+    return 3U;
+  }
+  if (((opcode >= OPCode::V128_LOAD) && (opcode <= OPCode::V128_LOAD64_SPLAT)) || (opcode == OPCode::V128_LOAD32_ZERO) ||
+      (opcode == OPCode::V128_LOAD64_ZERO) || ((opcode >= OPCode::I8X16_SPLAT) && (opcode <= OPCode::F64X2_SPLAT)) ||
+      (opcode >= OPCode::I32X4_TRUNC_SAT_F32X4_S)) {
+    return 1U;
+  }
+  switch (opcode) {
+  case OPCode::I8X16_EXTRACT_LANE_S:
+  case OPCode::I8X16_EXTRACT_LANE_U:
+  case OPCode::I16X8_EXTRACT_LANE_S:
+  case OPCode::I16X8_EXTRACT_LANE_U:
+  case OPCode::I32X4_EXTRACT_LANE:
+  case OPCode::I64X2_EXTRACT_LANE:
+  case OPCode::F32X4_EXTRACT_LANE:
+  case OPCode::F64X2_EXTRACT_LANE:
+  case OPCode::V128_NOT:
+  case OPCode::V128_ANY_TRUE:
+  case OPCode::F32X4_DEMOTE_F64X2_ZERO:
+  case OPCode::F64X2_PROMOTE_LOW_F32X4:
+  case OPCode::I8X16_ABS:
+  case OPCode::I8X16_NEG:
+  case OPCode::I8X16_POPCNT:
+  case OPCode::I8X16_ALL_TRUE:
+  case OPCode::I8X16_BITMASK:
+  case OPCode::F32X4_CEIL:
+  case OPCode::F32X4_FLOOR:
+  case OPCode::F32X4_TRUNC:
+  case OPCode::F32X4_NEAREST:
+  case OPCode::F64X2_CEIL:
+  case OPCode::F64X2_FLOOR:
+  case OPCode::F64X2_TRUNC:
+  case OPCode::I16X8_EXTADD_PAIRWISE_I8X16_S:
+  case OPCode::I16X8_EXTADD_PAIRWISE_I8X16_U:
+  case OPCode::I32X4_EXTADD_PAIRWISE_I16X8_S:
+  case OPCode::I32X4_EXTADD_PAIRWISE_I16X8_U:
+  case OPCode::I16X8_ABS:
+  case OPCode::I16X8_NEG:
+  case OPCode::I16X8_ALL_TRUE:
+  case OPCode::I16X8_BITMASK:
+  case OPCode::I16X8_EXTEND_LOW_I8X16_S:
+  case OPCode::I16X8_EXTEND_HIGH_I8X16_S:
+  case OPCode::I16X8_EXTEND_LOW_I8X16_U:
+  case OPCode::I16X8_EXTEND_HIGH_I8X16_U:
+  case OPCode::F64X2_NEAREST:
+  case OPCode::I32X4_ABS:
+  case OPCode::I32X4_NEG:
+  case OPCode::I32X4_ALL_TRUE:
+  case OPCode::I32X4_BITMASK:
+  case OPCode::I32X4_EXTEND_LOW_I16X8_S:
+  case OPCode::I32X4_EXTEND_HIGH_I16X8_S:
+  case OPCode::I32X4_EXTEND_LOW_I16X8_U:
+  case OPCode::I32X4_EXTEND_HIGH_I16X8_U:
+  case OPCode::I64X2_ABS:
+  case OPCode::I64X2_NEG:
+  case OPCode::I64X2_ALL_TRUE:
+  case OPCode::I64X2_BITMASK:
+  case OPCode::I64X2_EXTEND_LOW_I32X4_S:
+  case OPCode::I64X2_EXTEND_HIGH_I32X4_S:
+  case OPCode::I64X2_EXTEND_LOW_I32X4_U:
+  case OPCode::I64X2_EXTEND_HIGH_I32X4_U:
+  case OPCode::F32X4_ABS:
+  case OPCode::F32X4_NEG:
+  case OPCode::F32X4_SQRT:
+  case OPCode::F64X2_ABS:
+  case OPCode::F64X2_NEG:
+  case OPCode::F64X2_SQRT:
+    return 1U;
+  default:
+    return 2U;
+  }
+}
+
 #endif
@@ -0,0 +1,582 @@
+#include <algorithm>
+
+#include "LEB128.hpp"
+#include "OPCode.hpp"
+#include "RegisterAllocator.hpp"
+
+namespace {
+constexpr uint64_t loopWeight = 8U;
+constexpr uint32_t maxWeightedLoopDepth = 4U;
+
+// registers locals are allocated from, all caller-saved. Everything above numLocalsInGPR up to R25 is left to block results.
+constexpr uint32_t numPoolRegisters = 16U;
+constexpr TReg gprPool[numPoolRegisters] = {TReg::R0, TReg::R1, TReg::R2,  TReg::R3,  TReg::R4,  TReg::R5,  TReg::R6,  TReg::R7,
+                                            TReg::R8, TReg::R9, TReg::R10, TReg::R11, TReg::R12, TReg::R13, TReg::R14, TReg::R15};
+// F8-F15 are callee-saved and not preserved by the invocation trampolines
+constexpr TReg fprPool[numPoolRegisters] = {TReg::F0,  TReg::F1,  TReg::F2,  TReg::F3,  TReg::F4,  TReg::F5,  TReg::F6,  TReg::F7,
+                                            TReg::F16, TReg::F17, TReg::F18, TReg::F19, TReg::F20, TReg::F21, TReg::F22, TReg::F23};
+
+// f32, f64 and v128 take a V register
+bool isFloat(WasmType const type) {
+  return (type == WasmType::F32) || (type == WasmType::F64) || (type == WasmType::VEC_TYPE);
+}
+
+class LivenessWalk final {
+public:
+  LivenessWalk(std::vector<LiveRange> &ranges, std::vector<bool> &writtenFirst, const ModuleInfo *moduleInfo, std::vector<size_t> &callPositions)
+      : ranges_(ranges), writtenFirst_(writtenFirst), moduleInfo_(moduleInfo), callPositions_(callPositions) {
+  }
+
+  ///
+  /// @return false if an opcode is unknown
+  bool run(const ByteSpan &code, size_t index) {
+    while (index < code.size()) {
+      size_t const position = index;
+      switch (static_cast<OPCode>(code[index++])) {
+      case OPCode::I32_CONST: {
+        static_cast<void>(readSLEB128(code, index));
+        operands_.push_back(Operand{});
+        break;
+      }
+      case OPCode::I64_CONST: {
+        static_cast<void>(readSLEB128_64(code, index));
+        operands_.push_back(Operand{});
+        break;
+      }
+      case OPCode::F32_CONST: {
+        index += 4U;
+        operands_.push_back(Operand{});
+        break;
+      }
+      case OPCode::F64_CONST: {
+        index += 8U;
+        operands_.push_back(Operand{});
+        break;
+      }
+      case OPCode::LOCAL_GET: {
+        uint32_t const localIndex = readULEB128(code, index);
+        access(localIndex, position, false);
+        operands_.push_back(Operand{localIndex, noLocal});
+        break;
+      }
+      case OPCode::LOCAL_SET: {
+        uint32_t const localIndex = readULEB128(code, index);
+        consume(1U, position);
+        access(localIndex, position, true);
+        break;
+      }
+      case OPCode::LOCAL_TEE: {
+        // a local or register operand is only copied into the local, a deferred action is emitted into it
+        uint32_t const localIndex = readULEB128(code, index);
+        if (!operands_.empty()) {
+          access(operands_.back(), position);
+          if (operands_.back().isDeferred()) {
+            operands_.back() = Operand{localIndex, noLocal};
+          }
+        }
+        access(localIndex, position, true);
+        break;
+      }
+      case OPCode::BLOCK:
+      case OPCode::LOOP: {
+        materializeAll(position);
+        auto const opcode = static_cast<OPCode>(code[position]);
+        frames_.push_back({opcode, static_cast<WasmType>(code[index++]), position, operands_.size()});
+        break;
+      }
+      case OPCode::IF: {
+        consume(1U, position);
+        materializeAll(position);
+        frames_.push_back({OPCode::IF, static_cast<WasmType>(code[index++]), position, operands_.size()});
+        break;
+      }
+      case OPCode::ELSE: {
+        if (!frames_.empty()) {
+          consume(operands_.size() - std::min(operands_.size(), frames_.back().stackHeight), position);
+        }
+        break;
+      }
+      case OPCode::END: {
+        if (frames_.empty()) {
+          consume(operands_.size(), position);
+          break;
+        }
+        Frame const frame = frames_.back();
+        frames_.pop_back();
+        consume(operands_.size() - std::min(operands_.size(), frame.stackHeight), position);
+        if (frame.opcode == OPCode::LOOP) {
+          loops_.push_back({frame.start, position});
+        }
+        if (frame.resultType != WasmType::TVOID) {
+          operands_.push_back(Operand{}); // block results live in their own register
+        }
+        break;
+      }
+      case OPCode::BR:
+      case OPCode::BR_TABLE:
+      case OPCode::RETURN: {
+        // branch targets are forward, or a loop start the loop extension below accounts for, so the ranges stay linear
+        auto const opcode = static_cast<OPCode>(code[position]);
+        if (opcode == OPCode::BR) {
+          static_cast<void>(readULEB128(code, index));
+        } else if (opcode == OPCode::BR_TABLE) {
+          uint32_t const numTargets = readULEB128(code, index);
+          for (uint32_t j = 0U; j <= numTargets; ++j) {
+            static_cast<void>(readULEB128(code, index));
+          }
+        }
+        size_t const height = frames_.empty() ? 0U : frames_.back().stackHeight;
+        consume(operands_.size() - std::min(operands_.size(), height), position);
+        break;
+      }
+      case OPCode::BR_IF: {
+        // the value a taken branch passes along stays on the operand stack for the fallthrough
+        static_cast<void>(readULEB128(code, index));
+        consume(1U, position);
+        if (!operands_.empty()) {
+          access(operands_.back(), position);
+        }
+        break;
+      }
+      case OPCode::DROP: {
+        consume(1U, position);
+        break;
+      }
+      case OPCode::CALL: {
+        // the callee needs the signature, without the module the walk can not go on
+        uint32_t const callee = readULEB128(code, index);
+        if ((moduleInfo_ == nullptr) || (callee >= moduleInfo_->functionInfos.size())) {
+          return false;
+        }
+        uint32_t const typeIndex = moduleInfo_->functionInfos[callee].typeIndex;
+        consume(moduleInfo_->getNumParamsForSignature(typeIndex), position);
+        callPositions_.push_back(position);
+        if (moduleInfo_->getReturnTypeForSignature(typeIndex) != WasmType::TVOID) {
+          operands_.push_back(Operand{});
+        }
+        break;
+      }
+      case OPCode::I32_LOAD:
+      case OPCode::I64_LOAD:
+      case OPCode::F32_LOAD:
+      case OPCode::F64_LOAD:
+      case OPCode::I32_LOAD8_S:
+      case OPCode::I32_LOAD8_U:
+      case OPCode::I32_LOAD16_S:
+      case OPCode::I32_LOAD16_U:
+      case OPCode::I64_LOAD8_S:
+      case OPCode::I64_LOAD8_U:
+      case OPCode::I64_LOAD16_S:
+      case OPCode::I64_LOAD16_U:
+      case OPCode::I64_LOAD32_S:
+      case OPCode::I64_LOAD32_U: {
+        static_cast<void>(readULEB128(code, index)); // alignment
+        static_cast<void>(readULEB128(code, index)); // offset
+        consume(1U, position);
+        operands_.push_back(Operand{});
+        break;
+      }
+      case OPCode::I32_STORE:
+      case OPCode::I64_STORE:
+      case OPCode::F32_STORE:
+      case OPCode::F64_STORE:
+      case OPCode::I32_STORE8:
+      case OPCode::I32_STORE16:
+      case OPCode::I64_STORE8:
+      case OPCode::I64_STORE16:
+      case OPCode::I64_STORE32: {
+        static_cast<void>(readULEB128(code, index));
+        static_cast<void>(readULEB128(code, index));
+        consume(2U, position);
+        break;
+      }
+      case OPCode::MEMORY_SIZE: {
+        index++; // memory index
+        operands_.push_back(Operand{});
+        break;
+      }
+      case OPCode::MEMORY_GROW: {
+        // calls the grow function, the registers live across it are saved like for a CALL
+        index++;
+        consume(1U, position);
+        callPositions_.push_back(position);
+        operands_.push_back(Operand{});
+        break;
+      }
+      case OPCode::NOP: {
+        break;
+      }
+      case OPCode::I32_EQZ:
+      case OPCode::I64_EQZ: {
+        // a comparison with an immediate zero
+        if (!operands_.empty()) {
+          Operand const operand = operands_.back();
+          operands_.back() = Operand{operand.isLocal() ? operand.first : noLocal, noLocal, true};
+        }
+        break;
+      }
+      case OPCode::SCALAR_EXTEND_OP_CODE: {
+        // only the saturating truncations
+        if (readULEB128(code, index) > 7U) {
+          return false;
+        }
+        consume(1U, position);
+        operands_.push_back(Operand{});
+        break;
+      }
+      case OPCode::VECTOR_EXTEND_OP_CODE: {
+        // emitted right away, a lane store pushes nothing
+        uint32_t const subOpcode = readULEB128(code, index);
+        if (!isVectorOperation(subOpcode)) {
+          return false;
+        }
+        auto const opcode = static_cast<OPCode>(static_cast<uint32_t>(OPCode::VECTOR_EXTEND_OP_CODE_PREFIX) | subOpcode);
+        if (hasVectorMemoryArgument(opcode)) {
+          static_cast<void>(readULEB128(code, index)); // alignment
+          static_cast<void>(readULEB128(code, index)); // offset
+        }
+        index += vectorImmediateBytes(opcode);
+        consume(vectorOperandCount(opcode), position);
+        if (!isVectorStore(opcode)) {
+          operands_.push_back(Operand{});
+        }
+        break;
+      }
+      case OPCode::F32_EQ:
+      case OPCode::F32_NE:
+      case OPCode::F32_LT:
+      case OPCode::F32_GT:
+      case OPCode::F32_LE:
+      case OPCode::F32_GE:
+      case OPCode::F64_EQ:
+      case OPCode::F64_NE:
+      case OPCode::F64_LT:
+      case OPCode::F64_GT:
+      case OPCode::F64_LE:
+      case OPCode::F64_GE:
+      case OPCode::I32_EQ:
+      case OPCode::I32_NE:
+      case OPCode::I32_LT_S:
+      case OPCode::I32_LT_U:
+      case OPCode::I32_GT_S:
+      case OPCode::I32_GT_U:
+      case OPCode::I32_LE_S:
+      case OPCode::I32_LE_U:
+      case OPCode::I32_GE_S:
+      case OPCode::I32_GE_U:
+      case OPCode::I64_EQ:
+      case OPCode::I64_NE:
+      case OPCode::I64_LT_S:
+      case OPCode::I64_LT_U:
+      case OPCode::I64_GT_S:
+      case OPCode::I64_GT_U:
+      case OPCode::I64_LE_S:
+      case OPCode::I64_LE_U:
+      case OPCode::I64_GE_S:
+      case OPCode::I64_GE_U:
+      case OPCode::I32_ADD:
+      case OPCode::I32_SUB:
+      case OPCode::I32_MUL:
+      case OPCode::I32_DIV_S:
+      case OPCode::I32_DIV_U:
+      case OPCode::I32_REM_S:
+      case OPCode::I32_REM_U:
+      case OPCode::I32_AND:
+      case OPCode::I32_OR:
+      case OPCode::I32_XOR:
+      case OPCode::I32_SHL:
+      case OPCode::I32_SHR_S:
+      case OPCode::I32_SHR_U:
+      case OPCode::I64_ADD:
+      case OPCode::I64_SUB:
+      case OPCode::I64_MUL:
+      case OPCode::I64_DIV_S:
+      case OPCode::I64_DIV_U:
+      case OPCode::I64_REM_S:
+      case OPCode::I64_REM_U:
+      case OPCode::I64_AND:
+      case OPCode::I64_OR:
+      case OPCode::I64_XOR:
+      case OPCode::I64_SHL:
+      case OPCode::I64_SHR_S:
+      case OPCode::I64_SHR_U: {
+        // covers the deferral rule of the code generator: everything but a division may be emitted only when the result is
+        // consumed (with a local or an immediate as right operand) and reads the locals of both operands then. Treating it as
+        // deferred when the code generator emits it right away only keeps the locals live a little longer.
+        if (operands_.size() < 2U) {
+          consume(operands_.size(), position);
+          operands_.push_back(Operand{});
+          break;
+        }
+        Operand const right = operands_.back();
+        Operand const left = operands_[operands_.size() - 2U];
+        consume(2U, position);
+        auto const opcode = static_cast<OPCode>(code[position]);
+        bool const isDivision = ((opcode >= OPCode::I32_DIV_S) && (opcode <= OPCode::I32_REM_U)) ||
+                                ((opcode >= OPCode::I64_DIV_S) && (opcode <= OPCode::I64_REM_U));
+        if (!isDivision) {
+          operands_.push_back(Operand{left.isLocal() ? left.first : noLocal, right.isLocal() ? right.first : noLocal, true});
+        } else {
+          operands_.push_back(Operand{});
+        }
+        break;
+      }
+      default: {
+        // float arithmetic and the conversions are emitted right away
+        auto const opcode = static_cast<OPCode>(code[position]);
+        if (isFloatBinaryOperation(opcode)) {
+          consume(2U, position);
+        } else if (isUnaryOperation(opcode)) {
+          consume(1U, position);
+        } else {
+          return false;
+        }
+        operands_.push_back(Operand{});
+        break;
+      }
+      }
+    }
+    // inner loops end first, so an outer loop also covers what an inner one extended
+    for (const Loop &loop : loops_) {
+      for (LiveRange &range : ranges_) {
+        if (range.used && (range.start <= loop.end) && (range.end >= loop.start)) {
+          range.start = std::min(range.start, loop.start);
+          range.end = std::max(range.end, loop.end);
+        }
+      }
+    }
+    return true;
+  }
+
+private:
+  static constexpr uint32_t noLocal = UINT32_MAX;
+
+  ///
+  /// @brief Locals an operand stack slot reads when it is consumed: a local.get aliases one local, a deferred action the
+  /// locals of its operands (none if they are constants or registers of the operand stack)
+  struct Operand {
+    uint32_t first = noLocal;
+    uint32_t second = noLocal; ///< only set for deferred actions
+    bool deferred = false;
+
+    bool isLocal() const {
+      return !deferred && (first != noLocal);
+    }
+
+    bool isDeferred() const {
+      return deferred;
+    }
+  };
+
+  struct Frame {
+    OPCode opcode;
+    WasmType resultType;
+    size_t start;
+    size_t stackHeight;
+  };
+
+  struct Loop {
+    size_t start;
+    size_t end;
+  };
+
+  void access(uint32_t const localIndex, size_t const position, bool const isWrite) {
+    if ((localIndex == noLocal) || (localIndex >= ranges_.size())) {
+      return;
+    }
+    LiveRange &range = ranges_[localIndex];
+    if (!range.used) {
+      range.used = true;
+      range.start = position;
+      // only a write outside of any block surely happens before every read
+      writtenFirst_[localIndex] = isWrite && frames_.empty();
+    }
+    range.end = std::max(range.end, position);
+    uint64_t weight = 1U;
+    uint32_t loopDepth = 0U;
+    for (const Frame &frame : frames_) {
+      if ((frame.opcode == OPCode::LOOP) && (loopDepth < maxWeightedLoopDepth)) {
+        weight *= loopWeight;
+        loopDepth++;
+      }
+    }
+    range.weight += weight;
+  }
+
+  void access(const Operand &operand, size_t const position) {
+    access(operand.first, position, false);
+    access(operand.second, position, false);
+  }
+
+  void consume(size_t const count, size_t const position) {
+    for (size_t n = 0U; (n < count) && !operands_.empty(); ++n) {
+      access(operands_.back(), position);
+      operands_.pop_back();
+    }
+  }
+
+  // control flow splits, every operand is copied into the register of its slot
+  void materializeAll(size_t const position) {
+    for (Operand &operand : operands_) {
+      access(operand, position);
+      operand = Operand{};
+    }
+  }
+
+  std::vector<LiveRange> &ranges_;
+  std::vector<bool> &writtenFirst_;
+  const ModuleInfo *moduleInfo_;
+  std::vector<size_t> &callPositions_;
+  std::vector<Operand> operands_;
+  std::vector<Frame> frames_;
+  std::vector<Loop> loops_;
+};
+} // namespace
+
+std::vector<LiveRange> computeLiveRanges(const ByteSpan &functionInstructionsCode, size_t const index, std::vector<ModuleInfo::LocalVar> &locals,
+                                         uint32_t const numParams, const ModuleInfo *const moduleInfo, std::vector<size_t> *const callPositions) {
+  std::vector<LiveRange> ranges(locals.size());
+  std::vector<bool> writtenFirst(locals.size(), false);
+  std::vector<size_t> positions;
+  LivenessWalk walk(ranges, writtenFirst, moduleInfo, positions);
+  bool const complete = walk.run(functionInstructionsCode, index);
+  if ((callPositions != nullptr) && complete) {
+    *callPositions = std::move(positions);
+  }
+
+  for (size_t i = 0U; i < locals.size(); ++i) {
+    LiveRange &range = ranges[i];
+    if (!complete) {
+      range.start = 0U;
+      range.end = functionInstructionsCode.size();
+      range.used = true;
+      range.weight = std::max(range.weight, static_cast<uint64_t>(1U));
+    } else if (range.used && ((i < numParams) || !writtenFirst[i])) {
+      range.start = 0U; // the argument or the implicit zero is live from the function entry
+    }
+    locals[i].zeroOnEntry = (i >= numParams) && range.used && (range.start == 0U) && (!complete || !writtenFirst[i]);
+  }
+  return ranges;
+}
+
+void allocateRegisters(const ByteSpan &functionInstructionsCode, size_t const index, std::vector<ModuleInfo::LocalVar> &locals,
+                       ModuleInfo::FunctionInfo &funcInfo, const ModuleInfo *const moduleInfo) {
+  std::vector<size_t> callPositions;
+  std::vector<LiveRange> const ranges = computeLiveRanges(functionInstructionsCode, index, locals, funcInfo.numParams, moduleInfo, &callPositions);
+
+  // params take the register they are passed in, in the order of the signature per register class
+  std::vector<uint32_t> pinned(locals.size(), UINT32_MAX);
+  uint32_t numGPRParams = 0U;
+  uint32_t numFPRParams = 0U;
+  for (uint32_t i = 0U; i < funcInfo.numParams; ++i) {
+    pinned[i] = isFloat(locals[i].wasmType) ? numFPRParams++ : numGPRParams++;
+  }
+
+  std::vector<size_t> order;
+  for (size_t i = 0U; i < locals.size(); ++i) {
+    locals[i].currentStorageType = StorageType::INVALID;
+    if (ranges[i].used) {
+      order.push_back(i);
+    }
+  }
+  std::stable_sort(order.begin(), order.end(), [&ranges](size_t const lhs, size_t const rhs) {
+    return ranges[lhs].start < ranges[rhs].start;
+  });
+
+  struct PoolState {
+    uint32_t freeMask = (1U << numPoolRegisters) - 1U;
+    std::vector<size_t> active; ///< locals currently holding a register of the pool
+    std::vector<uint32_t> slotOf;
+    uint32_t numUsed = 0U; ///< highest pool slot in use plus one
+  };
+  PoolState pools[2];
+  pools[0].slotOf.assign(locals.size(), UINT32_MAX);
+  pools[1].slotOf.assign(locals.size(), UINT32_MAX);
+
+  uint32_t spillBytes = 0U;
+  auto const spill = [&locals, &funcInfo, &spillBytes](size_t const localIndex) {
+    bool const isVector = locals[localIndex].wasmType == WasmType::VEC_TYPE;
+    if (isVector) {
+      spillBytes = (spillBytes + 15U) & ~15U; // LDR/STR of a Q register scale their offset by 16
+    }
+    locals[localIndex].currentStorageType = StorageType::STACKMEMORY;
+    locals[localIndex].stackFramePosition = spillBytes;
+    spillBytes += isVector ? 16U : 8U;
+    funcInfo.numSpilledLocals++;
+  };
+
+  for (size_t const current : order) {
+    PoolState &pool = pools[isFloat(locals[current].wasmType) ? 1U : 0U];
+    // expire ranges that ended before this one starts
+    for (size_t n = 0U; n < pool.active.size();) {
+      size_t const other = pool.active[n];
+      if (ranges[other].end < ranges[current].start) {
+        pool.freeMask |= 1U << pool.slotOf[other];
+        pool.active[n] = pool.active.back();
+        pool.active.pop_back();
+      } else {
+        n++;
+      }
+    }
+
+    uint32_t slot = UINT32_MAX;
+    if (pinned[current] != UINT32_MAX) {
+      if ((pinned[current] < numPoolRegisters) && ((pool.freeMask & (1U << pinned[current])) != 0U)) {
+        slot = pinned[current];
+      }
+    } else if (pool.freeMask != 0U) {
+      slot = static_cast<uint32_t>(__builtin_ctz(pool.freeMask));
+    } else {
+      // keep the heaviest values in registers, of equal weights spill the one that stays live the longest
+      size_t victim = current;
+      for (size_t const other : pool.active) {
+        if ((ranges[other].weight < ranges[victim].weight) ||
+            ((ranges[other].weight == ranges[victim].weight) && (ranges[other].end > ranges[victim].end))) {
+          victim = other;
+        }
+      }
+      if (victim != current) {
+        slot = pool.slotOf[victim];
+        pool.active.erase(std::find(pool.active.begin(), pool.active.end(), victim));
+        spill(victim);
+        pool.freeMask |= 1U << slot;
+      }
+    }
+
+    if (slot == UINT32_MAX) {
+      spill(current);
+      continue;
+    }
+    pool.freeMask &= ~(1U << slot);
+    pool.slotOf[current] = slot;
+    pool.active.push_back(current);
+    locals[current].currentStorageType = StorageType::REGISTER;
+    locals[current].reg = isFloat(locals[current].wasmType) ? fprPool[slot] : gprPool[slot];
+  }
+
+  funcInfo.numLocalsInGPR = 0U;
+  funcInfo.numLocalsInFPR = 0U;
+  for (size_t i = 0U; i < locals.size(); ++i) {
+    if (locals[i].currentStorageType == StorageType::REGISTER) {
+      if (isFloat(locals[i].wasmType)) {
+        funcInfo.numLocalsInFPR = std::max(funcInfo.numLocalsInFPR, pools[1].slotOf[i] + 1U);
+      } else {
+        funcInfo.numLocalsInGPR = std::max(funcInfo.numLocalsInGPR, pools[0].slotOf[i] + 1U);
+      }
+    }
+  }
+  funcInfo.stackFrameSize = (spillBytes + 15U) & ~15U;
+
+  // every register is caller-saved, the caller keeps the locals it still needs after a call
+  funcInfo.callSaveMasks.clear();
+  for (size_t const position : callPositions) {
+    uint64_t mask = 0U;
+    for (size_t i = 0U; i < locals.size(); ++i) {
+      bool const inRegister = locals[i].currentStorageType == StorageType::REGISTER;
+      if (inRegister && (ranges[i].start <= position) && (ranges[i].end > position)) {
+        mask |= static_cast<uint64_t>(1U) << static_cast<uint32_t>(locals[i].reg);
+      }
+    }
+    funcInfo.callSaveMasks.push_back(mask);
+  }
+}
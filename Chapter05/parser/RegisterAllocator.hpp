@@ -0,0 +1,43 @@
+#ifndef REGISTERALLOCATOR_HPP
+#define REGISTERALLOCATOR_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "ByteSpan.hpp"
+#include "ModuleInfo.hpp"
+
+///
+/// @brief Positions (byte offsets into the function body) where a param or local has to hold its value, [start, end]
+struct LiveRange final {
+  size_t start = 0U;
+  size_t end = 0U;
+  uint64_t weight = 0U; ///< number of accesses, an access inside a loop counts loopWeight times per nesting level
+  bool used = false;
+};
+
+///
+/// @brief Live ranges of all params and locals of one function body.
+/// A local.get only aliases the register of the local, so the local is live until the operand is consumed. A local that is
+/// live anywhere in a loop is live for the whole loop. Non-param locals that may be read before their first write start at 0
+/// and keep zeroOnEntry, the others are not initialized by the prologue.
+/// If the body contains an opcode the walk does not know, every local is treated as live for the whole body.
+/// @param locals Params followed by locals, zeroOnEntry of the locals is updated
+/// @param moduleInfo Signatures of the callees, without it a CALL counts as unknown opcode
+/// @param callPositions Receives the positions of the CALLs in body order, left empty if the walk is incomplete
+std::vector<LiveRange> computeLiveRanges(const ByteSpan &functionInstructionsCode, size_t index, std::vector<ModuleInfo::LocalVar> &locals,
+                                         uint32_t numParams, const ModuleInfo *moduleInfo = nullptr,
+                                         std::vector<size_t> *callPositions = nullptr);
+
+///
+/// @brief Linear-scan register allocation of the params and locals of one function.
+/// Params stay in the register they are passed in (R0-R7, F0-F7). Locals share registers if their live ranges do not overlap.
+/// If more values are live than registers are available, the ones with the least weight are spilled to 8 byte slots of the
+/// stack frame (STACKMEMORY), a v128 to a 16 byte aligned pair of them. v128 values share the pool of the float registers.
+/// funcInfo receives numLocalsInGPR/numLocalsInFPR (how many registers of the pool are in use, counted from R0/F0 upwards),
+/// numSpilledLocals and stackFrameSize, and the locals live across each call in callSaveMasks.
+void allocateRegisters(const ByteSpan &functionInstructionsCode, size_t index, std::vector<ModuleInfo::LocalVar> &locals,
+                       ModuleInfo::FunctionInfo &funcInfo, const ModuleInfo *moduleInfo = nullptr);
+
+#endif
@@ -0,0 +1,257 @@
+#include <algorithm>
+#include <csetjmp>
+#include <csignal>
+#include <cstring>
+#include <mutex>
+#include <sstream>
+#include <ucontext.h>
+
+#include "Runtime.hpp"
+#include "aarch64_assembler.hpp"
+#include "aarch64_common.hpp"
+
+namespace {
+// target of the innermost active invocation on this thread
+thread_local jmp_buf *activeTrapTarget = nullptr;
+
+// trap code of the last trap on this thread, stored right before the jump to the trap target
+thread_local uint32_t lastTrapCode = 0U;
+
+// linear memory of the innermost active invocation on this thread, nullptr if its module has none
+thread_local LinearMemory const *activeMemory = nullptr;
+
+// code of the innermost active invocation on this thread
+thread_local CodeArena const *activeCode = nullptr;
+
+[[noreturn]] void wasmTrapHandler(uint32_t const trapCode) {
+  lastTrapCode = trapCode;
+  longjmp(*activeTrapTarget, 1); // NOLINT(cert-err52-cpp)
+}
+
+struct sigaction previousFaultAction;
+struct sigaction previousBreakpointAction;
+
+// Pass a signal that is not a trap of the compiled code on to the previous handler, or raise it again with the previous
+// disposition once this handler returns
+void chainSignal(struct sigaction const &previousAction, int const signal, siginfo_t *const info, void *const context) {
+  if ((previousAction.sa_flags & SA_SIGINFO) != 0) {
+    previousAction.sa_sigaction(signal, info, context);
+  } else if ((previousAction.sa_handler != SIG_DFL) && (previousAction.sa_handler != SIG_IGN)) {
+    previousAction.sa_handler(signal);
+  } else {
+    sigaction(signal, &previousAction, nullptr);
+  }
+}
+
+// address of the instruction that raised the signal
+uintptr_t signalProgramCounter(void *const context) {
+#if defined(__aarch64__) && defined(__linux__)
+  return static_cast<uintptr_t>(static_cast<ucontext_t *>(context)->uc_mcontext.pc);
+#else
+  static_cast<void>(context); // the compiled code only runs on AArch64 Linux
+  return 0U;
+#endif
+}
+
+// An access of the compiled code to the reserved but inaccessible part of the active linear memory is an out of bounds access,
+// it leaves the handler through the trap target. SA_NODEFER keeps SIGSEGV unblocked after that jump. A fault of host code
+// (memory.grow, or a host function the invocation called into) is never a wasm trap.
+void memoryFaultHandler(int const signal, siginfo_t *const info, void *const context) {
+  if ((activeTrapTarget != nullptr) && (activeMemory != nullptr) && (activeCode != nullptr) && activeCode->contains(signalProgramCounter(context)) &&
+      activeMemory->reserves(reinterpret_cast<uintptr_t>(info->si_addr))) {
+    wasmTrapHandler(LinearMemory::outOfBoundsTrapCode);
+  }
+  chainSignal(previousFaultAction, signal, info, context);
+}
+
+// The trap checks of the compiled code end in a BRK, the trap code is looked up by its address in the trap sites of the arena
+void breakpointHandler(int const signal, siginfo_t *const info, void *const context) {
+  if ((activeTrapTarget != nullptr) && (activeCode != nullptr)) {
+    uintptr_t const pc = signalProgramCounter(context);
+    if (activeCode->contains(pc)) {
+      uint32_t const trapCode = activeCode->trapCodeAt(pc - reinterpret_cast<uintptr_t>(activeCode->base()));
+      if (trapCode != 0U) {
+        wasmTrapHandler(trapCode);
+      }
+    }
+  }
+  chainSignal(previousBreakpointAction, signal, info, context);
+}
+
+void installSignalHandler(int const signal, void (*const handler)(int, siginfo_t *, void *), struct sigaction &previousAction) {
+  struct sigaction action;
+  std::memset(&action, 0, sizeof(action));
+  action.sa_sigaction = handler;
+  action.sa_flags = SA_SIGINFO | SA_NODEFER;
+  sigemptyset(&action.sa_mask);
+  if (sigaction(signal, &action, &previousAction) != 0) {
+    throw std::runtime_error("Failed to install the trap signal handlers.");
+  }
+}
+
+void installTrapHandlers() {
+  static std::once_flag installed;
+  std::call_once(installed, [] {
+    installSignalHandler(SIGSEGV, &memoryFaultHandler, previousFaultAction);
+    installSignalHandler(SIGTRAP, &breakpointHandler, previousBreakpointAction);
+  });
+}
+
+// x16 holds the entry and x17 the argument buffer while the arguments are loaded
+constexpr uint32_t maxGPRParams = 16U;
+constexpr uint32_t maxFPRParams = 16U;
+
+// compiled code may use every callee-saved GPR (R26/R27 as scratch, R28 for the memory base), the trampoline preserves them for
+// the host
+constexpr TReg calleeSavedPairs[][2] = {{TReg::R19, TReg::R20}, {TReg::R21, TReg::R22}, {TReg::R23, TReg::R24}, {TReg::R25, TReg::R26},
+                                        {TReg::R27, TReg::R28}};
+constexpr int32_t trampolineFrameSize = 16 + static_cast<int32_t>(sizeof(calleeSavedPairs) / sizeof(calleeSavedPairs[0])) * 16;
+
+} // namespace
+
+MachineCode generateTrampoline(const std::string &signature, const ModuleInfo &moduleInfo) {
+  AArch64_Assembler assembler(moduleInfo);
+  assembler.STPPreIndex(TReg::FP, TReg::LR, TReg::SP, -trampolineFrameSize);
+  assembler.moveSpecial1();
+  int32_t offset = 16;
+  for (auto const &pair : calleeSavedPairs) {
+    assembler.STPOffset(pair[0], pair[1], TReg::SP, offset);
+    offset += 16;
+  }
+  assembler.MOVRegister(true, TReg::R16, TReg::R1);
+  assembler.MOVRegister(true, TReg::R17, TReg::R0);
+  assembler.MOVRegister(true, memoryBaseRegister, TReg::R2);
+
+  uint32_t numGPRParams = 0U;
+  uint32_t numFPRParams = 0U;
+  uint32_t slot = 0U;
+  for (size_t i = 1U; (i < signature.size()) && (signature[i] != static_cast<char>(SignatureType::PARAMEND)); ++i) {
+    switch (static_cast<SignatureType>(signature[i])) {
+    case SignatureType::I32:
+    case SignatureType::I64: {
+      if (numGPRParams == maxGPRParams) {
+        throw std::runtime_error("error: too many integer parameters for an invocation trampoline.");
+      }
+      assembler.LDRImmediate(true, static_cast<TReg>(numGPRParams++), TReg::R17, slot * 8U);
+      break;
+    }
+    case SignatureType::F32:
+    case SignatureType::F64: {
+      if (numFPRParams == maxFPRParams) {
+        throw std::runtime_error("error: too many float parameters for an invocation trampoline.");
+      }
+      bool const isDouble = static_cast<SignatureType>(signature[i]) == SignatureType::F64;
+      assembler.LoadStoreImmediate(isDouble ? MemOp::LDRD : MemOp::LDRS, floatRegister(numFPRParams++), TReg::R17, slot * 8U);
+      break;
+    }
+    default: {
+      throw std::runtime_error("error: unknown parameter type in the signature of an invocation trampoline.");
+    }
+    }
+    slot++;
+  }
+
+  assembler.BLR(TReg::R16);
+  // the raw bits of a float result are returned in x0 like every other result
+  SignatureType const resultType = static_cast<SignatureType>(signature.back());
+  if ((resultType == SignatureType::F32) || (resultType == SignatureType::F64)) {
+    assembler.FMOVToGeneral(resultType == SignatureType::F64, TReg::R0, TReg::F0);
+  }
+  offset = 16;
+  for (auto const &pair : calleeSavedPairs) {
+    assembler.LDPOffset(pair[0], pair[1], TReg::SP, offset);
+    offset += 16;
+  }
+  assembler.LDPPostIndex(TReg::FP, TReg::LR, TReg::SP, trampolineFrameSize);
+  assembler.Ret();
+  return assembler.releaseInstructions();
+}
+
+namespace {
+uint32_t countParams(const std::string &signature) {
+  return static_cast<uint32_t>(signature.find(static_cast<char>(SignatureType::PARAMEND)) - 1U);
+}
+} // namespace
+
+Runtime::Runtime(const ModuleInfo &moduleInfo) : codeArena_(moduleInfo.codeArena), functionsNameIndex_(moduleInfo.functionsNameIndex) {
+  if (!codeArena_) {
+    throw std::runtime_error("error: module has to be compiled before it can be invoked.");
+  }
+
+  std::map<std::string, size_t> signatureTrampolines;
+  std::vector<MachineCode> trampolines;
+  for (const ModuleInfo::FunctionInfo &functionInfo : moduleInfo.functionInfos) {
+    const std::string &signature = moduleInfo.signatureTypes[functionInfo.typeIndex];
+    if (signature.find(static_cast<char>(SignatureType::V128)) != std::string::npos) {
+      // a v128 does not fit into a 64 bit slot, such functions are only called from compiled code
+      functionTrampolines_.push_back(noTrampoline);
+      functionNumParams_.push_back(countParams(signature));
+      continue;
+    }
+    auto trampoline = signatureTrampolines.find(signature);
+    if (trampoline == signatureTrampolines.end()) {
+      trampoline = signatureTrampolines.emplace(signature, trampolines.size()).first;
+      trampolines.emplace_back(generateTrampoline(signature, moduleInfo));
+    }
+    functionTrampolines_.push_back(trampoline->second);
+    functionNumParams_.push_back(countParams(signature));
+  }
+  trampolineArena_ = std::make_unique<CodeArena>(trampolines);
+
+  if (moduleInfo.hasMemory) {
+    memory_ = std::make_unique<LinearMemory>(moduleInfo.memoryInitialPages, moduleInfo.memoryMaximumPages);
+    for (const ModuleInfo::DataSegment &segment : moduleInfo.dataSegments) {
+      if (segment.bytes.size() > memory_->size() - std::min(memory_->size(), static_cast<size_t>(segment.offset))) {
+        throw std::runtime_error("error: data segment does not fit into the linear memory.");
+      }
+      std::memcpy(memory_->base() + segment.offset, segment.bytes.data(), segment.bytes.size());
+    }
+  } else if (!moduleInfo.dataSegments.empty()) {
+    throw std::runtime_error("error: data segments without a linear memory.");
+  }
+  installTrapHandlers();
+}
+
+uint64_t Runtime::invoke(size_t const funcIndex, const uint64_t *const args, size_t const numArgs) const {
+  if (funcIndex >= functionTrampolines_.size()) {
+    throw std::out_of_range("error: invoked function index is out of range.");
+  }
+  if (numArgs != functionNumParams_[funcIndex]) {
+    std::stringstream ss;
+    ss << "error: function " << funcIndex << " expects " << functionNumParams_[funcIndex] << " arguments, got " << numArgs;
+    throw std::invalid_argument(ss.str());
+  }
+
+  if (functionTrampolines_[funcIndex] == noTrampoline) {
+    throw std::invalid_argument("error: functions with v128 params or results can not be invoked from the host.");
+  }
+  auto const trampoline = trampolineArena_->function<Trampoline>(functionTrampolines_[funcIndex]);
+  jmp_buf trapTarget;
+  jmp_buf *const previousTarget = activeTrapTarget;
+  LinearMemory const *const previousMemory = activeMemory;
+  CodeArena const *const previousCode = activeCode;
+  activeTrapTarget = &trapTarget;
+  activeMemory = memory_.get();
+  activeCode = codeArena_.get();
+  // setjmp is only defined as the controlling expression of an if, the trap code comes through lastTrapCode
+  if (setjmp(trapTarget) != 0) { // NOLINT(cert-err52-cpp)
+    activeTrapTarget = previousTarget;
+    activeMemory = previousMemory;
+    activeCode = previousCode;
+    throw WasmTrap(lastTrapCode);
+  }
+  uint8_t *const memoryBase = memory_ ? memory_->base() : nullptr;
+  uint64_t const result = trampoline(args, codeArena_->entry(funcIndex), memoryBase);
+  activeTrapTarget = previousTarget;
+  activeMemory = previousMemory;
+  activeCode = previousCode;
+  return result;
+}
+
+size_t Runtime::exportedFunction(const std::string &name) const {
+  auto const found = functionsNameIndex_.find(name);
+  if (found == functionsNameIndex_.end()) {
+    throw std::out_of_range("error: no exported function named " + name);
+  }
+  return found->second;
+}
@@ -0,0 +1,105 @@
+#ifndef RUNTIME_HPP
+#define RUNTIME_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "CodeArena.hpp"
+#include "LinearMemory.hpp"
+#include "ModuleInfo.hpp"
+#include "util.hpp"
+
+///
+/// @brief Thrown by Runtime::invoke when the wasm code trapped
+///
+class WasmTrap final : public std::runtime_error {
+public:
+  explicit WasmTrap(uint32_t const trapCode) : std::runtime_error("wasm trap"), trapCode_(trapCode) {
+  }
+
+  uint32_t trapCode() const {
+    return trapCode_;
+  }
+
+private:
+  uint32_t trapCode_;
+};
+
+///
+/// @brief Invocation trampoline for functions of a signature: uint64_t trampoline(uint64_t const *args, void const *entry, uint8_t *memoryBase).
+/// It preserves the callee-saved registers of the host, so it is the only C ABI entry into compiled code.
+/// @throws std::runtime_error if the signature has a v128 or more parameters of one class than there are argument registers
+MachineCode generateTrampoline(const std::string &signature, const ModuleInfo &moduleInfo);
+
+///
+/// @brief Host entry into a compiled module.
+/// One trampoline per distinct signature string is generated once. A trampoline loads the arguments from a packed buffer of
+/// 64 bit slots into the argument registers, installs the memory base and calls the function entry in the code arena, so an
+/// invocation costs one indirect call instead of generating and mapping a wrapper. Traps arrive as signals: the BRK of a trap
+/// check or a fault in the guard region of the linear memory.
+/// The runtime is the module instance: it owns the linear memory, with the active data segments copied in.
+///
+class Runtime final {
+public:
+  ///
+  /// @param moduleInfo A module that went through compileOpCode, its code arena is shared with the runtime
+  /// @throws std::runtime_error if the module is not compiled or a data segment does not fit into the memory
+  explicit Runtime(const ModuleInfo &moduleInfo);
+
+  ///
+  /// @brief Call a function with its arguments packed into 64 bit slots (i32 and the bits of an f32 in the low half)
+  /// @return Raw result bits, i32 and f32 results in the low half
+  /// @throws WasmTrap if the function trapped
+  /// @throws std::invalid_argument if numArgs does not match or the signature has a v128 (no host representation)
+  uint64_t invoke(size_t funcIndex, const uint64_t *args, size_t numArgs) const;
+
+  uint64_t invoke(size_t const funcIndex, const std::vector<uint64_t> &args) const {
+    return invoke(funcIndex, args.data(), args.size());
+  }
+
+  template <typename... Args> uint64_t invoke(size_t const funcIndex, Args const... args) const {
+    static_assert(std::conjunction<std::is_arithmetic<Args>...>::value, "wasm arguments have to be numbers");
+    uint64_t const packed[sizeof...(Args) + 1U] = {toRawArg(args)...};
+    return invoke(funcIndex, packed, sizeof...(Args));
+  }
+
+  ///
+  /// @brief Index of an exported function
+  /// @throws std::out_of_range if there is no such export
+  size_t exportedFunction(const std::string &name) const;
+
+  ///
+  /// @brief The linear memory of the instance, nullptr if the module has none
+  LinearMemory *memory() const {
+    return memory_.get();
+  }
+
+private:
+  template <typename T> static uint64_t toRawArg(T const value) {
+    if constexpr (std::is_same<T, float>::value) {
+      return bit_cast<uint32_t>(value);
+    } else if constexpr (std::is_same<T, double>::value) {
+      return bit_cast<uint64_t>(value);
+    } else {
+      return static_cast<uint64_t>(value);
+    }
+  }
+
+  using Trampoline = uint64_t (*)(uint64_t const *args, void const *entry, uint8_t *memoryBase);
+
+  std::shared_ptr<CodeArena> codeArena_;
+  std::unique_ptr<CodeArena> trampolineArena_;
+  static constexpr size_t noTrampoline = SIZE_MAX;
+  std::vector<size_t> functionTrampolines_; ///< function index -> trampoline index in trampolineArena_, noTrampoline for v128 signatures
+  std::vector<uint32_t> functionNumParams_;
+  std::map<std::string, size_t> functionsNameIndex_;
+  std::unique_ptr<LinearMemory> memory_;
+};
+
+#endif
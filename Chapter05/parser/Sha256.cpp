@@ -0,0 +1,98 @@
+#include <cstring>
+
+#include "Sha256.hpp"
+
+namespace {
+constexpr uint32_t roundConstants[64] = {
+    0x428A2F98U, 0x71374491U, 0xB5C0FBCFU, 0xE9B5DBA5U, 0x3956C25BU, 0x59F111F1U, 0x923F82A4U, 0xAB1C5ED5U, 0xD807AA98U, 0x12835B01U, 0x243185BEU,
+    0x550C7DC3U, 0x72BE5D74U, 0x80DEB1FEU, 0x9BDC06A7U, 0xC19BF174U, 0xE49B69C1U, 0xEFBE4786U, 0x0FC19DC6U, 0x240CA1CCU, 0x2DE92C6FU, 0x4A7484AAU,
+    0x5CB0A9DCU, 0x76F988DAU, 0x983E5152U, 0xA831C66DU, 0xB00327C8U, 0xBF597FC7U, 0xC6E00BF3U, 0xD5A79147U, 0x06CA6351U, 0x14292967U, 0x27B70A85U,
+    0x2E1B2138U, 0x4D2C6DFCU, 0x53380D13U, 0x650A7354U, 0x766A0ABBU, 0x81C2C92EU, 0x92722C85U, 0xA2BFE8A1U, 0xA81A664BU, 0xC24B8B70U, 0xC76C51A3U,
+    0xD192E819U, 0xD6990624U, 0xF40E3585U, 0x106AA070U, 0x19A4C116U, 0x1E376C08U, 0x2748774CU, 0x34B0BCB5U, 0x391C0CB3U, 0x4ED8AA4AU, 0x5B9CCA4FU,
+    0x682E6FF3U, 0x748F82EEU, 0x78A5636FU, 0x84C87814U, 0x8CC70208U, 0x90BEFFFAU, 0xA4506CEBU, 0xBEF9A3F7U, 0xC67178F2U};
+
+constexpr uint32_t rotateRight(uint32_t const value, uint32_t const count) {
+  return (value >> count) | (value << (32U - count));
+}
+
+// one 64 byte block into the state
+void compressBlock(uint32_t (&state)[8], uint8_t const *const block) {
+  uint32_t w[64];
+  for (uint32_t i = 0U; i < 16U; i++) {
+    w[i] = (static_cast<uint32_t>(block[i * 4U]) << 24U) | (static_cast<uint32_t>(block[i * 4U + 1U]) << 16U) |
+           (static_cast<uint32_t>(block[i * 4U + 2U]) << 8U) | static_cast<uint32_t>(block[i * 4U + 3U]);
+  }
+  for (uint32_t i = 16U; i < 64U; i++) {
+    uint32_t const s0 = rotateRight(w[i - 15U], 7U) ^ rotateRight(w[i - 15U], 18U) ^ (w[i - 15U] >> 3U);
+    uint32_t const s1 = rotateRight(w[i - 2U], 17U) ^ rotateRight(w[i - 2U], 19U) ^ (w[i - 2U] >> 10U);
+    w[i] = w[i - 16U] + s0 + w[i - 7U] + s1;
+  }
+
+  uint32_t a = state[0];
+  uint32_t b = state[1];
+  uint32_t c = state[2];
+  uint32_t d = state[3];
+  uint32_t e = state[4];
+  uint32_t f = state[5];
+  uint32_t g = state[6];
+  uint32_t h = state[7];
+  for (uint32_t i = 0U; i < 64U; i++) {
+    uint32_t const s1 = rotateRight(e, 6U) ^ rotateRight(e, 11U) ^ rotateRight(e, 25U);
+    uint32_t const choice = (e & f) ^ (~e & g);
+    uint32_t const t1 = h + s1 + choice + roundConstants[i] + w[i];
+    uint32_t const s0 = rotateRight(a, 2U) ^ rotateRight(a, 13U) ^ rotateRight(a, 22U);
+    uint32_t const majority = (a & b) ^ (a & c) ^ (b & c);
+    uint32_t const t2 = s0 + majority;
+    h = g;
+    g = f;
+    f = e;
+    e = d + t1;
+    d = c;
+    c = b;
+    b = a;
+    a = t1 + t2;
+  }
+  state[0] += a;
+  state[1] += b;
+  state[2] += c;
+  state[3] += d;
+  state[4] += e;
+  state[5] += f;
+  state[6] += g;
+  state[7] += h;
+}
+} // namespace
+
+Sha256Digest sha256(const ByteSpan &bytes) {
+  uint32_t state[8] = {0x6A09E667U, 0xBB67AE85U, 0x3C6EF372U, 0xA54FF53AU, 0x510E527FU, 0x9B05688CU, 0x1F83D9ABU, 0x5BE0CD19U};
+
+  size_t const numFullBlocks = bytes.size() / 64U;
+  for (size_t i = 0U; i < numFullBlocks; i++) {
+    compressBlock(state, bytes.data() + i * 64U);
+  }
+
+  // the rest, 0x80 and the length in bits as big endian 64 bit number, in one or two blocks
+  uint8_t tail[128] = {};
+  size_t const restSize = bytes.size() - numFullBlocks * 64U;
+  if (restSize > 0U) {
+    std::memcpy(tail, bytes.data() + numFullBlocks * 64U, restSize);
+  }
+  tail[restSize] = 0x80U;
+  size_t const tailSize = (restSize < 56U) ? 64U : 128U;
+  uint64_t const bitLength = static_cast<uint64_t>(bytes.size()) * 8U;
+  for (size_t i = 0U; i < 8U; i++) {
+    tail[tailSize - 1U - i] = static_cast<uint8_t>(bitLength >> (i * 8U));
+  }
+  for (size_t offset = 0U; offset < tailSize; offset += 64U) {
+    compressBlock(state, tail + offset);
+  }
+
+  Sha256Digest digest;
+  for (size_t i = 0U; i < 8U; i++) {
+    digest[i * 4U] = static_cast<uint8_t>(state[i] >> 24U);
+    digest[i * 4U + 1U] = static_cast<uint8_t>(state[i] >> 16U);
+    digest[i * 4U + 2U] = static_cast<uint8_t>(state[i] >> 8U);
+    digest[i * 4U + 3U] = static_cast<uint8_t>(state[i]);
+  }
+  return digest;
+}
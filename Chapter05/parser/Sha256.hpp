@@ -0,0 +1,15 @@
+#ifndef SHA256_HPP
+#define SHA256_HPP
+
+#include <array>
+#include <cstdint>
+
+#include "ByteSpan.hpp"
+
+using Sha256Digest = std::array<uint8_t, 32U>;
+
+///
+/// @brief SHA-256 (FIPS 180-4) of bytes, e.g. to tell apart modules whose cheap hash collides
+Sha256Digest sha256(const ByteSpan &bytes);
+
+#endif
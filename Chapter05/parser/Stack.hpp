@@ -1,39 +1,101 @@
 #pragma once
-#include <iostream>
+#include <cstddef>
+#include <stdexcept>
 #include <vector>
 
+#include "Logger.hpp"
 #include "StackElement.hpp"
 
+///
+/// @brief Operand stack of the compiler backed by borrowed, reusable storage.
+/// The storage (e.g. one buffer per compile thread) keeps its capacity between functions, and it is reserved up front
+/// for the maximum depth of the function. So pushes and pops only move an index and do not allocate in steady state.
+/// Elements are accessed by reference, references stay valid until the element is popped or the reserved depth is exceeded.
+///
 class Stack {
 private:
-  std::vector<StackElement> elements;
+  std::vector<StackElement> &storage_;
+  StackElement *elements_; ///< storage_.data(), used slots are [0, size_), the rest up to capacity_ is reserved
+  std::size_t capacity_;
+  std::size_t size_ = 0U;
+
+  void grow(std::size_t const capacity) {
+    storage_.resize(capacity);
+    elements_ = storage_.data();
+    capacity_ = storage_.size();
+  }
 
 public:
+  ///
+  /// @param storage Buffer to keep the elements in, its previous content is discarded
+  explicit Stack(std::vector<StackElement> &storage) : storage_(storage), elements_(storage.data()), capacity_(storage.size()) {
+  }
+
+  Stack(const Stack &) = delete;
+  Stack &operator=(const Stack &) = delete;
+
+  ///
+  /// @brief Make sure maxDepth elements fit without growing the storage
+  void reserve(std::size_t const maxDepth) {
+    if (capacity_ < maxDepth) {
+      grow(maxDepth);
+    }
+  }
+
   void push(const StackElement &value) {
-    elements.push_back(value);
+    if (size_ == capacity_) {
+      // only reached if the reserved depth was too small
+      grow((size_ < 8U) ? 16U : (size_ * 2U));
+    }
+    elements_[size_++] = value;
   }
 
   void pop() {
-    if (!elements.empty()) {
-      return elements.pop_back();
+    if (size_ != 0U) {
+      size_--;
     } else {
-      std::cerr << "empty stack, can't pop." << std::endl;
+      LOG_ERROR("empty stack, can't pop.");
     }
   }
 
-  StackElement top() const {
-    if (!elements.empty()) {
-      return elements.back();
-    } else {
+  ///
+  /// @brief Pop count elements at once
+  void pop(std::size_t const count) {
+    if (size_ < count) {
+      throw std::out_of_range("stack holds less elements than should be popped.");
+    }
+    size_ -= count;
+  }
+
+  StackElement &top() {
+    return peek(0U);
+  }
+
+  const StackElement &top() const {
+    return peek(0U);
+  }
+
+  ///
+  /// @brief Element depth positions below the top, peek(0) is the top
+  StackElement &peek(std::size_t const depth) {
+    if (depth >= size_) {
+      throw std::out_of_range("empty stack, can't visit stack element.");
+    }
+    return elements_[size_ - 1U - depth];
+  }
+
+  const StackElement &peek(std::size_t const depth) const {
+    if (depth >= size_) {
       throw std::out_of_range("empty stack, can't visit stack element.");
     }
+    return elements_[size_ - 1U - depth];
   }
 
   bool empty() const {
-    return elements.empty();
+    return size_ == 0U;
   }
 
   std::size_t size() const {
-    return elements.size();
+    return size_;
   }
-};
\ No newline at end of file
+};
@@ -73,9 +73,13 @@ public:
   static constexpr uint32_t SCRATCHREGISTER_F64{SCRATCHREGISTER | F64}; ///< float64 in scratch register
   static constexpr uint32_t TEMPSTACK_F64{TEMPSTACK | F64};             ///< float64 in tmp stack
   static constexpr uint32_t CONSTANT_F64{CONSTANT | F64};               ///< float64 const
-  static constexpr uint32_t UNKNOWN{0b1111'0000U};                      ///< unknown
-  static constexpr uint32_t BASEMASK{0b0000'1111U};                     ///< mask of base type
-  static constexpr uint32_t TYPEMASK{0b1111'0000U};                     ///< mask of type(i32/i64/f32/f64)
+
+  static constexpr uint32_t V128{0b1'0000'0000U};                         ///< 128 bit vector, never a constant (v128.const is emitted right away)
+  static constexpr uint32_t SCRATCHREGISTER_V128{SCRATCHREGISTER | V128}; ///< v128 in scratch register
+  static constexpr uint32_t TEMPSTACK_V128{TEMPSTACK | V128};             ///< v128 in tmp stack
+  static constexpr uint32_t UNKNOWN{0b1'1111'0000U};                      ///< unknown
+  static constexpr uint32_t BASEMASK{0b0000'1111U};                       ///< mask of base type
+  static constexpr uint32_t TYPEMASK{0b1'1111'0000U};                     ///< mask of type(i32/i64/f32/f64/v128)
 
   template <typename RHS> inline constexpr StackType operator&(RHS const rhs) const {
     return StackType{this->raw_ & static_cast<uint32_t>(rhs)};
@@ -93,9 +97,20 @@ class StackElement final {
 public:
   StackType type;
 
+  ///
+  /// @brief Instruction of a DEFERREDACTION and the registers of its operands, which keep their value until it is emitted.
+  /// A right operand that fits the immediate field of the instruction is kept as rhsConstant, rhs is NONE then.
+  struct DeferredAction final {
+    OPCode opcode;
+    TReg lhs;
+    TReg rhs;
+    uint64_t rhsConstant;
+  };
+
   union Data {
     OPCode opcode;
     ConstUnion constUnion{};
+    DeferredAction deferred;
   };
 
   class VariableData final {
@@ -181,12 +196,14 @@ public:
   //   return res;
   // }
 
-  // static inline constexpr StackElement action(OPCode const instruction) VB_NOEXCEPT {
-  //   StackElement res{};
-  //   res.type = StackType::DEFERREDACTION;
-  //   res.data.opcode = instruction;
-  //   return res;
-  // }
+  static inline StackElement action(OPCode const instruction, TReg const lhs, TReg const rhs, WasmType const resultType,
+                                    uint64_t const rhsConstant = 0U) {
+    StackElement res{};
+    res.type = StackType::DEFERREDACTION;
+    res.data.deferred = DeferredAction{instruction, lhs, rhs, rhsConstant};
+    res.variableData.location.wasmtype = resultType;
+    return res;
+  }
 };
 
 #endif
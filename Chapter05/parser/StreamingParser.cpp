@@ -0,0 +1,180 @@
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <unistd.h>
+
+#include "Logger.hpp"
+#include "StreamingParser.hpp"
+#include "parser.hpp"
+
+namespace {
+constexpr size_t wasmHeaderSize = 8U;
+constexpr uint8_t wasmMagic[4] = {0x00, 0x61, 0x73, 0x6D};
+constexpr size_t maxULEB128Bytes = 5U;
+constexpr size_t pendingCompactThreshold = 64U * 1024U;
+
+// Whether data[index..] holds a whole ULEB128, overlong encodings count as complete and are rejected by readULEB128
+bool hasCompleteULEB128(const ByteSpan &data, size_t const index) {
+  for (size_t i = index; (i < data.size()) && (i < index + maxULEB128Bytes); ++i) {
+    if ((data[i] & 0x80U) == 0U) {
+      return true;
+    }
+  }
+  return data.size() >= index + maxULEB128Bytes;
+}
+} // namespace
+
+StreamingParser::StreamingParser(bool const compileOnArrival) : compileOnArrival_(compileOnArrival) {
+}
+
+void StreamingParser::feed(const ByteSpan &chunk) {
+  pending_.insert(pending_.end(), chunk.begin(), chunk.end());
+  parsePending();
+  compactPending();
+}
+
+void StreamingParser::parsePending() {
+  ByteSpan const pending{pending_};
+  while (true) {
+    size_t const available = pending.size() - pendingIndex_;
+    switch (state_) {
+    case State::HEADER: {
+      if (available < wasmHeaderSize) {
+        return;
+      }
+      if (std::memcmp(pending.data() + pendingIndex_, wasmMagic, sizeof(wasmMagic)) != 0) {
+        throw std::runtime_error("error: stream is not a wasm module, bad magic number.");
+      }
+      pendingIndex_ += wasmHeaderSize;
+      state_ = State::SECTION_HEADER;
+      break;
+    }
+    case State::SECTION_HEADER: {
+      if ((available < 2U) || !hasCompleteULEB128(pending, pendingIndex_ + 1U)) {
+        return;
+      }
+      sectionType_ = static_cast<WASMSectionType>(pending[pendingIndex_]);
+      size_t contentIndex = pendingIndex_ + 1U;
+      sectionSize_ = readULEB128(pending, contentIndex);
+      if (sectionType_ == WASMSectionType::CODE) {
+        pendingIndex_ = contentIndex;
+        codeSection_ = std::make_shared<std::vector<uint8_t>>();
+        codeSection_->reserve(sectionSize_);
+        moduleInfo_.byteStreamOwner = codeSection_;
+        codeIndex_ = 0U;
+        codeCountRead_ = false;
+        state_ = State::CODE_SECTION;
+      } else {
+        pendingIndex_++; // parseSection reads the size again
+        state_ = State::SECTION_CONTENT;
+      }
+      break;
+    }
+    case State::SECTION_CONTENT: {
+      size_t contentIndex = pendingIndex_;
+      static_cast<void>(readULEB128(pending, contentIndex));
+      if (pending.size() - contentIndex < sectionSize_) {
+        return;
+      }
+      size_t index = pendingIndex_;
+      parseSection(sectionType_, pending, index, moduleInfo_);
+      pendingIndex_ = contentIndex + sectionSize_;
+      state_ = State::SECTION_HEADER;
+      break;
+    }
+    case State::CODE_SECTION: {
+      size_t const take = std::min(static_cast<size_t>(sectionSize_) - codeSection_->size(), available);
+      codeSection_->insert(codeSection_->end(), pending.begin() + pendingIndex_, pending.begin() + pendingIndex_ + take);
+      pendingIndex_ += take;
+      parseCodeSection();
+      if (codeSection_->size() < sectionSize_) {
+        return;
+      }
+      if (!codeCountRead_ || (remainingBodies_ != 0U)) {
+        throw std::runtime_error("error: code section ends before its last function body.");
+      }
+      state_ = State::SECTION_HEADER;
+      break;
+    }
+    }
+  }
+}
+
+void StreamingParser::parseCodeSection() {
+  ByteSpan const code{*codeSection_};
+  if (!codeCountRead_) {
+    if (!hasCompleteULEB128(code, codeIndex_)) {
+      return;
+    }
+    remainingBodies_ = readULEB128(code, codeIndex_);
+    codeCountRead_ = true;
+  }
+
+  while (remainingBodies_ > 0U) {
+    size_t index = codeIndex_;
+    if (!hasCompleteULEB128(code, index)) {
+      return;
+    }
+    uint32_t const functionBodySize = readULEB128(code, index);
+    if (code.size() - index < functionBodySize) {
+      return;
+    }
+    size_t const funcIndex = moduleInfo_.functionsInstructions.size();
+    parseFunctionBody(code, index, functionBodySize, moduleInfo_);
+    codeIndex_ = index;
+    remainingBodies_--;
+
+    if (compileOnArrival_) {
+      if (funcIndex >= moduleInfo_.functionInfos.size()) {
+        throw std::runtime_error("error: function body without a matching function section entry.");
+      }
+      LOG_TRACE("streaming: compile function " << funcIndex << " (" << functionBodySize << " bytes)");
+      compileFunction(moduleInfo_, funcIndex);
+    }
+  }
+}
+
+void StreamingParser::compactPending() {
+  if (pendingIndex_ == pending_.size()) {
+    pending_.clear();
+    pendingIndex_ = 0U;
+  } else if (pendingIndex_ > pendingCompactThreshold) {
+    pending_.erase(pending_.begin(), pending_.begin() + static_cast<std::ptrdiff_t>(pendingIndex_));
+    pendingIndex_ = 0U;
+  }
+}
+
+bool StreamingParser::isComplete() const {
+  return (state_ == State::SECTION_HEADER) && (pendingIndex_ == pending_.size());
+}
+
+ModuleInfo StreamingParser::finish() {
+  if (!isComplete()) {
+    throw std::runtime_error("error: wasm stream ended in the middle of a section.");
+  }
+  LOG_INFO("wasm stream parse end. got ModuleInfo.");
+  if (compileOnArrival_) {
+    compileOpCode(moduleInfo_); // every body is compiled already, only lays out the code arena
+  }
+  return std::move(moduleInfo_);
+}
+
+ModuleInfo processWasmStream(int const fd, bool const compileOnArrival, size_t const chunkSize) {
+  StreamingParser parser(compileOnArrival);
+  std::vector<uint8_t> chunk(chunkSize);
+  while (true) {
+    ssize_t const readBytes = read(fd, chunk.data(), chunk.size());
+    if (readBytes < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      throw std::runtime_error("Failed to read wasm stream.");
+    }
+    if (readBytes == 0) {
+      break;
+    }
+    parser.feed(ByteSpan{chunk.data(), static_cast<size_t>(readBytes)});
+  }
+  return parser.finish();
+}
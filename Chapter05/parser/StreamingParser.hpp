@@ -0,0 +1,66 @@
+#ifndef STREAMINGPARSER_HPP
+#define STREAMINGPARSER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "ByteSpan.hpp"
+#include "ModuleInfo.hpp"
+#include "parser.hpp"
+
+///
+/// @brief Incremental front end for wasm modules that arrive in chunks (pipe, socket, ...).
+/// Sections are parsed as soon as they are complete. Inside the code section every function body is parsed, and optionally
+/// compiled, as soon as its last byte arrived, so compilation overlaps with I/O.
+///
+class StreamingParser final {
+public:
+  ///
+  /// @param compileOnArrival Compile each function body right after it was parsed instead of leaving it to compileOpCode
+  explicit StreamingParser(bool compileOnArrival = true);
+
+  ///
+  /// @brief Consume the next chunk of the module, the chunk does not need to outlive this call
+  /// @throws std::runtime_error on malformed input
+  void feed(const ByteSpan &chunk);
+
+  ///
+  /// @brief Whether the bytes fed so far end exactly at a section boundary
+  bool isComplete() const;
+
+  ///
+  /// @brief Finish the stream and hand out the parsed module, with compileOnArrival it is compiled and its code arena is ready
+  /// @throws std::runtime_error if the stream ended in the middle of the header or a section
+  ModuleInfo finish();
+
+private:
+  enum class State : uint8_t { HEADER, SECTION_HEADER, SECTION_CONTENT, CODE_SECTION };
+
+  void parsePending();
+  void parseCodeSection();
+  void compactPending();
+
+  bool compileOnArrival_;
+  State state_ = State::HEADER;
+  ModuleInfo moduleInfo_;
+
+  std::vector<uint8_t> pending_; ///< bytes received but not consumed yet
+  size_t pendingIndex_ = 0U;     ///< first unconsumed byte in pending_
+  WASMSectionType sectionType_ = WASMSectionType::CUSTOM;
+  uint32_t sectionSize_ = 0U;
+
+  /// Whole code section, reserved to its final size up front so the function body views never move
+  std::shared_ptr<std::vector<uint8_t>> codeSection_;
+  size_t codeIndex_ = 0U;
+  bool codeCountRead_ = false;
+  uint32_t remainingBodies_ = 0U;
+};
+
+///
+/// @brief Read a whole module from a file descriptor (e.g. a pipe or socket) and parse it while it arrives
+/// @param chunkSize Number of bytes requested per read call
+ModuleInfo processWasmStream(int fd, bool compileOnArrival = true, size_t chunkSize = 64U * 1024U);
+
+#endif
@@ -0,0 +1,81 @@
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
+
+#include "WorkStealingPool.hpp"
+
+WorkStealingPool::WorkStealingPool(uint32_t const numThreads) : numThreads_(numThreads) {
+  if (numThreads_ == 0U) {
+    numThreads_ = std::max(1U, std::thread::hardware_concurrency());
+  }
+  for (uint32_t i = 0U; i < numThreads_; ++i) {
+    queues_.emplace_back(std::make_unique<WorkQueue>());
+  }
+}
+
+bool WorkStealingPool::popOwn(uint32_t const workerIndex, size_t &item) {
+  WorkQueue &queue = *queues_[workerIndex];
+  std::lock_guard<std::mutex> const lock(queue.mutex);
+  if (queue.items.empty()) {
+    return false;
+  }
+  item = queue.items.front();
+  queue.items.pop_front();
+  return true;
+}
+
+bool WorkStealingPool::steal(uint32_t const thiefIndex, size_t &item) {
+  for (uint32_t offset = 1U; offset < numThreads_; ++offset) {
+    WorkQueue &victim = *queues_[(thiefIndex + offset) % numThreads_];
+    std::lock_guard<std::mutex> const lock(victim.mutex);
+    if (!victim.items.empty()) {
+      item = victim.items.back();
+      victim.items.pop_back();
+      return true;
+    }
+  }
+  return false;
+}
+
+void WorkStealingPool::run(const std::vector<size_t> &items, const std::function<void(size_t)> &task) {
+  for (size_t i = 0U; i < items.size(); ++i) {
+    queues_[i % numThreads_]->items.push_back(items[i]);
+  }
+
+  std::atomic<bool> failed{false};
+  std::exception_ptr firstError;
+  std::mutex errorMutex;
+
+  auto worker = [&](uint32_t const workerIndex) {
+    size_t item = 0U;
+    while (!failed.load(std::memory_order_relaxed) && (popOwn(workerIndex, item) || steal(workerIndex, item))) {
+      try {
+        task(item);
+      } catch (...) {
+        std::lock_guard<std::mutex> const lock(errorMutex);
+        if (!firstError) {
+          firstError = std::current_exception();
+        }
+        failed.store(true, std::memory_order_relaxed);
+      }
+    }
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(numThreads_ - 1U);
+  for (uint32_t i = 1U; i < numThreads_; ++i) {
+    threads.emplace_back(worker, i);
+  }
+  worker(0U); // the calling thread is worker 0
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+
+  for (const std::unique_ptr<WorkQueue> &queue : queues_) {
+    queue->items.clear();
+  }
+  if (firstError) {
+    std::rethrow_exception(firstError);
+  }
+}
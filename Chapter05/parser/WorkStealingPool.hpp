@@ -0,0 +1,46 @@
+#ifndef WORKSTEALINGPOOL_HPP
+#define WORKSTEALINGPOOL_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+///
+/// @brief Small work-stealing scheduler for independent tasks identified by an index.
+/// Every worker owns a deque, takes work from its front and, once it runs dry, steals from the back of the other deques.
+///
+class WorkStealingPool final {
+public:
+  ///
+  /// @param numThreads Number of workers, 0 selects std::thread::hardware_concurrency()
+  explicit WorkStealingPool(uint32_t numThreads);
+
+  ///
+  /// @brief Run task(item) for every item and block until all of them finished.
+  /// Items are dealt round robin in the given order, so put the most expensive ones first.
+  /// The first exception thrown by a task is rethrown here after all workers stopped.
+  void run(const std::vector<size_t> &items, const std::function<void(size_t)> &task);
+
+  uint32_t numThreads() const {
+    return numThreads_;
+  }
+
+private:
+  class WorkQueue final {
+  public:
+    std::mutex mutex;
+    std::deque<size_t> items;
+  };
+
+  bool popOwn(uint32_t workerIndex, size_t &item);
+  bool steal(uint32_t thiefIndex, size_t &item);
+
+  uint32_t numThreads_;
+  std::vector<std::unique_ptr<WorkQueue>> queues_;
+};
+
+#endif
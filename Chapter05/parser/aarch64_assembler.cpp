@@ -1,40 +1,360 @@
+#include <algorithm>
 #include <iostream>
+#include <stdexcept>
 
 #include "aarch64_assembler.hpp"
 #include "aarch64_common.hpp"
 
-AArch64_Assembler::AArch64_Assembler(ModuleInfo &moduleInfo) : moduleInfo_(moduleInfo) {
+namespace {
+// bit position and width of the pc-relative offset (in instructions) of a branch
+struct BranchOffsetField {
+  uint32_t shift;
+  uint32_t bits;
+};
+
+BranchOffsetField branchOffsetField(uint32_t const instruction) {
+  if ((instruction & 0x7C000000U) == 0x14000000U) { // B, BL
+    return {0U, 26U};
+  }
+  if ((instruction & 0xFF000010U) == 0x54000000U) { // B.cond
+    return {5U, 19U};
+  }
+  if ((instruction & 0x7E000000U) == 0x34000000U) { // CBZ, CBNZ
+    return {5U, 19U};
+  }
+  if ((instruction & 0x7E000000U) == 0x36000000U) { // TBZ, TBNZ
+    return {5U, 14U};
+  }
+  throw std::runtime_error("error: instruction is not a pc-relative branch.");
+}
+
+uint32_t withBranchOffset(uint32_t const instruction, int64_t const offset) {
+  BranchOffsetField const field = branchOffsetField(instruction);
+  int64_t const limit = static_cast<int64_t>(1) << (field.bits - 1U);
+  if ((offset < -limit) || (offset >= limit)) {
+    throw std::runtime_error("error: branch target is out of range.");
+  }
+  uint32_t const mask = ((1U << field.bits) - 1U) << field.shift;
+  return (instruction & ~mask) | ((static_cast<uint32_t>(offset) << field.shift) & mask);
+}
+
+bool isMask(uint64_t const value) {
+  return (value != 0U) && (((value + 1U) & value) == 0U);
+}
+
+// a run of ones, possibly shifted: 0..01..10..0
+bool isShiftedMask(uint64_t const value) {
+  return (value != 0U) && isMask((value - 1U) | value);
+}
+
+uint32_t countTrailingOnes(uint64_t const value) {
+  return (value == ~static_cast<uint64_t>(0U)) ? 64U : static_cast<uint32_t>(__builtin_ctzll(~value));
+}
+
+uint32_t countLeadingOnes(uint64_t const value) {
+  return (value == ~static_cast<uint64_t>(0U)) ? 64U : static_cast<uint32_t>(__builtin_clzll(~value));
+}
+
+///
+/// @brief Multiplier and shift of an unsigned division by a constant that is not a power of two (Hacker's Delight 10-8):
+/// q = mulhu(x, multiplier) >> shift, or if add is set q = (t + ((x - t) >> 1)) >> (shift - 1) with t = mulhu(x, multiplier)
+/// because the exact multiplier needs bits + 1 bits
+struct UnsignedMagic {
+  uint64_t multiplier;
+  uint32_t shift;
+  bool add;
+};
+
+UnsignedMagic unsignedMagic(uint64_t const divisor, uint32_t const bits) {
+  uint64_t const mask = (bits == 64U) ? ~static_cast<uint64_t>(0U) : ((static_cast<uint64_t>(1U) << bits) - 1U);
+  uint64_t const signBit = static_cast<uint64_t>(1U) << (bits - 1U);
+  UnsignedMagic magic{0U, 0U, false};
+  uint64_t const nc = (mask - ((mask + 1U - divisor) & mask) % divisor) & mask;
+  uint32_t p = bits - 1U;
+  uint64_t q1 = signBit / nc;
+  uint64_t r1 = signBit - q1 * nc;
+  uint64_t q2 = (signBit - 1U) / divisor;
+  uint64_t r2 = (signBit - 1U) - q2 * divisor;
+  uint64_t delta;
+  do {
+    p++;
+    if (r1 >= nc - r1) {
+      q1 = (2U * q1 + 1U) & mask;
+      r1 = (2U * r1 - nc) & mask;
+    } else {
+      q1 = (2U * q1) & mask;
+      r1 = (2U * r1) & mask;
+    }
+    if (r2 + 1U >= divisor - r2) {
+      if (q2 >= signBit - 1U) {
+        magic.add = true;
+      }
+      q2 = (2U * q2 + 1U) & mask;
+      r2 = (2U * r2 + 1U - divisor) & mask;
+    } else {
+      if (q2 >= signBit) {
+        magic.add = true;
+      }
+      q2 = (2U * q2) & mask;
+      r2 = (2U * r2 + 1U) & mask;
+    }
+    delta = divisor - 1U - r2;
+  } while ((p < 2U * bits) && ((q1 < delta) || ((q1 == delta) && (r1 == 0U))));
+  magic.multiplier = (q2 + 1U) & mask;
+  magic.shift = p - bits;
+  return magic;
+}
+
+///
+/// @brief Multiplier and shift of a signed division by a constant whose magnitude is not a power of two (Hacker's Delight
+/// 10-1): t = mulhs(x, multiplier), plus x if the divisor is positive and the multiplier negative, minus x for the opposite
+/// signs, q = (t >> shift) + sign bit of (t >> shift)
+struct SignedMagic {
+  uint64_t multiplier;
+  uint32_t shift;
+};
+
+SignedMagic signedMagic(uint64_t const divisor, uint32_t const bits) {
+  uint64_t const mask = (bits == 64U) ? ~static_cast<uint64_t>(0U) : ((static_cast<uint64_t>(1U) << bits) - 1U);
+  uint64_t const signBit = static_cast<uint64_t>(1U) << (bits - 1U);
+  bool const negative = (divisor & signBit) != 0U;
+  uint64_t const ad = negative ? ((0U - divisor) & mask) : divisor;
+  uint64_t const t = signBit + (negative ? 1U : 0U);
+  uint64_t const anc = t - 1U - t % ad;
+  uint32_t p = bits - 1U;
+  uint64_t q1 = signBit / anc;
+  uint64_t r1 = signBit - q1 * anc;
+  uint64_t q2 = signBit / ad;
+  uint64_t r2 = signBit - q2 * ad;
+  uint64_t delta;
+  do {
+    p++;
+    q1 = (2U * q1) & mask;
+    r1 = (2U * r1) & mask;
+    if (r1 >= anc) {
+      q1 = (q1 + 1U) & mask;
+      r1 = (r1 - anc) & mask;
+    }
+    q2 = (2U * q2) & mask;
+    r2 = (2U * r2) & mask;
+    if (r2 >= ad) {
+      q2 = (q2 + 1U) & mask;
+      r2 = (r2 - ad) & mask;
+    }
+    delta = ad - r2;
+  } while ((q1 < delta) || ((q1 == delta) && (r1 == 0U)));
+  uint64_t multiplier = (q2 + 1U) & mask;
+  if (negative) {
+    multiplier = (0U - multiplier) & mask;
+  }
+  return SignedMagic{multiplier, p - bits};
+}
+
+bool isPowerOfTwo(uint64_t const value) {
+  return (value != 0U) && ((value & (value - 1U)) == 0U);
+}
+
+uint32_t branchOffset(uint32_t const instruction) {
+  BranchOffsetField const field = branchOffsetField(instruction);
+  return (instruction >> field.shift) & ((1U << field.bits) - 1U);
+}
+
+// 5 bit register field of an encoding, F0-F31 encode like R0-R31
+uint32_t registerField(TReg const reg) {
+  return static_cast<uint32_t>(reg) & 0x1FU;
+}
+} // namespace
+
+AArch64_Assembler::AArch64_Assembler(const ModuleInfo &moduleInfo) : moduleInfo_(moduleInfo) {
+}
+
+AArch64_Assembler::Label AArch64_Assembler::newLabel() {
+  labels_.emplace_back();
+  return Label{static_cast<uint32_t>(labels_.size() - 1U)};
+}
+
+bool AArch64_Assembler::isBound(Label const label) const {
+  return labels_[label.id_].position >= 0;
+}
+
+void AArch64_Assembler::bind(Label const label) {
+  LabelState &state = labels_[label.id_];
+  assert(state.position < 0 && "label bound twice");
+  state.position = static_cast<int64_t>(instructions_.size());
+  // an unbound branch holds the distance back to the previous branch to the same label, 0 ends the chain
+  int64_t branch = state.lastBranch;
+  while (branch >= 0) {
+    uint32_t const link = branchOffset(instructions_[static_cast<size_t>(branch)]);
+    instructions_[static_cast<size_t>(branch)] = withBranchOffset(instructions_[static_cast<size_t>(branch)], state.position - branch);
+    branch = (link == 0U) ? -1 : (branch - static_cast<int64_t>(link));
+  }
+  state.lastBranch = -1;
+}
+
+void AArch64_Assembler::emitBranch(uint32_t const instruction, Label const label) {
+  LabelState &state = labels_[label.id_];
+  int64_t const current = static_cast<int64_t>(instructions_.size());
+  if (state.position >= 0) {
+    insertInstructionIntoVector(withBranchOffset(instruction, state.position - current), this->instructions_);
+  } else {
+    int64_t const link = (state.lastBranch < 0) ? 0 : (current - state.lastBranch);
+    insertInstructionIntoVector(withBranchOffset(instruction, link), this->instructions_);
+    state.lastBranch = current;
+  }
+}
+
+MachineCode AArch64_Assembler::releaseInstructions() {
+  for (const LabelState &state : labels_) {
+    if (state.lastBranch >= 0) {
+      throw std::runtime_error("error: branch to a label that was never bound.");
+    }
+  }
+  return std::move(instructions_);
+}
+
+void AArch64_Assembler::reserve(size_t const numInstructions) {
+  instructions_.reserve(numInstructions);
 }
 
-void AArch64_Assembler::insertInstructionIntoVector(uint32_t instruction, std::vector<uint8_t> &vec) {
-  vec.push_back(static_cast<uint8_t>(instruction & 0xFFU));
-  vec.push_back(static_cast<uint8_t>((instruction >> 8U) & 0xFFU));
-  vec.push_back(static_cast<uint8_t>((instruction >> 16U) & 0xFFU));
-  vec.push_back(static_cast<uint8_t>((instruction >> 24U) & 0xFFU));
+void AArch64_Assembler::insertInstructionIntoVector(uint32_t instruction, MachineCode &vec) {
+  vec.push_back(instruction);
 }
 void AArch64_Assembler::MOVimm(bool const is64, TReg const reg, uint64_t const imm) {
-  // assert(RegUtil::isGPR(reg) && "Only GPR registers allowed");
-  // uint32_t instruction = 0;
-  // if (!is64) {
-  //   instruction = 0x52800000; // MOVZ Wd, #imm16
-  // } else {
-  //   instruction = 0xD2800000; // MOVZ Xd, #imm16
-  // }
-
-  MOVK(is64, reg, static_cast<uint16_t>(imm & 0xFFFFU), 0);          // 第 0-15 位
-  MOVK(is64, reg, static_cast<uint16_t>((imm >> 16U) & 0xFFFFU), 1); // 第 16-31 位
-  if (is64) {
-    MOVK(is64, reg, static_cast<uint16_t>((imm >> 32U) & 0xFFFFU), 2); // 第 32-47 位
-    MOVK(is64, reg, static_cast<uint16_t>((imm >> 48U) & 0xFFFFU), 3); // 第 48-63 位
+  uint32_t const numHalfwords = is64 ? 4U : 2U;
+  uint64_t const value = is64 ? imm : (imm & 0xFFFFFFFFU);
+  if (!moduleInfo_.immediateSelection) {
+    for (uint32_t hw = 0U; hw < numHalfwords; ++hw) {
+      MOVK(is64, reg, static_cast<uint16_t>(value >> (hw * 16U)), static_cast<uint8_t>(hw));
+    }
+    return;
   }
 
-  // instruction |= (imm16 << 5U);
-  // instruction |= static_cast<uint8_t>(reg);
+  uint32_t numZero = 0U;
+  uint32_t numOnes = 0U;
+  for (uint32_t hw = 0U; hw < numHalfwords; ++hw) {
+    uint16_t const halfword = static_cast<uint16_t>(value >> (hw * 16U));
+    numZero += (halfword == 0U) ? 1U : 0U;
+    numOnes += (halfword == 0xFFFFU) ? 1U : 0U;
+  }
+  // MOVZ (MOVN) sets every halfword to zero (one) and needs a MOVK for each other halfword, at least one instruction anyway
+  bool const inverted = numOnes > numZero;
+  uint32_t const numInstructions = std::max(numHalfwords - std::max(numZero, numOnes), 1U);
+  uint32_t encoding;
+  if ((numInstructions > 1U) && logicalImmediate(is64, value, encoding)) {
+    ORRImmediate(is64, reg, TReg::ZR, value);
+    return;
+  }
 
-  // insertInstructionIntoVector(instruction, this->instructions_);
+  uint16_t const background = inverted ? 0xFFFFU : 0U;
+  bool first = true;
+  for (uint32_t hw = 0U; hw < numHalfwords; ++hw) {
+    uint16_t const halfword = static_cast<uint16_t>(value >> (hw * 16U));
+    bool const last = hw + 1U == numHalfwords;
+    if ((halfword == background) && !(first && last)) {
+      continue;
+    }
+    if (first) {
+      if (inverted) {
+        MOVN(is64, reg, static_cast<uint16_t>(~halfword), static_cast<uint8_t>(hw));
+      } else {
+        MOVZ(is64, reg, halfword, static_cast<uint8_t>(hw));
+      }
+      first = false;
+    } else {
+      MOVK(is64, reg, halfword, static_cast<uint8_t>(hw));
+    }
+  }
 }
+void AArch64_Assembler::MOVZ(bool const is64, TReg const reg, uint16_t const imm16, uint8_t const hw) {
+  uint32_t instruction = is64 ? 0xD2800000U : 0x52800000U;
+  instruction |= (static_cast<uint32_t>(hw) << 21U);
+  instruction |= (static_cast<uint32_t>(imm16) << 5U);
+  instruction |= static_cast<uint8_t>(reg);
+  insertInstructionIntoVector(instruction, this->instructions_);
+}
+void AArch64_Assembler::MOVN(bool const is64, TReg const reg, uint16_t const imm16, uint8_t const hw) {
+  uint32_t instruction = is64 ? 0x92800000U : 0x12800000U;
+  instruction |= (static_cast<uint32_t>(hw) << 21U);
+  instruction |= (static_cast<uint32_t>(imm16) << 5U);
+  instruction |= static_cast<uint8_t>(reg);
+  insertInstructionIntoVector(instruction, this->instructions_);
+}
+bool AArch64_Assembler::logicalImmediate(bool const is64, uint64_t imm, uint32_t &encoding) {
+  uint32_t const regSize = is64 ? 64U : 32U;
+  if (!is64) {
+    imm &= 0xFFFFFFFFU;
+  }
+  if ((imm == 0U) || (imm == (~static_cast<uint64_t>(0U) >> (64U - regSize)))) {
+    return false;
+  }
+  // smallest element size the value is a replication of
+  uint32_t size = regSize;
+  do {
+    size /= 2U;
+    uint64_t const mask = (static_cast<uint64_t>(1U) << size) - 1U;
+    if ((imm & mask) != ((imm >> size) & mask)) {
+      size *= 2U;
+      break;
+    }
+  } while (size > 2U);
 
-// hw = shift , 0 = 0 , 1 = 16 , 2 = 32 , 3 = 48
+  // rotation that turns the element into 0..01..1
+  uint64_t const mask = ~static_cast<uint64_t>(0U) >> (64U - size);
+  uint64_t element = imm & mask;
+  uint32_t rotation;
+  uint32_t numOnes;
+  if (isShiftedMask(element)) {
+    rotation = static_cast<uint32_t>(__builtin_ctzll(element));
+    numOnes = countTrailingOnes(element >> rotation);
+  } else {
+    element |= ~mask;
+    if (!isShiftedMask(~element)) {
+      return false;
+    }
+    uint32_t const leadingOnes = countLeadingOnes(element);
+    rotation = 64U - leadingOnes;
+    numOnes = leadingOnes + countTrailingOnes(element) - (64U - size);
+  }
+  uint32_t const immr = (size - rotation) & (size - 1U);
+  uint64_t const nImms = (~static_cast<uint64_t>(size - 1U) << 1U) | (numOnes - 1U);
+  uint32_t const n = static_cast<uint32_t>((nImms >> 6U) & 1U) ^ 1U;
+  encoding = (n << 12U) | (immr << 6U) | static_cast<uint32_t>(nImms & 0x3FU);
+  return true;
+}
+void AArch64_Assembler::emitLogicalImmediate(uint32_t instruction, bool const is64, TReg const dst, TReg const src, uint64_t const imm) {
+  uint32_t encoding = 0U;
+  bool const encodable = logicalImmediate(is64, imm, encoding);
+  assert(encodable && "not a logical immediate");
+  static_cast<void>(encodable);
+  instruction |= encoding << 10U;
+  instruction |= static_cast<uint32_t>(src) << 5U;
+  instruction |= static_cast<uint32_t>(dst);
+  insertInstructionIntoVector(instruction, this->instructions_);
+}
+void AArch64_Assembler::ANDImmediate(bool const is64, TReg const dst, TReg const src, uint64_t const imm) {
+  emitLogicalImmediate(is64 ? 0x92000000U : 0x12000000U, is64, dst, src, imm);
+}
+void AArch64_Assembler::ORRImmediate(bool const is64, TReg const dst, TReg const src, uint64_t const imm) {
+  emitLogicalImmediate(is64 ? 0xB2000000U : 0x32000000U, is64, dst, src, imm);
+}
+void AArch64_Assembler::EORImmediate(bool const is64, TReg const dst, TReg const src, uint64_t const imm) {
+  emitLogicalImmediate(is64 ? 0xD2000000U : 0x52000000U, is64, dst, src, imm);
+}
+void AArch64_Assembler::emitThreeRegisters(uint32_t instruction, TReg const dst, TReg const first, TReg const second) {
+  instruction |= static_cast<uint32_t>(dst);
+  instruction |= static_cast<uint32_t>(first) << 5U;
+  instruction |= static_cast<uint32_t>(second) << 16U;
+  insertInstructionIntoVector(instruction, this->instructions_);
+}
+void AArch64_Assembler::ANDRegister(bool const is64, TReg const dst, TReg const first, TReg const second) {
+  emitThreeRegisters(is64 ? 0x8A000000U : 0x0A000000U, dst, first, second);
+}
+void AArch64_Assembler::ORRRegister(bool const is64, TReg const dst, TReg const first, TReg const second) {
+  emitThreeRegisters(is64 ? 0xAA000000U : 0x2A000000U, dst, first, second);
+}
+void AArch64_Assembler::EORRegister(bool const is64, TReg const dst, TReg const first, TReg const second) {
+  emitThreeRegisters(is64 ? 0xCA000000U : 0x4A000000U, dst, first, second);
+}
 void AArch64_Assembler::MOVK(bool const is64, TReg const reg, uint16_t const imm16, uint8_t const hw) {
   uint32_t instruction = 0;
   if (!is64) {
@@ -45,19 +365,27 @@ void AArch64_Assembler::MOVK(bool const is64, TReg const reg, uint16_t const imm
   instruction |= (static_cast<uint32_t>(hw) << 21U);
   instruction |= (static_cast<uint32_t>(imm16) << 5U);
   instruction |= static_cast<uint8_t>(reg);
-  if (ifBlockState == 1) {
-    insertInstructionIntoVector(instruction, this->ifBlockInstructions_);
-  } else if (ifBlockState == 2) {
-    insertInstructionIntoVector(instruction, this->elseBlockInstructions_);
-  } else {
-    insertInstructionIntoVector(instruction, this->instructions_);
-  }
+  insertInstructionIntoVector(instruction, this->instructions_);
 }
 
-void AArch64_Assembler::B(uint32_t imm26) {
-  uint32_t instruction = 0x14000000U;
-  instruction |= imm26;
-  insertInstructionIntoVector(instruction, this->instructions_);
+void AArch64_Assembler::CBZ(bool is64, TReg const reg, Label const label) {
+  emitBranch((is64 ? 0xB4000000U : 0x34000000U) | static_cast<uint32_t>(reg), label);
+}
+
+void AArch64_Assembler::CBNZ(bool is64, TReg const reg, Label const label) {
+  emitBranch((is64 ? 0xB5000000U : 0x35000000U) | static_cast<uint32_t>(reg), label);
+}
+
+void AArch64_Assembler::TBZ(TReg const reg, uint32_t const bit, Label const label) {
+  emitBranch(0x36000000U | ((bit & 0x20U) << 26U) | ((bit & 0x1FU) << 19U) | static_cast<uint32_t>(reg), label);
+}
+
+void AArch64_Assembler::TBNZ(TReg const reg, uint32_t const bit, Label const label) {
+  emitBranch(0x37000000U | ((bit & 0x20U) << 26U) | ((bit & 0x1FU) << 19U) | static_cast<uint32_t>(reg), label);
+}
+
+void AArch64_Assembler::B(Label const label) {
+  emitBranch(0x14000000U, label);
 }
 
 void AArch64_Assembler::MOVRegister(bool is64, TReg const dst, TReg const src) {
@@ -80,19 +408,20 @@ void AArch64_Assembler::MOVRegister(bool is64, TReg const dst, TReg const src) {
   insertInstructionIntoVector(instruction, this->instructions_);
 }
 
-void AArch64_Assembler::AddShiftedRegister(bool is64, TReg const first, TReg const second) {
+void AArch64_Assembler::AddShiftedRegister(bool is64, TReg const dst, TReg const first, TReg const second, Shift const shift,
+                                           uint32_t const amount) {
   uint32_t instruction;
   if (is64) {
     instruction = 0x8B000000U;
   } else {
     instruction = 0x0B000000U;
   }
+  instruction |= static_cast<uint32_t>(shift) << 22U;
+  instruction |= amount << 10U;
 
-  uint8_t shift = 0; // to do implement
-  static_cast<void>(shift);
   auto Rn = first;
   auto Rm = second;
-  auto Rd = first;
+  auto Rd = dst;
 
   instruction |= static_cast<uint8_t>(Rd);
   instruction |= static_cast<uint16_t>(static_cast<uint16_t>(Rn) << 5U);
@@ -107,11 +436,37 @@ void AArch64_Assembler::BR(TReg const reg) {
   insertInstructionIntoVector(instruction, this->instructions_);
 }
 
-void AArch64_Assembler::UDIV(bool is64, TReg const first, TReg const second) {
-  CMP(is64, second, 0);
-  Bcon(1, is64 ? 6 : 4); // 和0 不相等就跳过下一条指令, 也就是跳到trap地址
-  MOVimm(is64, TReg::R0, 1);
-  BR(TReg::R28); // trap address
+void AArch64_Assembler::ADR(TReg const dst, int32_t const offset) {
+  if ((offset < -(1 << 20)) || (offset >= (1 << 20))) {
+    throw std::runtime_error("error: ADR offset is out of range.");
+  }
+  uint32_t const imm = static_cast<uint32_t>(offset) & 0x1FFFFFU;
+  insertInstructionIntoVector(0x10000000U | ((imm & 3U) << 29U) | ((imm >> 2U) << 5U) | static_cast<uint32_t>(dst), this->instructions_);
+}
+
+void AArch64_Assembler::AddExtendedRegister(TReg const dst, TReg const first, TReg const second, uint32_t const shift) {
+  // option 010 (UXTW) in bits 15:13, the shift in imm3
+  emitThreeRegisters(0x8B204000U | (shift << 10U), dst, first, second);
+}
+
+void AArch64_Assembler::BLR(TReg const reg) {
+  uint32_t instruction = 0xD63F0000U;
+  instruction |= static_cast<uint16_t>(static_cast<uint16_t>(reg) << 5U);
+  insertInstructionIntoVector(instruction, this->instructions_);
+}
+
+void AArch64_Assembler::BL(int32_t const offset) {
+  if ((offset < -(1 << 27)) || (offset >= (1 << 27))) {
+    throw std::runtime_error("error: BL offset is out of range.");
+  }
+  insertInstructionIntoVector(0x94000000U | ((static_cast<uint32_t>(offset) >> 2U) & 0x3FFFFFFU), this->instructions_);
+}
+
+void AArch64_Assembler::UDIV(bool is64, TReg const dst, TReg const first, TReg const second) {
+  Label const notZero = newLabel();
+  CBNZ(is64, second, notZero); // 和0 不相等就跳过下一条指令, 也就是跳到trap地址
+  Trap(1U);
+  bind(notZero);
   uint32_t instruction;
   if (is64) {
     instruction = 0x9AC00800U;
@@ -121,7 +476,7 @@ void AArch64_Assembler::UDIV(bool is64, TReg const first, TReg const second) {
 
   auto Rn = first;
   auto Rm = second;
-  auto Rd = first;
+  auto Rd = dst;
   instruction |= static_cast<uint8_t>(Rd);
   instruction |= static_cast<uint16_t>(static_cast<uint16_t>(Rn) << 5U);
   instruction |= (static_cast<uint32_t>(Rm) << 16U);
@@ -129,15 +484,16 @@ void AArch64_Assembler::UDIV(bool is64, TReg const first, TReg const second) {
   insertInstructionIntoVector(instruction, this->instructions_);
 }
 
-void AArch64_Assembler::CMP(bool is64, TReg const first, uint16_t imm12) {
+void AArch64_Assembler::CMP(bool is64, TReg const first, uint16_t imm12, bool const shift12) {
   uint32_t instruction;
   if (is64) {
     instruction = 0xF100001FU;
   } else {
     instruction = 0x7100001FU;
   }
-
-  // to do use sh ,current use default 0
+  if (shift12) {
+    instruction |= 1U << 22U;
+  }
 
   auto Rn = first;
   instruction |= static_cast<uint16_t>(static_cast<uint16_t>(Rn) << 5U);
@@ -167,13 +523,16 @@ void AArch64_Assembler::CMP(bool is64, TReg const first, TReg const second) {
   insertInstructionIntoVector(instruction, this->instructions_);
 }
 
-void AArch64_Assembler::CMN(bool is64, TReg const first, uint16_t imm12) {
+void AArch64_Assembler::CMN(bool is64, TReg const first, uint16_t imm12, bool const shift12) {
   uint32_t instruction;
   if (is64) {
     instruction = 0xB100001FU;
   } else {
     instruction = 0x3100001FU;
   }
+  if (shift12) {
+    instruction |= 1U << 22U;
+  }
   auto Rn = first;
   instruction |= static_cast<uint16_t>(static_cast<uint16_t>(Rn) << 5U);
   instruction |= (static_cast<uint32_t>(imm12) << 10U);
@@ -181,14 +540,236 @@ void AArch64_Assembler::CMN(bool is64, TReg const first, uint16_t imm12) {
   insertInstructionIntoVector(instruction, this->instructions_);
 }
 
-void AArch64_Assembler::Bcon(uint8_t const cond, uint32_t offset) {
-  uint32_t instruction = 0x54000000U;
-  instruction |= cond;
-  instruction |= (offset << 5U);
+void AArch64_Assembler::Trap(uint32_t const trapCode) {
+  assert(trapCode <= 0xFFFFU);
+  trapSites_.push_back({static_cast<uint32_t>(instructions_.size()), trapCode});
+  // brk #imm16, the code is only there for a debugger, the runtime takes it from the trap sites
+  insertInstructionIntoVector(0xD4200000U | (trapCode << 5U), this->instructions_);
+}
+
+void AArch64_Assembler::SREM(bool is64, TReg const dst, TReg const first, TReg const second) {
+  Label const notZero = newLabel();
+  CBNZ(is64, second, notZero);
+  Trap(1U);
+  bind(notZero);
+  // the quotient of the minimum value by -1 does not fault and leaves a remainder of 0, as wasm wants it
+  emitThreeRegisters(is64 ? 0x9AC00C00U : 0x1AC00C00U, TReg::R26, first, second);
+  MSUB(is64, dst, TReg::R26, second, first);
+}
+
+void AArch64_Assembler::UREM(bool is64, TReg const dst, TReg const first, TReg const second) {
+  Label const notZero = newLabel();
+  CBNZ(is64, second, notZero);
+  Trap(1U);
+  bind(notZero);
+  emitThreeRegisters(is64 ? 0x9AC00800U : 0x1AC00800U, TReg::R26, first, second);
+  MSUB(is64, dst, TReg::R26, second, first);
+}
+
+void AArch64_Assembler::MSUB(bool is64, TReg const dst, TReg const first, TReg const second, TReg const acc) {
+  uint32_t instruction = is64 ? 0x9B008000U : 0x1B008000U;
+  instruction |= static_cast<uint32_t>(acc) << 10U;
+  emitThreeRegisters(instruction, dst, first, second);
+}
+
+void AArch64_Assembler::UMULL(TReg const dst, TReg const first, TReg const second) {
+  emitThreeRegisters(0x9BA07C00U, dst, first, second);
+}
+
+void AArch64_Assembler::SMULL(TReg const dst, TReg const first, TReg const second) {
+  emitThreeRegisters(0x9B207C00U, dst, first, second);
+}
+
+void AArch64_Assembler::UMULH(TReg const dst, TReg const first, TReg const second) {
+  emitThreeRegisters(0x9BC07C00U, dst, first, second);
+}
+
+void AArch64_Assembler::SMULH(TReg const dst, TReg const first, TReg const second) {
+  emitThreeRegisters(0x9B407C00U, dst, first, second);
+}
+
+void AArch64_Assembler::emitMagicQuotient(bool is64, bool isSigned, TReg const dst, TReg const first, uint64_t const divisor) {
+  uint32_t const bits = is64 ? 64U : 32U;
+  if (!isSigned) {
+    UnsignedMagic const magic = unsignedMagic(divisor, bits);
+    MOVimm(is64, TReg::R26, magic.multiplier);
+    if (is64) {
+      UMULH(TReg::R26, first, TReg::R26);
+    } else if (!magic.add) {
+      UMULL(TReg::R26, first, TReg::R26);
+      LSRImmediate(true, dst, TReg::R26, 32U + magic.shift); // the quotient has no bits above 32
+      return;
+    } else {
+      UMULL(TReg::R26, first, TReg::R26);
+      LSRImmediate(true, TReg::R26, TReg::R26, 32U);
+    }
+    if (!magic.add) {
+      LSRImmediate(is64, dst, TReg::R26, magic.shift);
+      return;
+    }
+    SubShiftedRegister(is64, TReg::R27, first, TReg::R26);
+    AddShiftedRegister(is64, TReg::R26, TReg::R26, TReg::R27, Shift::LSR, 1U);
+    LSRImmediate(is64, dst, TReg::R26, magic.shift - 1U);
+    return;
+  }
+
+  SignedMagic const magic = signedMagic(divisor, bits);
+  uint64_t const signBit = static_cast<uint64_t>(1U) << (bits - 1U);
+  bool const negativeDivisor = (divisor & signBit) != 0U;
+  bool const negativeMultiplier = (magic.multiplier & signBit) != 0U;
+  bool const correct = negativeDivisor != negativeMultiplier;
+  MOVimm(is64, TReg::R26, magic.multiplier);
+  if (is64) {
+    SMULH(TReg::R26, first, TReg::R26);
+  } else {
+    SMULL(TReg::R26, first, TReg::R26);
+    // without a correction the shift can be folded into taking the upper half
+    ASRImmediate(true, TReg::R26, TReg::R26, correct ? 32U : (32U + magic.shift));
+  }
+  if (correct) {
+    if (negativeDivisor) {
+      SubShiftedRegister(is64, TReg::R26, TReg::R26, first);
+    } else {
+      AddShiftedRegister(is64, TReg::R26, TReg::R26, first);
+    }
+  }
+  if ((is64 || correct) && (magic.shift != 0U)) {
+    ASRImmediate(is64, TReg::R26, TReg::R26, magic.shift);
+  }
+  // round towards zero: add one for negative quotients
+  AddShiftedRegister(is64, dst, TReg::R26, TReg::R26, Shift::LSR, bits - 1U);
+}
+
+void AArch64_Assembler::UDIVConstant(bool is64, TReg const dst, TReg const first, uint64_t const divisor) {
+  if (isPowerOfTwo(divisor)) {
+    LSRImmediate(is64, dst, first, static_cast<uint32_t>(__builtin_ctzll(divisor)));
+    return;
+  }
+  emitMagicQuotient(is64, false, dst, first, divisor);
+}
+
+void AArch64_Assembler::SDIVConstant(bool is64, TReg const dst, TReg const first, uint64_t const divisor) {
+  uint32_t const bits = is64 ? 64U : 32U;
+  uint64_t const mask = is64 ? ~static_cast<uint64_t>(0U) : 0xFFFFFFFFU;
+  uint64_t const signBit = static_cast<uint64_t>(1U) << (bits - 1U);
+  bool const negative = (divisor & signBit) != 0U;
+  uint64_t const magnitude = negative ? ((0U - divisor) & mask) : divisor;
+  if (magnitude == 1U) {
+    if (!negative) {
+      MOVRegister(is64, dst, first);
+      return;
+    }
+    // only the minimum value overflows, first - 1 overflows for it as well
+    Label const noOverflow = newLabel();
+    CMP(is64, first, 1);
+    Bcon(CC::VC, noOverflow);
+    Trap(2U);
+    bind(noOverflow);
+    SubShiftedRegister(is64, dst, TReg::ZR, first);
+    return;
+  }
+  if (!isPowerOfTwo(magnitude)) {
+    emitMagicQuotient(is64, true, dst, first, divisor);
+    return;
+  }
+  // (first + (first < 0 ? magnitude - 1 : 0)) >> k
+  uint32_t const k = static_cast<uint32_t>(__builtin_ctzll(magnitude));
+  ASRImmediate(is64, TReg::R26, first, bits - 1U);
+  AddShiftedRegister(is64, TReg::R26, first, TReg::R26, Shift::LSR, bits - k);
+  ASRImmediate(is64, dst, TReg::R26, k);
+  if (negative) {
+    SubShiftedRegister(is64, dst, TReg::ZR, dst);
+  }
+}
+
+void AArch64_Assembler::UREMConstant(bool is64, TReg const dst, TReg const first, uint64_t const divisor) {
+  if (divisor == 1U) {
+    MOVimm(is64, dst, 0U);
+    return;
+  }
+  if (isPowerOfTwo(divisor)) {
+    ANDImmediate(is64, dst, first, divisor - 1U);
+    return;
+  }
+  emitMagicQuotient(is64, false, TReg::R26, first, divisor);
+  MOVimm(is64, TReg::R27, divisor);
+  MSUB(is64, dst, TReg::R26, TReg::R27, first);
+}
+
+void AArch64_Assembler::SREMConstant(bool is64, TReg const dst, TReg const first, uint64_t const divisor) {
+  uint32_t const bits = is64 ? 64U : 32U;
+  uint64_t const mask = is64 ? ~static_cast<uint64_t>(0U) : 0xFFFFFFFFU;
+  uint64_t const signBit = static_cast<uint64_t>(1U) << (bits - 1U);
+  uint64_t const magnitude = ((divisor & signBit) != 0U) ? ((0U - divisor) & mask) : divisor;
+  if (magnitude == 1U) {
+    MOVimm(is64, dst, 0U);
+    return;
+  }
+  if (!isPowerOfTwo(magnitude)) {
+    emitMagicQuotient(is64, true, TReg::R26, first, divisor);
+    MOVimm(is64, TReg::R27, divisor);
+    MSUB(is64, dst, TReg::R26, TReg::R27, first);
+    return;
+  }
+  // first - ((first + bias) & -magnitude), the remainder takes the sign of the dividend
+  uint32_t const k = static_cast<uint32_t>(__builtin_ctzll(magnitude));
+  ASRImmediate(is64, TReg::R26, first, bits - 1U);
+  AddShiftedRegister(is64, TReg::R26, first, TReg::R26, Shift::LSR, bits - k);
+  ANDImmediate(is64, TReg::R26, TReg::R26, (0U - magnitude) & mask);
+  SubShiftedRegister(is64, dst, first, TReg::R26);
+}
+
+void AArch64_Assembler::LSLV(bool is64, TReg const dst, TReg const first, TReg const second) {
+  emitThreeRegisters(is64 ? 0x9AC02000U : 0x1AC02000U, dst, first, second);
+}
+
+void AArch64_Assembler::LSRV(bool is64, TReg const dst, TReg const first, TReg const second) {
+  emitThreeRegisters(is64 ? 0x9AC02400U : 0x1AC02400U, dst, first, second);
+}
+
+void AArch64_Assembler::ASRV(bool is64, TReg const dst, TReg const first, TReg const second) {
+  emitThreeRegisters(is64 ? 0x9AC02800U : 0x1AC02800U, dst, first, second);
+}
+
+void AArch64_Assembler::emitBitfieldMove(uint32_t instruction, TReg const dst, TReg const src, uint32_t const immr, uint32_t const imms) {
+  instruction |= immr << 16U;
+  instruction |= imms << 10U;
+  instruction |= static_cast<uint32_t>(src) << 5U;
+  instruction |= static_cast<uint32_t>(dst);
+  insertInstructionIntoVector(instruction, this->instructions_);
+}
+
+void AArch64_Assembler::LSLImmediate(bool is64, TReg const dst, TReg const src, uint32_t const shift) {
+  // ubfm  dst, src, #(-shift mod width), #(width - 1 - shift)
+  uint32_t const width = is64 ? 64U : 32U;
+  emitBitfieldMove(is64 ? 0xD3400000U : 0x53000000U, dst, src, (width - shift) & (width - 1U), width - 1U - shift);
+}
+
+void AArch64_Assembler::LSRImmediate(bool is64, TReg const dst, TReg const src, uint32_t const shift) {
+  // ubfm  dst, src, #shift, #(width - 1)
+  emitBitfieldMove(is64 ? 0xD3400000U : 0x53000000U, dst, src, shift, is64 ? 63U : 31U);
+}
+
+void AArch64_Assembler::ASRImmediate(bool is64, TReg const dst, TReg const src, uint32_t const shift) {
+  // sbfm  dst, src, #shift, #(width - 1)
+  emitBitfieldMove(is64 ? 0x93400000U : 0x13000000U, dst, src, shift, is64 ? 63U : 31U);
+}
+
+void AArch64_Assembler::CSET(TReg const dst, CC const cond) {
+  // csinc  wd, wzr, wzr, invert(cond)
+  uint32_t instruction = 0x1A9F07E0U;
+  instruction |= (static_cast<uint32_t>(cond) ^ 1U) << 12U;
+  instruction |= static_cast<uint32_t>(dst);
   insertInstructionIntoVector(instruction, this->instructions_);
 }
 
-void AArch64_Assembler::SDIV(bool is64, TReg const first, TReg const second) {
+void AArch64_Assembler::Bcon(CC const cond, Label const label) {
+  uint32_t instruction = 0x54000000U;
+  instruction |= static_cast<uint32_t>(cond);
+  emitBranch(instruction, label);
+}
+
+void AArch64_Assembler::SDIV(bool is64, TReg const dst, TReg const first, TReg const second, bool const checkOverflow) {
   uint32_t instruction;
   if (is64) {
     instruction = 0x9AC00C00U;
@@ -196,23 +777,34 @@ void AArch64_Assembler::SDIV(bool is64, TReg const first, TReg const second) {
     instruction = 0x1AC00C00U;
   }
 
-  CMP(is64, second, 0);
-  Bcon(1, is64 ? 6 : 4); // 和0 不相等就跳过下一条指令,继续判断是否是first最大值 或者-1
-  MOVimm(is64, TReg::R0, 1);
-  BR(TReg::R28); // trigger trap
+  Label const notZero = newLabel();
+  Label const noOverflow = newLabel();
+  CBNZ(is64, second, notZero); // 和0 不相等就跳过下一条指令,继续判断是否是first最大值 或者-1
+  Trap(1U);
 
-  MOVimm(is64, TReg::R26, is64 ? 18446744073709551615U : 4294967295U);
-  CMP(is64, second, TReg::R26); // 被除数不能是-1
-  Bcon(1, is64 ? 12 : 8);       // 和-1不相等就跳过所有去执行除法， 否则继续判断除数
-  MOVimm(is64, TReg::R27, is64 ? 0x8000000000000000U : 0x80000000U);
-  CMP(is64, first, TReg::R27);
-  Bcon(1, is64 ? 6 : 4);
-  MOVimm(is64, TReg::R0, 2);
-  BR(TReg::R28); // trap address
+  bind(notZero);
+  if (checkOverflow) {
+    if (moduleInfo_.immediateSelection) {
+      CMN(is64, second, 1);     // second == -1
+      Bcon(CC::NE, noOverflow);
+      CMP(is64, first, 1);      // first - 1 overflows only for the minimum value
+      Bcon(CC::VC, noOverflow);
+    } else {
+      MOVimm(is64, TReg::R26, is64 ? 18446744073709551615U : 4294967295U);
+      CMP(is64, second, TReg::R26); // 被除数不能是-1
+      Bcon(CC::NE, noOverflow);     // 和-1不相等就跳过所有去执行除法， 否则继续判断除数
+      MOVimm(is64, TReg::R27, is64 ? 0x8000000000000000U : 0x80000000U);
+      CMP(is64, first, TReg::R27);
+      Bcon(CC::NE, noOverflow);
+    }
+    Trap(2U);
+  }
+
+  bind(noOverflow);
 
   auto Rn = first;
   auto Rm = second;
-  auto Rd = first;
+  auto Rd = dst;
   instruction |= static_cast<uint8_t>(Rd);
   instruction |= static_cast<uint16_t>(static_cast<uint16_t>(Rn) << 5U);
   instruction |= (static_cast<uint32_t>(Rm) << 16U);
@@ -220,19 +812,20 @@ void AArch64_Assembler::SDIV(bool is64, TReg const first, TReg const second) {
   insertInstructionIntoVector(instruction, this->instructions_);
 }
 
-void AArch64_Assembler::SubShiftedRegister(bool is64, TReg const first, TReg const second) {
+void AArch64_Assembler::SubShiftedRegister(bool is64, TReg const dst, TReg const first, TReg const second, Shift const shift,
+                                           uint32_t const amount) {
   uint32_t instruction;
   if (is64) {
     instruction = 0xCB000000U;
   } else {
     instruction = 0x4B000000U;
   }
+  instruction |= static_cast<uint32_t>(shift) << 22U;
+  instruction |= amount << 10U;
 
-  uint8_t shift = 0; // to do implement
-  static_cast<void>(shift);
   auto Rn = first;
   auto Rm = second;
-  auto Rd = first;
+  auto Rd = dst;
 
   instruction |= static_cast<uint8_t>(Rd);
   instruction |= static_cast<uint16_t>(static_cast<uint16_t>(Rn) << 5U);
@@ -255,7 +848,7 @@ void AArch64_Assembler::Sxtw(TReg const dst, TReg const src) {
   insertInstructionIntoVector(instruction, this->instructions_);
 }
 
-void AArch64_Assembler::Multiply(bool is64, TReg const first, TReg const second) {
+void AArch64_Assembler::Multiply(bool is64, TReg const dst, TReg const first, TReg const second) {
   uint32_t instruction = 0x9B007C00U;
   if (is64) {
     instruction = 0x9B007C00U;
@@ -267,7 +860,7 @@ void AArch64_Assembler::Multiply(bool is64, TReg const first, TReg const second)
   static_cast<void>(shift);
   auto Rn = first;
   auto Rm = second;
-  auto Rd = first;
+  auto Rd = dst;
 
   instruction |= static_cast<uint8_t>(Rd);
   instruction |= static_cast<uint16_t>(static_cast<uint16_t>(Rn) << 5U);
@@ -276,6 +869,401 @@ void AArch64_Assembler::Multiply(bool is64, TReg const first, TReg const second)
   insertInstructionIntoVector(instruction, this->instructions_);
 }
 
+void AArch64_Assembler::emitRegisterPair(uint32_t instruction, TReg const rt1, TReg const rt2, TReg const rn, int32_t const offset) {
+  assert((offset % 8) == 0 && offset >= -512 && offset <= 504);
+  if (isFloatRegister(rt1)) {
+    instruction ^= 0xC4000000U; // opc 01 and V: 64 bit D registers
+  }
+  instruction |= (static_cast<uint32_t>(offset / 8) & 0x7FU) << 15U;
+  instruction |= registerField(rt2) << 10U;
+  instruction |= static_cast<uint32_t>(rn) << 5U;
+  instruction |= registerField(rt1);
+  insertInstructionIntoVector(instruction, this->instructions_);
+}
+
+void AArch64_Assembler::STPPreIndex(TReg const rt1, TReg const rt2, TReg const rn, int32_t const offset) {
+  emitRegisterPair(0xA9800000U, rt1, rt2, rn, offset);
+}
+
+void AArch64_Assembler::LDPPostIndex(TReg const rt1, TReg const rt2, TReg const rn, int32_t const offset) {
+  emitRegisterPair(0xA8C00000U, rt1, rt2, rn, offset);
+}
+
+void AArch64_Assembler::STPOffset(TReg const rt1, TReg const rt2, TReg const rn, int32_t const offset) {
+  emitRegisterPair(0xA9000000U, rt1, rt2, rn, offset);
+}
+
+void AArch64_Assembler::LDPOffset(TReg const rt1, TReg const rt2, TReg const rn, int32_t const offset) {
+  emitRegisterPair(0xA9400000U, rt1, rt2, rn, offset);
+}
+
+void AArch64_Assembler::LDRImmediate(bool is64, TReg const rt, TReg const rn, uint32_t const offset) {
+  uint32_t const scale = is64 ? 8U : 4U;
+  assert((offset % scale) == 0 && (offset / scale) < 4096U);
+  uint32_t instruction = is64 ? 0xF9400000U : 0xB9400000U;
+  instruction |= (offset / scale) << 10U;
+  instruction |= static_cast<uint32_t>(rn) << 5U;
+  instruction |= static_cast<uint32_t>(rt);
+  insertInstructionIntoVector(instruction, this->instructions_);
+}
+
+void AArch64_Assembler::ADDImmediate(bool is64, TReg const dst, TReg const src, uint32_t const imm12, bool const shift12) {
+  assert(imm12 < 4096U);
+  uint32_t instruction = is64 ? 0x91000000U : 0x11000000U;
+  instruction |= (shift12 ? 1U : 0U) << 22U;
+  instruction |= imm12 << 10U;
+  instruction |= static_cast<uint32_t>(src) << 5U;
+  instruction |= static_cast<uint32_t>(dst);
+  insertInstructionIntoVector(instruction, this->instructions_);
+}
+void AArch64_Assembler::SUBImmediate(bool is64, TReg const dst, TReg const src, uint32_t const imm12, bool const shift12) {
+  assert(imm12 < 4096U);
+  uint32_t instruction = is64 ? 0xD1000000U : 0x51000000U;
+  instruction |= (shift12 ? 1U : 0U) << 22U;
+  instruction |= imm12 << 10U;
+  instruction |= static_cast<uint32_t>(src) << 5U;
+  instruction |= static_cast<uint32_t>(dst);
+  insertInstructionIntoVector(instruction, this->instructions_);
+}
+void AArch64_Assembler::STRImmediate(bool is64, TReg const rt, TReg const rn, uint32_t const offset) {
+  uint32_t const scale = is64 ? 8U : 4U;
+  assert((offset % scale) == 0 && (offset / scale) < 4096U);
+  uint32_t instruction = is64 ? 0xF9000000U : 0xB9000000U;
+  instruction |= (offset / scale) << 10U;
+  instruction |= static_cast<uint32_t>(rn) << 5U;
+  instruction |= static_cast<uint32_t>(rt);
+  insertInstructionIntoVector(instruction, this->instructions_);
+}
+
+void AArch64_Assembler::LoadStoreImmediate(MemOp const op, TReg const rt, TReg const rn, uint32_t const offset) {
+  uint32_t const scale = accessSize(op);
+  assert((offset % scale) == 0 && (offset / scale) < 4096U);
+  uint32_t instruction = 0x39000000U | static_cast<uint32_t>(op);
+  instruction |= (offset / scale) << 10U;
+  instruction |= static_cast<uint32_t>(rn) << 5U;
+  instruction |= registerField(rt);
+  insertInstructionIntoVector(instruction, this->instructions_);
+}
+
+void AArch64_Assembler::LoadStoreUnscaled(MemOp const op, TReg const rt, TReg const rn, int32_t const offset) {
+  assert(offset >= -256 && offset <= 255);
+  uint32_t instruction = 0x38000000U | static_cast<uint32_t>(op);
+  instruction |= (static_cast<uint32_t>(offset) & 0x1FFU) << 12U;
+  instruction |= static_cast<uint32_t>(rn) << 5U;
+  instruction |= registerField(rt);
+  insertInstructionIntoVector(instruction, this->instructions_);
+}
+
+void AArch64_Assembler::LoadStoreRegister(MemOp const op, TReg const rt, TReg const rn, TReg const rm, bool const extendW) {
+  // option 010 (UXTW) or 011 (LSL) in bits 15:13, no scaling of the index
+  uint32_t instruction = 0x38200800U | static_cast<uint32_t>(op) | ((extendW ? 0b010U : 0b011U) << 13U);
+  instruction |= static_cast<uint32_t>(rm) << 16U;
+  instruction |= static_cast<uint32_t>(rn) << 5U;
+  instruction |= registerField(rt);
+  insertInstructionIntoVector(instruction, this->instructions_);
+}
+
+void AArch64_Assembler::BFXIL(bool is64, TReg const dst, TReg const src, uint32_t const lsb, uint32_t const width) {
+  // bfm  dst, src, #lsb, #(lsb + width - 1)
+  emitBitfieldMove(is64 ? 0xB3400000U : 0x33000000U, dst, src, lsb, lsb + width - 1U);
+}
+
+void AArch64_Assembler::emitFloat(uint32_t instruction, bool isDouble, TReg const dst, TReg const first, TReg const second) {
+  instruction |= (isDouble ? 1U : 0U) << 22U;
+  if (second != TReg::NONE) {
+    instruction |= registerField(second) << 16U;
+  }
+  instruction |= registerField(first) << 5U;
+  instruction |= registerField(dst);
+  insertInstructionIntoVector(instruction, this->instructions_);
+}
+
+void AArch64_Assembler::emitFloatConversion(uint32_t instruction, bool isDouble, bool is64, TReg const dst, TReg const src) {
+  instruction |= (is64 ? 1U : 0U) << 31U;
+  emitFloat(instruction, isDouble, dst, src);
+}
+
+void AArch64_Assembler::FMOVRegister(bool isDouble, TReg const dst, TReg const src) {
+  emitFloat(0x1E204000U, isDouble, dst, src);
+}
+
+void AArch64_Assembler::FMOVToGeneral(bool isDouble, TReg const dst, TReg const src) {
+  emitFloatConversion(0x1E260000U, isDouble, isDouble, dst, src);
+}
+
+void AArch64_Assembler::FMOVFromGeneral(bool isDouble, TReg const dst, TReg const src) {
+  emitFloatConversion(0x1E270000U, isDouble, isDouble, dst, src);
+}
+
+void AArch64_Assembler::FMOVimm(bool isDouble, TReg const dst, uint64_t const bits) {
+  if (bits == 0U) {
+    FMOVFromGeneral(isDouble, dst, TReg::ZR);
+    return;
+  }
+  // imm8 = a:b:cdefgh is the float a:NOT(b):b..b:cd:efgh:0..0 with 5 (single) or 8 (double) copies of b
+  uint32_t const exponentCopies = isDouble ? 8U : 5U;
+  uint32_t const fractionZeros = isDouble ? 48U : 19U;
+  uint32_t const signBit = isDouble ? 63U : 31U;
+  uint64_t const copies = (bits >> (fractionZeros + 6U)) & ((static_cast<uint64_t>(1U) << exponentCopies) - 1U);
+  uint64_t const b = copies & 1U;
+  bool const encodable = ((bits & ((static_cast<uint64_t>(1U) << fractionZeros) - 1U)) == 0U) &&
+                         (copies == ((b != 0U) ? ((static_cast<uint64_t>(1U) << exponentCopies) - 1U) : 0U)) &&
+                         (((bits >> (signBit - 1U)) & 1U) != b);
+  if (!moduleInfo_.immediateSelection || !encodable) {
+    MOVimm(isDouble, TReg::R26, bits);
+    FMOVFromGeneral(isDouble, dst, TReg::R26);
+    return;
+  }
+  uint32_t const imm8 = static_cast<uint32_t>((((bits >> signBit) & 1U) << 7U) | (b << 6U) | ((bits >> fractionZeros) & 0x3FU));
+  emitFloat(0x1E201000U | (imm8 << 13U), isDouble, dst, static_cast<TReg>(0U));
+}
+
+void AArch64_Assembler::FADD(bool isDouble, TReg const dst, TReg const first, TReg const second) {
+  emitFloat(0x1E202800U, isDouble, dst, first, second);
+}
+
+void AArch64_Assembler::FSUB(bool isDouble, TReg const dst, TReg const first, TReg const second) {
+  emitFloat(0x1E203800U, isDouble, dst, first, second);
+}
+
+void AArch64_Assembler::FMUL(bool isDouble, TReg const dst, TReg const first, TReg const second) {
+  emitFloat(0x1E200800U, isDouble, dst, first, second);
+}
+
+void AArch64_Assembler::FDIV(bool isDouble, TReg const dst, TReg const first, TReg const second) {
+  emitFloat(0x1E201800U, isDouble, dst, first, second);
+}
+
+void AArch64_Assembler::FMIN(bool isDouble, TReg const dst, TReg const first, TReg const second) {
+  emitFloat(0x1E205800U, isDouble, dst, first, second);
+}
+
+void AArch64_Assembler::FMAX(bool isDouble, TReg const dst, TReg const first, TReg const second) {
+  emitFloat(0x1E204800U, isDouble, dst, first, second);
+}
+
+void AArch64_Assembler::FABS(bool isDouble, TReg const dst, TReg const src) {
+  emitFloat(0x1E20C000U, isDouble, dst, src);
+}
+
+void AArch64_Assembler::FNEG(bool isDouble, TReg const dst, TReg const src) {
+  emitFloat(0x1E214000U, isDouble, dst, src);
+}
+
+void AArch64_Assembler::FSQRT(bool isDouble, TReg const dst, TReg const src) {
+  emitFloat(0x1E21C000U, isDouble, dst, src);
+}
+
+void AArch64_Assembler::FRINTN(bool isDouble, TReg const dst, TReg const src) {
+  emitFloat(0x1E244000U, isDouble, dst, src);
+}
+
+void AArch64_Assembler::FRINTP(bool isDouble, TReg const dst, TReg const src) {
+  emitFloat(0x1E24C000U, isDouble, dst, src);
+}
+
+void AArch64_Assembler::FRINTM(bool isDouble, TReg const dst, TReg const src) {
+  emitFloat(0x1E254000U, isDouble, dst, src);
+}
+
+void AArch64_Assembler::FRINTZ(bool isDouble, TReg const dst, TReg const src) {
+  emitFloat(0x1E25C000U, isDouble, dst, src);
+}
+
+void AArch64_Assembler::FCVT(bool toDouble, TReg const dst, TReg const src) {
+  // the type field is the source precision, opc (bits 16:15) the destination one
+  emitFloat(toDouble ? 0x1E22C000U : 0x1E224000U, !toDouble, dst, src);
+}
+
+void AArch64_Assembler::FCOPYSIGN(bool isDouble, TReg const dst, TReg const first, TReg const second) {
+  FMOVToGeneral(isDouble, TReg::R26, second);
+  FMOVToGeneral(isDouble, TReg::R27, first);
+  BFXIL(isDouble, TReg::R26, TReg::R27, 0U, isDouble ? 63U : 31U);
+  FMOVFromGeneral(isDouble, dst, TReg::R26);
+}
+
+void AArch64_Assembler::FCMP(bool isDouble, TReg const first, TReg const second) {
+  emitFloat(0x1E202000U, isDouble, static_cast<TReg>(0U), first, second);
+}
+
+void AArch64_Assembler::FCMPZero(bool isDouble, TReg const first) {
+  emitFloat(0x1E202008U, isDouble, static_cast<TReg>(0U), first);
+}
+
+void AArch64_Assembler::SCVTF(bool isDouble, bool is64, TReg const dst, TReg const src) {
+  emitFloatConversion(0x1E220000U, isDouble, is64, dst, src);
+}
+
+void AArch64_Assembler::UCVTF(bool isDouble, bool is64, TReg const dst, TReg const src) {
+  emitFloatConversion(0x1E230000U, isDouble, is64, dst, src);
+}
+
+void AArch64_Assembler::FCVTZS(bool isDouble, bool is64, TReg const dst, TReg const src) {
+  emitFloatConversion(0x1E380000U, isDouble, is64, dst, src);
+}
+
+void AArch64_Assembler::FCVTZU(bool isDouble, bool is64, TReg const dst, TReg const src) {
+  emitFloatConversion(0x1E390000U, isDouble, is64, dst, src);
+}
+
+void AArch64_Assembler::MSRFPSR(TReg const src) {
+  insertInstructionIntoVector(0xD51B4420U | static_cast<uint32_t>(src), this->instructions_);
+}
+
+void AArch64_Assembler::MRSFPSR(TReg const dst) {
+  insertInstructionIntoVector(0xD53B4420U | static_cast<uint32_t>(dst), this->instructions_);
+}
+
+void AArch64_Assembler::TruncateToInteger(bool isSigned, bool isDouble, bool is64, TReg const dst, TReg const src) {
+  Label const done = newLabel();
+  Label const notANumber = newLabel();
+  // only IOC is cleared for the conversion, the caller's FPSR is restored afterwards
+  MRSFPSR(TReg::R27);
+  ANDImmediate(false, TReg::R26, TReg::R27, ~1U);
+  MSRFPSR(TReg::R26);
+  if (isSigned) {
+    FCVTZS(isDouble, is64, dst, src);
+  } else {
+    FCVTZU(isDouble, is64, dst, src);
+  }
+  MRSFPSR(TReg::R26);
+  MSRFPSR(TReg::R27);
+  TBZ(TReg::R26, 0U, done); // IOC
+  FCMP(isDouble, src, src);
+  Bcon(CC::VS, notANumber);
+  Trap(2U);
+  bind(notANumber);
+  Trap(4U);
+  bind(done);
+}
+
+void AArch64_Assembler::Vector(VectorOp const op, Lanes const lanes, TReg const dst, TReg const first, TReg const second) {
+  uint32_t instruction = static_cast<uint32_t>(op) | (static_cast<uint32_t>(lanes) << 22U);
+  if (second != TReg::NONE) {
+    instruction |= registerField(second) << 16U;
+  }
+  instruction |= registerField(first) << 5U;
+  instruction |= registerField(dst);
+  insertInstructionIntoVector(instruction, this->instructions_);
+}
+
+void AArch64_Assembler::VectorFloat(VectorOp const op, bool isDouble, TReg const dst, TReg const first, TReg const second) {
+  emitFloat(static_cast<uint32_t>(op), isDouble, dst, first, second);
+}
+
+void AArch64_Assembler::MOVVector(TReg const dst, TReg const src) {
+  Vector(VectorOp::ORR, Lanes::B16, dst, src, src);
+}
+
+void AArch64_Assembler::MOVIZero(TReg const dst) {
+  insertInstructionIntoVector(0x6F00E400U | registerField(dst), this->instructions_);
+}
+
+void AArch64_Assembler::emitLaneAccess(uint32_t instruction, Lanes const lanes, TReg const dst, TReg const src, uint32_t const index) {
+  uint32_t const size = static_cast<uint32_t>(lanes);
+  assert(index < (16U >> size));
+  // the lowest set bit is the lane size, the index is above it
+  instruction |= ((index << (size + 1U)) | (1U << size)) << 16U;
+  instruction |= registerField(src) << 5U;
+  instruction |= registerField(dst);
+  insertInstructionIntoVector(instruction, this->instructions_);
+}
+
+void AArch64_Assembler::DUPGeneral(Lanes const lanes, TReg const dst, TReg const src) {
+  emitLaneAccess(0x4E000C00U, lanes, dst, src, 0U);
+}
+
+void AArch64_Assembler::DUPElement(Lanes const lanes, TReg const dst, TReg const src, uint32_t const index) {
+  emitLaneAccess(0x4E000400U, lanes, dst, src, index);
+}
+
+void AArch64_Assembler::DUPScalar(Lanes const lanes, TReg const dst, TReg const src, uint32_t const index) {
+  emitLaneAccess(0x5E000400U, lanes, dst, src, index);
+}
+
+void AArch64_Assembler::INSGeneral(Lanes const lanes, TReg const dst, uint32_t const index, TReg const src) {
+  emitLaneAccess(0x4E001C00U, lanes, dst, src, index);
+}
+
+void AArch64_Assembler::INSElement(Lanes const lanes, TReg const dst, uint32_t const dstIndex, TReg const src, uint32_t const srcIndex) {
+  emitLaneAccess(0x6E000400U | ((srcIndex << static_cast<uint32_t>(lanes)) << 11U), lanes, dst, src, dstIndex);
+}
+
+void AArch64_Assembler::UMOV(Lanes const lanes, TReg const dst, TReg const src, uint32_t const index) {
+  emitLaneAccess((lanes == Lanes::D2) ? 0x4E003C00U : 0x0E003C00U, lanes, dst, src, index);
+}
+
+void AArch64_Assembler::SMOV(Lanes const lanes, TReg const dst, TReg const src, uint32_t const index) {
+  assert((lanes == Lanes::B16) || (lanes == Lanes::H8));
+  emitLaneAccess(0x0E002C00U, lanes, dst, src, index);
+}
+
+void AArch64_Assembler::emitVectorShift(uint32_t instruction, TReg const dst, TReg const src, uint32_t const immhImmb) {
+  instruction |= immhImmb << 16U;
+  instruction |= registerField(src) << 5U;
+  instruction |= registerField(dst);
+  insertInstructionIntoVector(instruction, this->instructions_);
+}
+
+void AArch64_Assembler::SHLVector(Lanes const lanes, TReg const dst, TReg const src, uint32_t const shift) {
+  uint32_t const laneBits = 8U << static_cast<uint32_t>(lanes);
+  assert(shift < laneBits);
+  emitVectorShift(0x4F005400U, dst, src, laneBits + shift);
+}
+
+void AArch64_Assembler::SSHRVector(Lanes const lanes, TReg const dst, TReg const src, uint32_t const shift) {
+  uint32_t const laneBits = 8U << static_cast<uint32_t>(lanes);
+  assert((shift >= 1U) && (shift <= laneBits));
+  emitVectorShift(0x4F000400U, dst, src, 2U * laneBits - shift);
+}
+
+void AArch64_Assembler::USHRVector(Lanes const lanes, TReg const dst, TReg const src, uint32_t const shift) {
+  uint32_t const laneBits = 8U << static_cast<uint32_t>(lanes);
+  assert((shift >= 1U) && (shift <= laneBits));
+  emitVectorShift(0x6F000400U, dst, src, 2U * laneBits - shift);
+}
+
+void AArch64_Assembler::SSHLL(Lanes const lanes, bool const upperHalf, TReg const dst, TReg const src) {
+  assert(lanes != Lanes::D2);
+  emitVectorShift(upperHalf ? 0x4F00A400U : 0x0F00A400U, dst, src, 8U << static_cast<uint32_t>(lanes));
+}
+
+void AArch64_Assembler::USHLL(Lanes const lanes, bool const upperHalf, TReg const dst, TReg const src) {
+  assert(lanes != Lanes::D2);
+  emitVectorShift(upperHalf ? 0x6F00A400U : 0x2F00A400U, dst, src, 8U << static_cast<uint32_t>(lanes));
+}
+
+void AArch64_Assembler::EXT(TReg const dst, TReg const first, TReg const second, uint32_t const index) {
+  assert(index < 16U);
+  uint32_t instruction = 0x6E000000U;
+  instruction |= registerField(second) << 16U;
+  instruction |= index << 11U;
+  instruction |= registerField(first) << 5U;
+  instruction |= registerField(dst);
+  insertInstructionIntoVector(instruction, this->instructions_);
+}
+
+void AArch64_Assembler::ADDPScalar(TReg const dst, TReg const src) {
+  insertInstructionIntoVector(0x5EF1B800U | (registerField(src) << 5U) | registerField(dst), this->instructions_);
+}
+
+void AArch64_Assembler::emitVectorPair(uint32_t instruction, TReg const rt1, TReg const rt2, TReg const rn, int32_t const offset) {
+  assert((offset % 16) == 0 && offset >= -1024 && offset <= 1008);
+  instruction |= (static_cast<uint32_t>(offset / 16) & 0x7FU) << 15U;
+  instruction |= registerField(rt2) << 10U;
+  instruction |= static_cast<uint32_t>(rn) << 5U;
+  instruction |= registerField(rt1);
+  insertInstructionIntoVector(instruction, this->instructions_);
+}
+
+void AArch64_Assembler::STPVectorPreIndex(TReg const rt1, TReg const rt2, TReg const rn, int32_t const offset) {
+  emitVectorPair(0xAD800000U, rt1, rt2, rn, offset);
+}
+
+void AArch64_Assembler::LDPVectorPostIndex(TReg const rt1, TReg const rt2, TReg const rn, int32_t const offset) {
+  emitVectorPair(0xACC00000U, rt1, rt2, rn, offset);
+}
+
 void AArch64_Assembler::stpSpecial1() {
   uint32_t instruction = 0xA9BF7BFD;
   insertInstructionIntoVector(instruction, this->instructions_);
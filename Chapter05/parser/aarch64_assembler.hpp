@@ -1,3 +1,6 @@
+#ifndef AARCH64_ASSEMBLER_HPP
+#define AARCH64_ASSEMBLER_HPP
+
 #include <cstdint>
 #include <iostream>
 #include <sys/mman.h>
@@ -8,9 +11,38 @@
 
 class AArch64_Assembler {
 public:
-  explicit AArch64_Assembler(ModuleInfo &moduleInfo);
+  ///
+  /// @brief Branch target inside the function being assembled, created unbound and bound to a position exactly once.
+  /// Branches to a label that is not bound yet are chained through their own offset fields and patched by bind, so
+  /// forward branches need no side table and no instruction is moved.
+  class Label final {
+  public:
+    Label() = default;
+
+  private:
+    friend class AArch64_Assembler;
+    explicit Label(uint32_t const id) : id_(id) {
+    }
+    uint32_t id_ = UINT32_MAX;
+  };
+
+  explicit AArch64_Assembler(const ModuleInfo &moduleInfo);
+
+  ///
+  /// @brief Size the instruction buffer up front, so emitting does not reallocate while the estimate holds
+  void reserve(size_t numInstructions);
+
+  ///
+  /// @brief Load an immediate with the shortest sequence: a single ORR of a bitmask immediate, or MOVZ/MOVN followed by a MOVK
+  /// for every remaining halfword (only the MOVK sequence of every halfword if immediate selection is off)
   void MOVimm(bool const is64, TReg const reg, uint64_t const imm);
 
+  // movz  reg, #imm16, lsl #(16 * hw)
+  void MOVZ(bool const is64, TReg const reg, uint16_t const imm16, uint8_t const hw);
+
+  // movn  reg, #imm16, lsl #(16 * hw)
+  void MOVN(bool const is64, TReg const reg, uint16_t const imm16, uint8_t const hw);
+
   inline void MOVimm32(TReg const reg, uint32_t const imm) {
     MOVimm(false, reg, static_cast<uint64_t>(imm));
   }
@@ -21,26 +53,145 @@ public:
     MOVimm(true, reg, imm);
   }
 
-  void AddShiftedRegister(bool is64, TReg const first, TReg const second);
+  // dst = first + (second <shift> #amount)
+  void AddShiftedRegister(bool is64, TReg const dst, TReg const first, TReg const second, Shift const shift = Shift::LSL,
+                          uint32_t const amount = 0U);
+
+  // dst = first - (second <shift> #amount)
+  void SubShiftedRegister(bool is64, TReg const dst, TReg const first, TReg const second, Shift const shift = Shift::LSL,
+                          uint32_t const amount = 0U);
+
+  // dst = first * second
+  void Multiply(bool is64, TReg const dst, TReg const first, TReg const second);
+
+  // dst = first / second (unsigned), traps on a zero divisor
+  void UDIV(bool is64, TReg const dst, TReg const first, TReg const second);
+
+  // dst = first / second (signed), traps on a zero divisor and, if checkOverflow, on overflow
+  void SDIV(bool is64, TReg const dst, TReg const first, TReg const second, bool const checkOverflow = true);
+
+  // dst = first % second (signed), traps on a zero divisor. The quotient goes through R26.
+  void SREM(bool is64, TReg const dst, TReg const first, TReg const second);
+
+  // dst = first % second (unsigned), traps on a zero divisor. The quotient goes through R26.
+  void UREM(bool is64, TReg const dst, TReg const first, TReg const second);
+
+  // dst = acc - first * second
+  void MSUB(bool is64, TReg const dst, TReg const first, TReg const second, TReg const acc);
+
+  // xd = wn * wm, unsigned 32 x 32 -> 64 bit
+  void UMULL(TReg const dst, TReg const first, TReg const second);
 
-  void SubShiftedRegister(bool is64, TReg const first, TReg const second);
+  // xd = wn * wm, signed 32 x 32 -> 64 bit
+  void SMULL(TReg const dst, TReg const first, TReg const second);
 
-  void Multiply(bool is64, TReg const first, TReg const second);
+  // xd = upper 64 bits of the unsigned 128 bit product xn * xm
+  void UMULH(TReg const dst, TReg const first, TReg const second);
 
-  void UDIV(bool is64, TReg const first, TReg const second);
+  // xd = upper 64 bits of the signed 128 bit product xn * xm
+  void SMULH(TReg const dst, TReg const first, TReg const second);
 
-  void SDIV(bool is64, TReg const first, TReg const second);
+  ///
+  /// @brief dst = first / divisor (unsigned) for a constant divisor other than 0, without a division instruction and without
+  /// trap checks: a shift for powers of two, else a multiply-high by a magic number and shifts (Granlund/Montgomery).
+  /// Uses R26 and R27.
+  void UDIVConstant(bool is64, TReg const dst, TReg const first, uint64_t const divisor);
 
-  void CMP(bool is64, TReg const first, uint16_t imm12);
+  ///
+  /// @brief dst = first / divisor (signed) for a constant divisor other than 0, like UDIVConstant. The powers of two round
+  /// towards zero with a bias for negative dividends. Only the divisor -1 keeps the overflow check. Uses R26.
+  void SDIVConstant(bool is64, TReg const dst, TReg const first, uint64_t const divisor);
+
+  ///
+  /// @brief dst = first % divisor (unsigned) for a constant divisor other than 0: an AND for powers of two, else
+  /// first - quotient * divisor. Uses R26 and R27.
+  void UREMConstant(bool is64, TReg const dst, TReg const first, uint64_t const divisor);
+
+  ///
+  /// @brief dst = first % divisor (signed) for a constant divisor other than 0, never traps. Uses R26 and R27.
+  void SREMConstant(bool is64, TReg const dst, TReg const first, uint64_t const divisor);
+
+  // dst = first << second, the shift count is taken modulo the register width like in wasm
+  void LSLV(bool is64, TReg const dst, TReg const first, TReg const second);
+
+  // dst = first >> second (logical)
+  void LSRV(bool is64, TReg const dst, TReg const first, TReg const second);
+
+  // dst = first >> second (arithmetic)
+  void ASRV(bool is64, TReg const dst, TReg const first, TReg const second);
+
+  // lsl  dst, src, #shift  (shift below the register width)
+  void LSLImmediate(bool is64, TReg const dst, TReg const src, uint32_t const shift);
+
+  // lsr  dst, src, #shift
+  void LSRImmediate(bool is64, TReg const dst, TReg const src, uint32_t const shift);
+
+  // asr  dst, src, #shift
+  void ASRImmediate(bool is64, TReg const dst, TReg const src, uint32_t const shift);
+
+  // cset  wd, cond  (1 if cond holds, 0 otherwise)
+  void CSET(TReg const dst, CC const cond);
+
+  // cmp  first, #imm12{, lsl #12}
+  void CMP(bool is64, TReg const first, uint16_t imm12, bool const shift12 = false);
   // cmp shifted register
   void CMP(bool is64, TReg const first, TReg const second);
 
-  void CMN(bool is64, TReg const first, uint16_t imm12);
+  // cmn  first, #imm12{, lsl #12}
+  void CMN(bool is64, TReg const first, uint16_t imm12, bool const shift12 = false);
+
+  ///
+  /// @brief Raise trapCode (1 is a division by zero, 2 an integer overflow, 3 an out of bounds memory access, which is raised by
+  /// the fault handler of the runtime and never emitted, 4 an invalid conversion to integer): a single BRK #trapCode, recorded in
+  /// trapSites
+  void Trap(uint32_t const trapCode);
+
+  ///
+  /// @brief The traps emitted so far, in ascending instruction order
+  const std::vector<ModuleInfo::TrapSite> &trapSites() const {
+    return trapSites_;
+  }
+
+  Label newLabel();
+
+  ///
+  /// @brief Bind label to the position of the next emitted instruction and patch every branch that already targets it
+  void bind(Label const label);
+
+  bool isBound(Label const label) const;
 
-  void Bcon(uint8_t const cond, uint32_t offset);
+  // b.cond label
+  void Bcon(CC const cond, Label const label);
+
+  // b label
+  void B(Label const label);
+
+  // cbz reg, label: branch if reg is zero
+  void CBZ(bool is64, TReg const reg, Label const label);
+
+  // cbnz reg, label: branch if reg is not zero
+  void CBNZ(bool is64, TReg const reg, Label const label);
+
+  // tbz reg, #bit, label: branch if the bit is zero
+  void TBZ(TReg const reg, uint32_t const bit, Label const label);
+
+  // tbnz reg, #bit, label: branch if the bit is one
+  void TBNZ(TReg const reg, uint32_t const bit, Label const label);
 
   void BR(TReg const reg);
 
+  // adr xd, #offset: xd = address of this instruction + offset (bytes, within +-1 MiB)
+  void ADR(TReg const dst, int32_t const offset);
+
+  // xd = xn + (uxtw(wm) << shift), the extended register form of ADD
+  void AddExtendedRegister(TReg const dst, TReg const first, TReg const second, uint32_t const shift);
+
+  // branch with link to register
+  void BLR(TReg const reg);
+
+  // bl #offset: call the instruction offset bytes away (within +-128 MiB)
+  void BL(int32_t const offset);
+
   void Sxtw(TReg const dst, TReg const src);
 
   // stp  x29, x30, [sp, -16]!
@@ -55,46 +206,288 @@ public:
   // bl imm28 = 3
   void blSpecial1();
 
+  // stp  rt1, rt2, [rn, #offset]!  (X or D registers, offset multiple of 8 in [-512, 504])
+  void STPPreIndex(TReg const rt1, TReg const rt2, TReg const rn, int32_t const offset);
+
+  // ldp  rt1, rt2, [rn], #offset  (X or D registers, offset multiple of 8 in [-512, 504])
+  void LDPPostIndex(TReg const rt1, TReg const rt2, TReg const rn, int32_t const offset);
+
+  // stp  rt1, rt2, [rn, #offset]  (X or D registers, offset multiple of 8 in [-512, 504])
+  void STPOffset(TReg const rt1, TReg const rt2, TReg const rn, int32_t const offset);
+
+  // ldp  rt1, rt2, [rn, #offset]  (X or D registers, offset multiple of 8 in [-512, 504])
+  void LDPOffset(TReg const rt1, TReg const rt2, TReg const rn, int32_t const offset);
+
+  // ldr  rt, [rn, #offset]  (unsigned offset, multiple of the access size)
+  void LDRImmediate(bool is64, TReg const rt, TReg const rn, uint32_t const offset);
+
+  // str  rt, [rn, #offset]  (unsigned offset, multiple of the access size)
+  void STRImmediate(bool is64, TReg const rt, TReg const rn, uint32_t const offset);
+
+  // bytes op accesses: 1, 2, 4, 8 or 16
+  static uint32_t accessSize(MemOp const op) {
+    if ((static_cast<uint32_t>(op) & 0x04800000U) == 0x04800000U) { // Q registers have opc 1x
+      return 16U;
+    }
+    return 1U << (static_cast<uint32_t>(op) >> 30U);
+  }
+
+  // op  rt, [rn, #offset]  (unsigned offset, multiple of the access size and below 4096 times it)
+  void LoadStoreImmediate(MemOp const op, TReg const rt, TReg const rn, uint32_t const offset);
+
+  // op  rt, [rn, #offset]  (LDUR/STUR forms, offset in [-256, 255])
+  void LoadStoreUnscaled(MemOp const op, TReg const rt, TReg const rn, int32_t const offset);
+
+  // op  rt, [rn, wm, uxtw] if extendW, op  rt, [rn, xm] otherwise
+  void LoadStoreRegister(MemOp const op, TReg const rt, TReg const rn, TReg const rm, bool const extendW);
+
+  ///
+  /// @brief Encode imm as the N:immr:imms field of a logical (bitmask) immediate
+  /// @return false if imm is not a replicated, rotated run of ones (0 and all ones never are)
+  static bool logicalImmediate(bool is64, uint64_t imm, uint32_t &encoding);
+
+  // and  dst, src, #imm  (imm has to be a logical immediate)
+  void ANDImmediate(bool is64, TReg const dst, TReg const src, uint64_t const imm);
+
+  // orr  dst, src, #imm  (imm has to be a logical immediate, src 31 is ZR)
+  void ORRImmediate(bool is64, TReg const dst, TReg const src, uint64_t const imm);
+
+  // eor  dst, src, #imm  (imm has to be a logical immediate)
+  void EORImmediate(bool is64, TReg const dst, TReg const src, uint64_t const imm);
+
+  // dst = first & second
+  void ANDRegister(bool is64, TReg const dst, TReg const first, TReg const second);
+
+  // dst = first | second
+  void ORRRegister(bool is64, TReg const dst, TReg const first, TReg const second);
+
+  // dst = first ^ second
+  void EORRegister(bool is64, TReg const dst, TReg const first, TReg const second);
+
+  // add  dst, src, #imm12{, lsl #12}  (register 31 is SP)
+  void ADDImmediate(bool is64, TReg const dst, TReg const src, uint32_t const imm12, bool const shift12 = false);
+
+  // sub  dst, src, #imm12{, lsl #12}  (register 31 is SP)
+  void SUBImmediate(bool is64, TReg const dst, TReg const src, uint32_t const imm12, bool const shift12 = false);
+
   // only support mov register to register
   void MOVRegister(bool is64, TReg const dst, TReg const src);
 
-  void Ret();
+  // bfxil  dst, src, #lsb, #width: copy bits [lsb, lsb + width) of src into the low bits of dst, the others are kept
+  void BFXIL(bool is64, TReg const dst, TReg const src, uint32_t const lsb, uint32_t const width);
 
-  void B(uint32_t imm26);
+  // The float instructions work on S registers, or on D registers if isDouble
 
-  void notifyIfBlock() {
-    ifBlockState = 1;
-  }
+  // fmov  dst, src
+  void FMOVRegister(bool isDouble, TReg const dst, TReg const src);
 
-  void notifyElseBlock() {
-    ifBlockState = 2;
-  }
+  // fmov  wd, sn / xd, dn: the raw bits of the float
+  void FMOVToGeneral(bool isDouble, TReg const dst, TReg const src);
 
-  void notifyIfEnd() {
-    notifyIfBlockEnd();
-  }
+  // fmov  sd, wn / dd, xn  (src 31 is ZR)
+  void FMOVFromGeneral(bool isDouble, TReg const dst, TReg const src);
+
+  ///
+  /// @brief Load the float with the raw bits: an FMOV from ZR for +0.0, a single FMOV of an 8 bit immediate where it fits, else
+  /// MOVimm into R26 and an FMOV from there
+  void FMOVimm(bool isDouble, TReg const dst, uint64_t const bits);
+
+  // dst = first + second
+  void FADD(bool isDouble, TReg const dst, TReg const first, TReg const second);
+
+  // dst = first - second
+  void FSUB(bool isDouble, TReg const dst, TReg const first, TReg const second);
+
+  // dst = first * second
+  void FMUL(bool isDouble, TReg const dst, TReg const first, TReg const second);
+
+  // dst = first / second
+  void FDIV(bool isDouble, TReg const dst, TReg const first, TReg const second);
+
+  // dst = min(first, second), NaN if either is NaN and -0.0 below +0.0 like wasm
+  void FMIN(bool isDouble, TReg const dst, TReg const first, TReg const second);
+
+  // dst = max(first, second), NaN if either is NaN and +0.0 above -0.0 like wasm
+  void FMAX(bool isDouble, TReg const dst, TReg const first, TReg const second);
+
+  // dst = |src|
+  void FABS(bool isDouble, TReg const dst, TReg const src);
+
+  // dst = -src
+  void FNEG(bool isDouble, TReg const dst, TReg const src);
+
+  // dst = sqrt(src)
+  void FSQRT(bool isDouble, TReg const dst, TReg const src);
+
+  // dst = src rounded to the nearest integral value, ties to even
+  void FRINTN(bool isDouble, TReg const dst, TReg const src);
+
+  // dst = src rounded towards +infinity
+  void FRINTP(bool isDouble, TReg const dst, TReg const src);
+
+  // dst = src rounded towards -infinity
+  void FRINTM(bool isDouble, TReg const dst, TReg const src);
+
+  // dst = src rounded towards zero
+  void FRINTZ(bool isDouble, TReg const dst, TReg const src);
+
+  // fcvt  dd, sn if toDouble, fcvt  sd, dn otherwise
+  void FCVT(bool toDouble, TReg const dst, TReg const src);
+
+  ///
+  /// @brief dst = the magnitude of first with the sign of second, through the general purpose registers R26 and R27
+  void FCOPYSIGN(bool isDouble, TReg const dst, TReg const first, TReg const second);
+
+  // fcmp  first, second: an unordered comparison (a NaN operand) sets C and V
+  void FCMP(bool isDouble, TReg const first, TReg const second);
+
+  // fcmp  first, #0.0
+  void FCMPZero(bool isDouble, TReg const first);
+
+  // scvtf  dst, src: the signed integer in a W register (X if is64) to the nearest float
+  void SCVTF(bool isDouble, bool is64, TReg const dst, TReg const src);
+
+  // ucvtf  dst, src: the unsigned integer in a W register (X if is64) to the nearest float
+  void UCVTF(bool isDouble, bool is64, TReg const dst, TReg const src);
+
+  // fcvtzs  dst, src: the float truncated to a signed W (X if is64), saturated, NaN is 0
+  void FCVTZS(bool isDouble, bool is64, TReg const dst, TReg const src);
+
+  // fcvtzu  dst, src: the float truncated to an unsigned W (X if is64), saturated, NaN is 0
+  void FCVTZU(bool isDouble, bool is64, TReg const dst, TReg const src);
+
+  ///
+  /// @brief dst = src truncated towards zero to a W (X if is64) register like the trunc conversions of wasm: traps with 4 on NaN
+  /// and with 2 if the value does not fit. The conversion itself flags both in the cumulative invalid operation bit of FPSR,
+  /// which is cleared before and read into R26 after it. The other FPSR bits are kept, the whole register is saved in R27 and
+  /// restored after the conversion.
+  void TruncateToInteger(bool isSigned, bool isDouble, bool is64, TReg const dst, TReg const src);
+
+  // msr  fpsr, src
+  void MSRFPSR(TReg const src);
+
+  // mrs  dst, fpsr
+  void MRSFPSR(TReg const dst);
+
+  // The vector instructions work on all 128 bits of the registers F0-F31 (V0-V31)
+
+  // op  dst.<lanes>, first.<lanes>, second.<lanes>  (second is left out if NONE)
+  void Vector(VectorOp const op, Lanes const lanes, TReg const dst, TReg const first, TReg const second = TReg::NONE);
+
+  // op  dst.4s, first.4s, second.4s  (.2d if isDouble, second is left out if NONE)
+  void VectorFloat(VectorOp const op, bool isDouble, TReg const dst, TReg const first, TReg const second = TReg::NONE);
+
+  // mov  dst.16b, src.16b
+  void MOVVector(TReg const dst, TReg const src);
+
+  // movi  dst.2d, #0
+  void MOVIZero(TReg const dst);
 
-  std::vector<uint8_t> getInstructions() {
+  // dup  dst.<lanes>, src: every lane is the low bits of the W register src (X for D2)
+  void DUPGeneral(Lanes const lanes, TReg const dst, TReg const src);
+
+  // dup  dst.<lanes>, src.<lane>[index]
+  void DUPElement(Lanes const lanes, TReg const dst, TReg const src, uint32_t const index);
+
+  // mov  dst, src.<lane>[index]: the lane into the B, H, S or D register dst, the upper bits of dst are cleared
+  void DUPScalar(Lanes const lanes, TReg const dst, TReg const src, uint32_t const index);
+
+  // mov  dst.<lane>[index], src: the low bits of the W register src (X for D2), the other lanes are kept
+  void INSGeneral(Lanes const lanes, TReg const dst, uint32_t const index, TReg const src);
+
+  // mov  dst.<lane>[dstIndex], src.<lane>[srcIndex]
+  void INSElement(Lanes const lanes, TReg const dst, uint32_t const dstIndex, TReg const src, uint32_t const srcIndex);
+
+  // umov  wd, src.<lane>[index]  (xd for D2)
+  void UMOV(Lanes const lanes, TReg const dst, TReg const src, uint32_t const index);
+
+  // smov  wd, src.<lane>[index]  (B16 and H8 only)
+  void SMOV(Lanes const lanes, TReg const dst, TReg const src, uint32_t const index);
+
+  // shl  dst.<lanes>, src.<lanes>, #shift  (shift below the lane width)
+  void SHLVector(Lanes const lanes, TReg const dst, TReg const src, uint32_t const shift);
+
+  // sshr  dst.<lanes>, src.<lanes>, #shift  (shift from 1 up to the lane width)
+  void SSHRVector(Lanes const lanes, TReg const dst, TReg const src, uint32_t const shift);
+
+  // ushr  dst.<lanes>, src.<lanes>, #shift  (shift from 1 up to the lane width)
+  void USHRVector(Lanes const lanes, TReg const dst, TReg const src, uint32_t const shift);
+
+  // sshll  dst, src.<lanes>, #0 (sshll2 if upperHalf): the lower (upper) half of the lanes sign extended to twice their width
+  void SSHLL(Lanes const lanes, bool const upperHalf, TReg const dst, TReg const src);
+
+  // ushll  dst, src.<lanes>, #0 (ushll2 if upperHalf): the lower (upper) half of the lanes zero extended to twice their width
+  void USHLL(Lanes const lanes, bool const upperHalf, TReg const dst, TReg const src);
+
+  // ext  dst.16b, first.16b, second.16b, #index: bytes index to 15 of first followed by the lowest index bytes of second
+  void EXT(TReg const dst, TReg const first, TReg const second, uint32_t const index);
+
+  // addp  dd, src.2d: the sum of both lanes
+  void ADDPScalar(TReg const dst, TReg const src);
+
+  // stp  qt1, qt2, [rn, #offset]!  (offset multiple of 16 in [-1024, 1008])
+  void STPVectorPreIndex(TReg const rt1, TReg const rt2, TReg const rn, int32_t const offset);
+
+  // ldp  qt1, qt2, [rn], #offset  (offset multiple of 16 in [-1024, 1008])
+  void LDPVectorPostIndex(TReg const rt1, TReg const rt2, TReg const rn, int32_t const offset);
+
+  void Ret();
+
+  ///
+  /// @brief The instructions emitted so far
+  const MachineCode &instructions() const {
     return instructions_;
   }
 
-  void notifyIfBlockEnd() {
-    instructions_.insert(instructions_.end(), ifBlockInstructions_.begin(), ifBlockInstructions_.end());
-    if (elseBlockInstructions_.size() > 0) {
-      B(elseBlockInstructions_.size() / 4 + 1); // jump else block
-    }
-    instructions_.insert(instructions_.end(), elseBlockInstructions_.begin(), elseBlockInstructions_.end());
-    ifBlockState = 0;
-  }
+  ///
+  /// @brief Move the finished machine code out, the assembler is empty afterwards
+  /// @throws std::runtime_error if a branch targets a label that was never bound
+  MachineCode releaseInstructions();
 
   // private:
-  void insertInstructionIntoVector(uint32_t instruction, std::vector<uint8_t> &vec);
-  std::vector<uint8_t> instructions_;
-  ModuleInfo &moduleInfo_;
+  void insertInstructionIntoVector(uint32_t instruction, MachineCode &vec);
+
+  // data processing instruction with three registers (rd, rn, rm)
+  void emitThreeRegisters(uint32_t instruction, TReg const dst, TReg const first, TReg const second);
+
+  void emitLogicalImmediate(uint32_t instruction, bool is64, TReg const dst, TReg const src, uint64_t const imm);
+
+  // quotient of a constant divisor that is not a power of two, by a multiply-high with a magic number
+  void emitMagicQuotient(bool is64, bool isSigned, TReg const dst, TReg const first, uint64_t const divisor);
+
+  // UBFM/SBFM, the aliases of the immediate shifts
+  void emitBitfieldMove(uint32_t instruction, TReg const dst, TReg const src, uint32_t const immr, uint32_t const imms);
+
+  // LDP/STP of X registers, the D register form if rt1 is a float register
+  void emitRegisterPair(uint32_t instruction, TReg const rt1, TReg const rt2, TReg const rn, int32_t const offset);
+
+  // float data processing instruction: type (bit 22) selects double, rm is left out if NONE
+  void emitFloat(uint32_t instruction, bool isDouble, TReg const dst, TReg const first, TReg const second = TReg::NONE);
+
+  // conversion between a general purpose and a float register, sf (bit 31) selects an X register
+  void emitFloatConversion(uint32_t instruction, bool isDouble, bool is64, TReg const dst, TReg const src);
+
+  // LDP/STP of Q registers
+  void emitVectorPair(uint32_t instruction, TReg const rt1, TReg const rt2, TReg const rn, int32_t const offset);
+
+  // DUP, INS, UMOV and SMOV: imm5 (bits 20:16) selects the lane size and index
+  void emitLaneAccess(uint32_t instruction, Lanes const lanes, TReg const dst, TReg const src, uint32_t const index);
+
+  // vector shift by immediate, immh:immb (bits 22:16) holds the lane size and the shift
+  void emitVectorShift(uint32_t instruction, TReg const dst, TReg const src, uint32_t const immhImmb);
+
+  // emit a branch (B, B.cond, CBZ/CBNZ, TBZ/TBNZ) whose offset field is filled in from label
+  void emitBranch(uint32_t const instruction, Label const label);
+
+  MachineCode instructions_;
+  std::vector<ModuleInfo::TrapSite> trapSites_;
+  const ModuleInfo &moduleInfo_;
 
-  std::vector<uint8_t> ifBlockInstructions_;
-  std::vector<uint8_t> elseBlockInstructions_;
+  struct LabelState {
+    int64_t position = -1;    ///< instruction index the label is bound to, -1 while unbound
+    int64_t lastBranch = -1;  ///< last branch waiting for this label, -1 if there is none
+  };
+  std::vector<LabelState> labels_;
+};
 
-  // 1 = if block, 2 = else block
-  uint8_t ifBlockState = 0;
-};
\ No newline at end of file
+#endif
@@ -9,4 +9,75 @@ enum class aarch64REG : uint32_t { // clang-format off
   NONE = 0b1000'0000
 }; // clang-format on
 
-using TReg = aarch64REG;
\ No newline at end of file
+using TReg = aarch64REG;
+
+///
+/// @brief Pinned to the base of the linear memory in all compiled code, the invocation trampolines load it
+constexpr TReg memoryBaseRegister = TReg::R28;
+
+///
+/// @brief Whether reg is one of F0-F31 (the S/D view of the SIMD&FP registers)
+constexpr bool isFloatRegister(TReg const reg) {
+  return (reg >= TReg::F0) && (reg <= TReg::F31);
+}
+
+///
+/// @brief The index-th float register compiled code may use freely: F0-F7, then F16-F29. F8-F15 are callee-saved and F30/F31
+/// are scratch. Float params are passed in floatRegister(0) upwards.
+constexpr TReg floatRegister(uint32_t const index) {
+  return static_cast<TReg>(static_cast<uint32_t>(TReg::F0) + ((index < 8U) ? index : (index + 8U)));
+}
+
+///
+/// @brief AArch64 condition codes as encoded in B.cond and CSEL
+enum class CC : uint8_t { EQ, NE, HS, LO, MI, PL, VS, VC, HI, LS, GE, LT, GT, LE, AL, NV };
+
+///
+/// @brief Shift applied to the second register of a shifted register ADD/SUB, encoded in bits 23:22
+enum class Shift : uint8_t { LSL, LSR, ASR };
+///
+/// @brief Single register load or store, the size (bits 31:30) and opc (bits 23:22) fields of the load/store register encodings.
+/// The S variants sign extend into a W (..W) or X (..X) register, loads into a W register clear the upper half.
+/// The ..S, ..D and ..Q variants (bit 26 set) access an S, D or the whole 128 bit Q register.
+enum class MemOp : uint32_t { // clang-format off
+  STRB = 0x00000000U, STRH = 0x40000000U, STRW = 0x80000000U, STRX = 0xC0000000U,
+  LDRB = 0x00400000U, LDRH = 0x40400000U, LDRW = 0x80400000U, LDRX = 0xC0400000U,
+  LDRSBX = 0x00800000U, LDRSHX = 0x40800000U, LDRSWX = 0x80800000U,
+  LDRSBW = 0x00C00000U, LDRSHW = 0x40C00000U,
+  STRS = 0x84000000U, STRD = 0xC4000000U, LDRS = 0x84400000U, LDRD = 0xC4400000U,
+  STRQ = 0x04800000U, LDRQ = 0x04C00000U
+}; // clang-format on
+
+///
+/// @brief Lanes of a 128 bit vector register: 16 bytes, 8 halfwords, 4 words or 2 doublewords, the size field (bits 23:22) of the
+/// integer vector instructions
+enum class Lanes : uint32_t { B16, H8, S4, D2 };
+
+///
+/// @brief Vector instructions on the whole 128 bit registers (Q bit set): three registers, two registers or an across lanes reduction.
+/// The integer ones get the size field of their Lanes, the float ones (F..., SCVTF, UCVTF) the precision in bit 22. The logical
+/// instructions, TBL and NOT have no size field.
+enum class VectorOp : uint32_t { // clang-format off
+  ADD = 0x4E208400U, SUB = 0x6E208400U, MUL = 0x4E209C00U, SQADD = 0x4E200C00U, UQADD = 0x6E200C00U, SQSUB = 0x4E202C00U,
+  UQSUB = 0x6E202C00U, SMIN = 0x4E206C00U, UMIN = 0x6E206C00U, SMAX = 0x4E206400U, UMAX = 0x6E206400U, URHADD = 0x6E201400U,
+  SQRDMULH = 0x6E20B400U, ADDP = 0x4E20BC00U, SSHL = 0x4E204400U, USHL = 0x6E204400U,
+  CMEQ = 0x6E208C00U, CMGT = 0x4E203400U, CMGE = 0x4E203C00U, CMHI = 0x6E203400U, CMHS = 0x6E203C00U,
+  AND = 0x4E201C00U, BIC = 0x4E601C00U, ORR = 0x4EA01C00U, EOR = 0x6E201C00U, BSL = 0x6E601C00U, BIF = 0x6EE01C00U,
+  TBL = 0x4E000000U, TBL2 = 0x4E002000U, ZIP1 = 0x4E003800U,
+  // the long multiplications read the lower half (the ..2 forms the upper half) of their operands, the size is the one of the operands
+  SMULL = 0x0E20C000U, SMULL2 = 0x4E20C000U, UMULL = 0x2E20C000U, UMULL2 = 0x6E20C000U,
+  // two registers
+  NOT = 0x6E205800U, NEG = 0x6E20B800U, ABS = 0x4E20B800U, CNT = 0x4E205800U, CMLTZERO = 0x4E20A800U, CMEQZERO = 0x4E209800U,
+  SADDLP = 0x4E202800U, UADDLP = 0x6E202800U, // pairwise sums into lanes twice as wide, the size is the one of the operand
+  // the narrowing ones write the lower half (the ..2 forms the upper half and keep the lower one), the size is the one of the result
+  SQXTN = 0x0E214800U, SQXTN2 = 0x4E214800U, SQXTUN = 0x2E212800U, SQXTUN2 = 0x6E212800U, UQXTN = 0x2E214800U,
+  // across lanes, into the lowest lane of the destination
+  ADDV = 0x4E31B800U, UMAXV = 0x6E30A800U, UMINV = 0x6E31A800U,
+  // float
+  FADD = 0x4E20D400U, FSUB = 0x4EA0D400U, FMUL = 0x6E20DC00U, FDIV = 0x6E20FC00U, FMIN = 0x4EA0F400U, FMAX = 0x4E20F400U,
+  FCMEQ = 0x4E20E400U, FCMGE = 0x6E20E400U, FCMGT = 0x6EA0E400U,
+  FABS = 0x4EA0F800U, FNEG = 0x6EA0F800U, FSQRT = 0x6EA1F800U, FRINTN = 0x4E218800U, FRINTM = 0x4E219800U, FRINTP = 0x4EA18800U,
+  FRINTZ = 0x4EA19800U, SCVTF = 0x4E21D800U, UCVTF = 0x6E21D800U, FCVTZS = 0x4EA1B800U, FCVTZU = 0x6EA1B800U,
+  // the doubles of the source (FCVTN) or the destination (FCVTL) in the lower half, the floats in the lower half of the other
+  FCVTN = 0x0E216800U, FCVTL = 0x0E217800U
+}; // clang-format on
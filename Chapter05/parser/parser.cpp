@@ -1,53 +1,37 @@
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
-#include <optional>
 #include <stdexcept>
 #include <sys/mman.h>
 #include <vector>
 
+#include "ByteSpan.hpp"
+#include "CodeArena.hpp"
+#include "LEB128.hpp"
+#include "LinearMemory.hpp"
+#include "Logger.hpp"
+#include "MappedFile.hpp"
 #include "ModuleInfo.hpp"
 #include "OPCode.hpp"
+#include "RegisterAllocator.hpp"
 #include "Stack.hpp"
 #include "StackElement.hpp"
+#include "WorkStealingPool.hpp"
 #include "aarch64_assembler.hpp"
 #include "aarch64_common.hpp"
 #include "parser.hpp"
 
-uint32_t readULEB128(const std::vector<uint8_t> &data, size_t &index) {
-  uint32_t result = 0;
-  uint32_t shift = 0;
-  const int maxBytes = 5; // ULEB128 for 32-bit integers should not exceed 5 bytes
-
-  for (int byteCount = 0; byteCount < maxBytes; ++byteCount) {
-    if (index >= data.size()) {
-      throw std::out_of_range("ULEB128 encoding is incomplete or data is truncated.");
-    }
-
-    const uint8_t byte = data[index++];
-    result |= (byte & 0x7FU) << shift;
-
-    if ((byte & 0x80U) == 0) {
-      // If the highest bit is not set, this is the last byte
-      return result;
-    }
-
-    shift += 7;
-  }
-
-  throw std::overflow_error("ULEB128 encoding exceeds the maximum length for 32-bit integers.");
-}
-
-void parseTypeSection(const std::vector<uint8_t> &byteStream, size_t &index, ModuleInfo &moduleInfo) {
+void parseTypeSection(const ByteSpan &byteStream, size_t &index, ModuleInfo &moduleInfo) {
   uint32_t const sectionSize = readULEB128(byteStream, index);
   static_cast<void>(sectionSize);
   uint32_t numTypeSize = readULEB128(byteStream, index);
   while (numTypeSize-- > 0) {
     uint32_t const typeType = readULEB128(byteStream, index);
     if (typeType != 0x60) {
-      std::cout << "parser not support non function type" << typeType << std::endl;
+      LOG_ERROR("parser not support non function type" << typeType);
       exit(1);
     }
     uint32_t paraNums = readULEB128(byteStream, index);
@@ -70,8 +54,12 @@ void parseTypeSection(const std::vector<uint8_t> &byteStream, size_t &index, Mod
         funcSignatureType.push_back(static_cast<char>(SignatureType::F64));
         break;
       }
+      case 0x7B: {
+        funcSignatureType.push_back(static_cast<char>(SignatureType::V128));
+        break;
+      }
       default: {
-        std::cout << "met unknown func SignatureType, exit.";
+        LOG_ERROR("met unknown func SignatureType, exit.");
         exit(1);
       }
       }
@@ -80,7 +68,7 @@ void parseTypeSection(const std::vector<uint8_t> &byteStream, size_t &index, Mod
     funcSignatureType.push_back(static_cast<char>(SignatureType::PARAMEND));
     uint32_t retNums = readULEB128(byteStream, index);
     if (retNums > 1) {
-      std::cout << "wasm ret nums not support > 1. exit." << std::endl;
+      LOG_ERROR("wasm ret nums not support > 1. exit.");
       exit(1);
     }
     while (retNums-- > 0) {
@@ -101,100 +89,210 @@ void parseTypeSection(const std::vector<uint8_t> &byteStream, size_t &index, Mod
         funcSignatureType.push_back(static_cast<char>(SignatureType::F64));
         break;
       }
+      case 0x7B: {
+        funcSignatureType.push_back(static_cast<char>(SignatureType::V128));
+        break;
+      }
       default: {
-        std::cout << "met unknown func SignatureType, exit.";
+        LOG_ERROR("met unknown func SignatureType, exit.");
         exit(1);
       }
       }
       index++;
     }
-    std::cout << "get a funcSignatureType: " << funcSignatureType << std::endl;
+    LOG_TRACE("get a funcSignatureType: " << funcSignatureType);
     moduleInfo.signatureTypes.emplace_back(funcSignatureType);
   }
 }
 
-void parseExportSection(const std::vector<uint8_t> &byteStream, size_t &index, ModuleInfo &moduleInfo) {
+void parseExportSection(const ByteSpan &byteStream, size_t &index, ModuleInfo &moduleInfo) {
   uint32_t const sectionSize = readULEB128(byteStream, index);
   static_cast<void>(sectionSize);
   uint32_t exportNums = readULEB128(byteStream, index);
   while (exportNums-- > 0) {
-    size_t fieldNameSize = readULEB128(byteStream, index);
-    std::string fieldName;
-    char c;
-    while (true) {
-      c = static_cast<char>(byteStream[index++]);
-      if (c == 0x00) { // get export name
-        const size_t funcIndex = byteStream[index++];
-        moduleInfo.functionsIndexName.emplace(std::make_pair(funcIndex, fieldName));
-        moduleInfo.functionsNameIndex.emplace(std::make_pair(fieldName, funcIndex));
-        break;
-      }
-      fieldName.push_back(c);
+    size_t const fieldNameSize = readULEB128(byteStream, index);
+    ByteSpan const name = byteStream.subspan(index, fieldNameSize);
+    std::string const fieldName(name.begin(), name.end());
+    index += fieldNameSize;
+    uint8_t const exportKind = byteStream[index++];
+    uint32_t const exportIndex = readULEB128(byteStream, index);
+    if (exportKind == 0x00) { // function, tables, memories and globals are not callable
+      moduleInfo.functionsIndexName.emplace(std::make_pair(static_cast<size_t>(exportIndex), fieldName));
+      moduleInfo.functionsNameIndex.emplace(std::make_pair(fieldName, static_cast<size_t>(exportIndex)));
     }
   }
 }
 
-void parseFunctionSection(const std::vector<uint8_t> &byteStream, size_t &index, ModuleInfo &moduleInfo) {
+void parseFunctionSection(const ByteSpan &byteStream, size_t &index, ModuleInfo &moduleInfo) {
   uint32_t const sectionSize = readULEB128(byteStream, index);
   static_cast<void>(sectionSize);
   uint32_t functionNums = readULEB128(byteStream, index);
   moduleInfo.functionNums = functionNums;
-  std::cout << "get functionNums: " << functionNums << std::endl;
+  LOG_TRACE("get functionNums: " << functionNums);
   while (functionNums-- > 0) {
     uint32_t const functionIndex = readULEB128(byteStream, index);
     moduleInfo.functionInfos.emplace_back(ModuleInfo::FunctionInfo{functionIndex});
   }
 }
 
-void parseCodeSection(const std::vector<uint8_t> &byteStream, size_t &index, ModuleInfo &moduleInfo) {
+void parseMemorySection(const ByteSpan &byteStream, size_t &index, ModuleInfo &moduleInfo) {
   uint32_t const sectionSize = readULEB128(byteStream, index);
   static_cast<void>(sectionSize);
-  uint32_t functionSize = readULEB128(byteStream, index);
-  while (functionSize-- > 0) {
-    uint32_t const functionBodySize = readULEB128(byteStream, index);
-    static_cast<void>(functionBodySize);
-    uint32_t const localVarSizeIndex = index;
-    uint32_t localVarSize = readULEB128(byteStream, index);
-    std::vector<ModuleInfo::LocalVar> localVars;
-    while (localVarSize-- > 0) {
-      uint32_t localVarRepeatTimes = readULEB128(byteStream, index);
-      uint8_t const localVarType = byteStream[index];
-      ModuleInfo::LocalVar localVar;
-      switch (localVarType) {
-      case 0x7F: {
-        localVar.wasmType = WasmType::I32;
-        break;
-      }
-      case 0x7E: {
-        localVar.wasmType = WasmType::I64;
-        break;
-      }
-      case 0x7D: {
-        localVar.wasmType = WasmType::F32;
-        break;
-      }
-      case 0x7C: {
-        localVar.wasmType = WasmType::F64;
-        break;
-      }
-      default: {
-        std::cout << "met unknown local var wasm typeexit.";
-        exit(1);
-      }
+  uint32_t const memoryNums = readULEB128(byteStream, index);
+  if ((memoryNums > 1U) || (moduleInfo.hasMemory && (memoryNums != 0U))) {
+    throw std::runtime_error("error: multiple memories are not supported.");
+  }
+  if (memoryNums == 0U) {
+    return;
+  }
+  // limits: 0x00 min, 0x01 min max. Shared and 64 bit memories use the other flags.
+  uint8_t const limitsFlags = byteStream[index++];
+  if (limitsFlags > 0x01U) {
+    throw std::runtime_error("error: only unshared 32 bit memories are supported.");
+  }
+  moduleInfo.memoryInitialPages = readULEB128(byteStream, index);
+  if (limitsFlags == 0x01U) {
+    moduleInfo.memoryMaximumPages = readULEB128(byteStream, index);
+  }
+  if ((moduleInfo.memoryMaximumPages > 65536U) || (moduleInfo.memoryInitialPages > moduleInfo.memoryMaximumPages)) {
+    throw std::runtime_error("error: memory limits exceed 65536 pages or the minimum exceeds the maximum.");
+  }
+  moduleInfo.hasMemory = true;
+  LOG_TRACE("memory: " << moduleInfo.memoryInitialPages << " initial, " << moduleInfo.memoryMaximumPages << " maximum pages");
+}
+
+void parseDataSection(const ByteSpan &byteStream, size_t &index, ModuleInfo &moduleInfo) {
+  uint32_t const sectionSize = readULEB128(byteStream, index);
+  static_cast<void>(sectionSize);
+  uint32_t segmentNums = readULEB128(byteStream, index);
+  while (segmentNums-- > 0) {
+    // 0x00 active in memory 0, 0x01 passive, 0x02 active with an explicit memory index
+    uint32_t const segmentFlags = readULEB128(byteStream, index);
+    if (segmentFlags > 0x02U) {
+      throw std::runtime_error("error: unknown data segment flags.");
+    }
+    bool const active = segmentFlags != 0x01U;
+    if ((segmentFlags == 0x02U) && (readULEB128(byteStream, index) != 0U)) {
+      throw std::runtime_error("error: data segment for a memory other than memory 0.");
+    }
+    ModuleInfo::DataSegment segment;
+    if (active) {
+      if (static_cast<OPCode>(byteStream[index++]) != OPCode::I32_CONST) {
+        throw std::runtime_error("error: data segment offsets only support i32.const currently.");
       }
-      while (localVarRepeatTimes-- > 0) {
-        localVars.emplace_back(localVar);
+      segment.offset = static_cast<uint32_t>(readSLEB128(byteStream, index));
+      if (static_cast<OPCode>(byteStream[index++]) != OPCode::END) {
+        throw std::runtime_error("error: data segment offset expression is not a single i32.const.");
       }
-      index++;
     }
-    moduleInfo.functionsLocalVars.emplace_back(std::move(localVars));
-    // localvars save end ,start wasm opCode save
-    uint32_t opCodeNums = functionBodySize - (index - localVarSizeIndex);
-    std::vector<uint8_t> functionInstructions;
-    while (opCodeNums-- > 0) {
-      functionInstructions.emplace_back(byteStream[index++]);
+    uint32_t const dataSize = readULEB128(byteStream, index);
+    ByteSpan const bytes = byteStream.subspan(index, dataSize);
+    index += dataSize;
+    if (active) { // passive segments are only read by memory.init
+      segment.bytes.assign(bytes.begin(), bytes.end());
+      moduleInfo.dataSegments.emplace_back(std::move(segment));
+    }
+  }
+}
+
+void parseFunctionBody(const ByteSpan &byteStream, size_t &index, uint32_t const functionBodySize, ModuleInfo &moduleInfo) {
+  size_t const localVarSizeIndex = index;
+  uint32_t localVarSize = readULEB128(byteStream, index);
+  std::vector<ModuleInfo::LocalVar> localVars;
+  while (localVarSize-- > 0) {
+    uint32_t localVarRepeatTimes = readULEB128(byteStream, index);
+    uint8_t const localVarType = byteStream[index];
+    ModuleInfo::LocalVar localVar;
+    switch (localVarType) {
+    case 0x7F: {
+      localVar.wasmType = WasmType::I32;
+      break;
+    }
+    case 0x7E: {
+      localVar.wasmType = WasmType::I64;
+      break;
+    }
+    case 0x7D: {
+      localVar.wasmType = WasmType::F32;
+      break;
+    }
+    case 0x7C: {
+      localVar.wasmType = WasmType::F64;
+      break;
+    }
+    case 0x7B: {
+      localVar.wasmType = WasmType::VEC_TYPE;
+      break;
+    }
+    default: {
+      LOG_ERROR("met unknown local var wasm typeexit.");
+      exit(1);
+    }
+    }
+    while (localVarRepeatTimes-- > 0) {
+      localVars.emplace_back(localVar);
     }
-    moduleInfo.functionsInstructions.emplace_back(std::move(functionInstructions));
+    index++;
+  }
+  moduleInfo.functionsLocalVars.emplace_back(std::move(localVars));
+  // localvars save end ,start wasm opCode save
+  size_t const opCodeNums = functionBodySize - (index - localVarSizeIndex);
+  moduleInfo.functionsInstructions.emplace_back(byteStream.subspan(index, opCodeNums));
+  index += opCodeNums;
+}
+
+void parseCodeSection(const ByteSpan &byteStream, size_t &index, ModuleInfo &moduleInfo) {
+  uint32_t const sectionSize = readULEB128(byteStream, index);
+  static_cast<void>(sectionSize);
+  uint32_t functionSize = readULEB128(byteStream, index);
+  while (functionSize-- > 0) {
+    uint32_t const functionBodySize = readULEB128(byteStream, index);
+    parseFunctionBody(byteStream, index, functionBodySize, moduleInfo);
+  }
+}
+
+void parseSection(WASMSectionType const sectionType, const ByteSpan &byteStream, size_t &index, ModuleInfo &moduleInfo) {
+  switch (sectionType) {
+  case WASMSectionType::CUSTOM:
+  case WASMSectionType::IMPORT:
+  case WASMSectionType::TABLE:
+  case WASMSectionType::GLOBAL:
+  case WASMSectionType::START:
+  case WASMSectionType::ELEM:
+  case WASMSectionType::DATA_COUNT: {
+    uint32_t const sectionSize = readULEB128(byteStream, index);
+    index += sectionSize; // cut sectionContent
+    break;
+  }
+  case WASMSectionType::EXPORT: {
+    parseExportSection(byteStream, index, moduleInfo);
+    break;
+  }
+  case WASMSectionType::MEMORY: {
+    parseMemorySection(byteStream, index, moduleInfo);
+    break;
+  }
+  case WASMSectionType::DATA: {
+    parseDataSection(byteStream, index, moduleInfo);
+    break;
+  }
+  case WASMSectionType::TYPE: {
+    parseTypeSection(byteStream, index, moduleInfo);
+    break;
+  }
+  case WASMSectionType::FUNCTION: {
+    parseFunctionSection(byteStream, index, moduleInfo);
+    break;
+  }
+  case WASMSectionType::CODE: {
+    parseCodeSection(byteStream, index, moduleInfo);
+    break;
+  }
+  default: {
+    std::stringstream ss;
+    ss << "error: unknown wasm section id " << static_cast<uint32_t>(sectionType);
+    throw std::runtime_error(ss.str());
+  }
   }
 }
 
@@ -219,69 +317,39 @@ std::vector<uint8_t> readFileToByteStream(const std::string &filePath) {
 }
 
 ModuleInfo processWasmFile(const char *filePath) {
-  std::vector<uint8_t> byteStream = readFileToByteStream(filePath);
+  std::shared_ptr<MappedFile> const mappedFile = MappedFile::open(filePath);
+  ByteSpan const byteStream = mappedFile->bytes();
 
-  std::cout << "print bytestream for file: " << filePath << std::endl;
-  for (uint8_t const byte : byteStream) {
-    std::cout << std::hex << std::setw(2) << std::setfill('0') << static_cast<int>(byte) << ' ';
+  if (Logger::isEnabled(LogLevel::TRACE)) {
+    std::ostringstream byteDump;
+    for (uint8_t const byte : byteStream) {
+      byteDump << std::hex << std::setw(2) << std::setfill('0') << static_cast<int>(byte) << ' ';
+    }
+    LOG_TRACE("print bytestream for file: " << filePath << '\n' << byteDump.str());
   }
-  std::cout << std::dec << std::endl; // Reset to decimal output
 
   if (byteStream.size() < 8) {
-    std::cout << "File content read into byte stream:" << std::endl;
+    LOG_ERROR("wasm file is too small to contain a module header: " << filePath);
     exit(1);
   }
 
   ModuleInfo moduleInfo;
+  moduleInfo.byteStreamOwner = mappedFile;
   size_t byteIndex = 0;
   byteIndex += 8;
 
   while (byteIndex < byteStream.size()) {
-    switch (static_cast<WASMSectionType>(byteStream[byteIndex])) {
-    case WASMSectionType::CUSTOM:
-    case WASMSectionType::IMPORT:
-    case WASMSectionType::TABLE:
-    case WASMSectionType::MEMORY:
-    case WASMSectionType::GLOBAL:
-    case WASMSectionType::START:
-    case WASMSectionType::ELEM:
-    case WASMSectionType::DATA: {
-      byteIndex++;
-      uint32_t const sectionSize = readULEB128(byteStream, byteIndex);
-      byteIndex += sectionSize; // cut sectionContent
-      break;
-    }
-    case WASMSectionType::EXPORT: {
-      byteIndex++;
-      parseExportSection(byteStream, byteIndex, moduleInfo);
-      break;
-    }
-    case WASMSectionType::TYPE: {
-      byteIndex++;
-      parseTypeSection(byteStream, byteIndex, moduleInfo);
-      break;
-    }
-    case WASMSectionType::FUNCTION: {
-      byteIndex++;
-      parseFunctionSection(byteStream, byteIndex, moduleInfo);
-      break;
-    }
-    case WASMSectionType::CODE: {
-      byteIndex++;
-      parseCodeSection(byteStream, byteIndex, moduleInfo);
-    }
-    default:
-      break;
-    }
+    auto const sectionType = static_cast<WASMSectionType>(byteStream[byteIndex++]);
+    parseSection(sectionType, byteStream, byteIndex, moduleInfo);
   }
 
-  std::cout << "wasm file :" << filePath << " parse end. got ModuleInfo." << std::endl;
+  LOG_INFO("wasm file :" << filePath << " parse end. got ModuleInfo.");
 
   return moduleInfo;
 }
 // compile opCode
 
-// 解析函数签名,并分配寄存器和内存，保存相关信息到functionInfo
+// 解析函数签名，保存相关信息到functionInfo, registers are assigned by allocateRegisters
 std::vector<ModuleInfo::LocalVar> parseFuncSignature(const std::string &signature, ModuleInfo::FunctionInfo &funcInfo) {
   std::vector<ModuleInfo::LocalVar> funcParms;
   for (int i = 1; i < signature.size(); i++) {
@@ -289,32 +357,35 @@ std::vector<ModuleInfo::LocalVar> parseFuncSignature(const std::string &signatur
     switch (signature[i]) {
     case 'i': {
       funcParm.wasmType = WasmType::I32;
-      funcParm.reg = static_cast<TReg>(funcInfo.numLocalsInGPR++);
       funcInfo.numParams++;
       funcInfo.numLocals++;
       break;
     }
     case 'I': {
       funcParm.wasmType = WasmType::I64;
-      funcParm.reg = static_cast<TReg>(funcInfo.numLocalsInGPR++);
       funcInfo.numParams++;
       funcInfo.numLocals++;
       break;
     }
     case 'f': {
       funcParm.wasmType = WasmType::F32;
-      funcParm.reg = static_cast<TReg>(funcInfo.numLocalsInFPR++);
       funcInfo.numParams++;
       funcInfo.numLocals++;
       break;
     }
     case 'F': {
       funcParm.wasmType = WasmType::F64;
-      funcParm.reg = static_cast<TReg>(funcInfo.numLocalsInFPR++);
       funcInfo.numParams++;
       funcInfo.numLocals++;
       break;
     }
+    case 'v': {
+      funcParm.wasmType = WasmType::VEC_TYPE;
+      funcInfo.numParams++;
+      funcInfo.numLocals++;
+      funcInfo.usesVectorRegisters = true;
+      break;
+    }
     case ')': {
       funcParm.wasmType = WasmType::INVALID;
       i += 2; // break loop as only one return type (to do)
@@ -337,27 +408,28 @@ void parseFuncLocalVars(std::vector<ModuleInfo::LocalVar> &funcLocalVars, Module
   for (auto &localVar : funcLocalVars) {
     switch (localVar.wasmType) {
     case WasmType::I32: {
-      localVar.reg = static_cast<TReg>(funcInfo.numLocalsInGPR++);
       funcInfo.numLocals++;
       break;
     }
     case WasmType::I64: {
-      localVar.reg = static_cast<TReg>(funcInfo.numLocalsInGPR++);
       funcInfo.numLocals++;
       break;
     }
     case WasmType::F32: {
-      localVar.reg = static_cast<TReg>(funcInfo.numLocalsInFPR++);
       funcInfo.numLocals++;
       break;
     }
     case WasmType::F64: {
-      localVar.reg = static_cast<TReg>(funcInfo.numLocalsInFPR++);
       funcInfo.numLocals++;
       break;
     }
+    case WasmType::VEC_TYPE: {
+      funcInfo.numLocals++;
+      funcInfo.usesVectorRegisters = true;
+      break;
+    }
     default: {
-      std::cout << "error: unknown local var wasm type" << std::endl;
+      LOG_ERROR("error: unknown local var wasm type");
       exit(1);
       break;
     }
@@ -365,661 +437,3387 @@ void parseFuncLocalVars(std::vector<ModuleInfo::LocalVar> &funcLocalVars, Module
   }
 }
 
-std::vector<uint8_t> parseOpCode(const std::vector<uint8_t> &functionInstructionsCode, size_t index, const size_t funcIndex, ModuleInfo &moduleInfo) {
-  Stack stack;
-  AArch64_Assembler assembler(moduleInfo);
-
-  // to do init all local variables
-  size_t const everInitlocalVariableIndex = moduleInfo.functionInfos[funcIndex].numParams;
-  for (size_t j = everInitlocalVariableIndex; j < moduleInfo.functionsLocalVars[funcIndex].size(); ++j) {
-    auto reg = moduleInfo.functionsLocalVars[funcIndex][j].reg;
-    switch (moduleInfo.functionsLocalVars[funcIndex][j].wasmType) {
-    case WasmType::I32: {
-      assembler.MOVimm(false, reg, 0);
+// Upper bound of the operand stack depth of a function body, so the operand stack is reserved once per function.
+// Both arms of an IF are counted on top of each other. The walk ends at the first opcode parseOpCode does not handle,
+// the operand stack grows on demand in that case.
+size_t maxOperandStackDepth(const ByteSpan &functionInstructionsCode, size_t index) {
+  size_t depth = 0U;
+  size_t maxDepth = 0U;
+  auto const popOperands = [&depth](size_t const count) {
+    depth = (depth > count) ? (depth - count) : 0U;
+  };
+  while (index < functionInstructionsCode.size()) {
+    switch (static_cast<OPCode>(functionInstructionsCode[index++])) {
+    case OPCode::I32_CONST: {
+      static_cast<void>(readSLEB128(functionInstructionsCode, index));
+      depth++;
       break;
     }
-    case WasmType::I64: {
-      assembler.MOVimm(true, reg, 0);
+    case OPCode::I64_CONST: {
+      static_cast<void>(readSLEB128_64(functionInstructionsCode, index));
+      depth++;
       break;
     }
-    default: {
-      throw std::runtime_error("Unsupport wasm type currently.");
+    case OPCode::F32_CONST: {
+      index += 4U;
+      depth++;
+      break;
     }
+    case OPCode::F64_CONST: {
+      index += 8U;
+      depth++;
+      break;
     }
-  }
-
-  bool inIfState = false;
-  std::optional<WasmType> ifReturnWasmType = std::nullopt;
-
-  for (size_t i = index; i < functionInstructionsCode.size();) {
-    switch (static_cast<OPCode>(functionInstructionsCode[i])) {
-    case OPCode::I32_CONST: {
-      i++;
-      uint32_t i32ConstValue = readULEB128(functionInstructionsCode, i);
-      StackElement stackElement;
-      stackElement.type = StackType::CONSTANT_I32;
-      stackElement.data.constUnion.u32 = i32ConstValue;
-      stack.push(stackElement);
+    case OPCode::LOCAL_GET: {
+      static_cast<void>(readULEB128(functionInstructionsCode, index));
+      depth++;
       break;
     }
-    case OPCode::I64_CONST: {
-      i++;
-      uint64_t i64ConstValue = readULEB128(functionInstructionsCode, i);
-      StackElement stackElement;
-      stackElement.type = StackType::CONSTANT_I64;
-      stackElement.data.constUnion.u64 = i64ConstValue;
-      stack.push(stackElement);
+    case OPCode::LOCAL_SET: {
+      static_cast<void>(readULEB128(functionInstructionsCode, index));
+      popOperands(1U);
       break;
     }
-    case OPCode::LOCAL_GET: {
-      i++;
-      uint32_t localIndex = readULEB128(functionInstructionsCode, i);
-      StackElement stackElement;
-      stackElement.type = StackType::LOCAL;
-
-      stackElement.variableData.location.localIdx = localIndex;
-      stackElement.variableData.location.reg = moduleInfo.functionsLocalVars[funcIndex][localIndex].reg;
-      stackElement.variableData.location.wasmtype = moduleInfo.functionsLocalVars[funcIndex][localIndex].wasmType;
-      stack.push(stackElement);
+    case OPCode::LOCAL_TEE: {
+      static_cast<void>(readULEB128(functionInstructionsCode, index));
+      break;
+    }
+    case OPCode::BLOCK:
+    case OPCode::LOOP: {
+      index++; // block type
       break;
     }
     case OPCode::IF: {
-      i++;
-      ifReturnWasmType = static_cast<WasmType>(functionInstructionsCode[i++]);
-      assembler.notifyIfBlock();
-      inIfState = true;
-      if (stack.empty()) {
-        std::cout << "error: stack is empty, parse IF OPCODE error" << std::endl;
-        exit(1);
-      }
-      const StackElement &stackElement = stack.top();
-      switch (static_cast<uint32_t>(stackElement.type)) {
-      case StackType::LOCAL: {
-        bool is64 = stackElement.variableData.location.wasmtype == WasmType::I64;
-        assembler.CMP(is64, moduleInfo.functionsLocalVars[funcIndex][stackElement.variableData.location.localIdx].reg, 0);
-        break;
-      }
-      default: {
-        throw std::runtime_error("Error: no support if compare.");
-      }
-      }
-      stack.pop();
+      index++; // block type
+      popOperands(1U);
       break;
     }
-    case OPCode::NOP: {
-      i++;
+    case OPCode::BR: {
+      static_cast<void>(readULEB128(functionInstructionsCode, index));
       break;
     }
-    case OPCode::ELSE: {
-      i++;
-      // to do start handle if then block
-      if (ifReturnWasmType.value() == WasmType::I32) {
-        std::cout << "parse OPCode::ELSE i32 return " << std::endl;
-        if (stack.empty()) {
-          std::cout << "error: stack is empty, parse ELSE OPCode error" << std::endl;
-          exit(1);
-        }
-        const StackElement &stackElement = stack.top();
-        switch (static_cast<uint32_t>(stackElement.type)) {
-        case StackType::CONSTANT_I32: {
-          auto const constValue = stackElement.data.constUnion.u32;
-          TReg lastLocalVarReg = moduleInfo.functionsLocalVars[funcIndex].back().reg;
-          TReg ifResultReg = static_cast<TReg>(moduleInfo.functionInfos[funcIndex].numLocals + 1);
-          assembler.MOVimm(false, ifResultReg, constValue);
-
-          break;
-        }
-        default: {
-          throw std::runtime_error("Error: should not reach here currently");
-        }
-        }
-        stack.pop();
-      }
-      assembler.notifyElseBlock();
+    case OPCode::BR_IF: {
+      static_cast<void>(readULEB128(functionInstructionsCode, index));
+      popOperands(1U);
       break;
     }
-    case OPCode::LOCAL_SET: { // pop stack and set value
-      i++;
-      uint32_t localIndex = readULEB128(functionInstructionsCode, i);
-      if (stack.empty()) {
-        std::cout << "error: stack is empty, parse LOCAL_SET error" << std::endl;
-        exit(1);
-      }
-      const StackElement &stackElement = stack.top();
-      switch (static_cast<uint32_t>(stackElement.type)) {
-      case StackType::CONSTANT_I32: {
-        auto const constValue = stackElement.data.constUnion.u32;
-        assembler.MOVimm(false, moduleInfo.functionsLocalVars[funcIndex][localIndex].reg, constValue);
-        break;
-      }
-      case StackType::CONSTANT_I64: {
-        auto const constValue = stackElement.data.constUnion.u64;
-        assembler.MOVimm(true, moduleInfo.functionsLocalVars[funcIndex][localIndex].reg, constValue);
-        break;
-      }
-      case StackType::LOCAL: {
-        // to do if local var in stack.
-        bool is64 = moduleInfo.functionsLocalVars[funcIndex][localIndex].wasmType == WasmType::I64;
-        assembler.MOVRegister(is64, moduleInfo.functionsLocalVars[funcIndex][localIndex].reg, stackElement.variableData.location.reg);
-        break;
-      }
-      default: {
-        throw std::runtime_error("Error: unknown op code");
-      }
+    case OPCode::BR_TABLE: {
+      uint32_t const numTargets = readULEB128(functionInstructionsCode, index);
+      for (uint32_t j = 0U; j <= numTargets; ++j) { // the targets and the default
+        static_cast<void>(readULEB128(functionInstructionsCode, index));
       }
-      stack.pop();
+      popOperands(1U);
       break;
     }
-    case OPCode::LOCAL_TEE: {
-      i++;
-      uint32_t localIndex = readULEB128(functionInstructionsCode, i);
-      if (stack.empty()) {
-        std::cout << "error: stack is empty, parse LOCAL_SET error" << std::endl;
-        exit(1);
-      }
-      const StackElement &stackElement = stack.top();
-      switch (static_cast<uint32_t>(stackElement.type)) {
-      case StackType::CONSTANT_I32: {
-        auto const constValue = stackElement.data.constUnion.u32;
-        assembler.MOVimm(false, moduleInfo.functionsLocalVars[funcIndex][localIndex].reg, constValue);
-        break;
-      }
-      case StackType::CONSTANT_I64: {
-        auto const constValue = stackElement.data.constUnion.u64;
-        assembler.MOVimm(true, moduleInfo.functionsLocalVars[funcIndex][localIndex].reg, constValue);
-        break;
-      }
-      case StackType::LOCAL: {
-        // to do if local var in stack.
-        bool is64 = moduleInfo.functionsLocalVars[funcIndex][localIndex].wasmType == WasmType::I64;
-        assembler.MOVRegister(is64, moduleInfo.functionsLocalVars[funcIndex][localIndex].reg, stackElement.variableData.location.reg);
-        break;
-      }
-      default: {
-        throw std::runtime_error("Error: unknown op code");
-      }
-      }
+    case OPCode::DROP: {
+      popOperands(1U);
       break;
     }
-    case OPCode::END: {
-      i++;
-      if (inIfState) {
-        if (ifReturnWasmType.value() == WasmType::I32) {
-          if (stack.empty()) {
-            std::cout << "error: stack is empty, parse if block END OPCode error" << std::endl;
-            exit(1);
-          }
-          const StackElement &stackElement = stack.top();
-          switch (static_cast<uint32_t>(stackElement.type)) {
-          case StackType::CONSTANT_I32: {
-            auto const constValue = stackElement.data.constUnion.u32;
-            TReg ifResultReg = static_cast<TReg>(moduleInfo.functionInfos[funcIndex].numLocals + 1);
-            assembler.MOVimm(false, ifResultReg, constValue);
-            break;
-          }
-          default: {
-            throw std::runtime_error("Error: should not reach here currently");
-          }
-          }
-
-          StackElement stackElementIfResult;
-          stackElementIfResult.type = StackType::LOCAL;
-
-          stackElementIfResult.variableData.location.wasmtype = WasmType::I32;
-          stackElementIfResult.variableData.location.reg = static_cast<TReg>(moduleInfo.functionInfos[funcIndex].numLocals + 1);
-          stackElementIfResult.data.constUnion.u32 = stackElement.data.constUnion.u32;
-          stack.pop();
-          stack.push(stackElementIfResult);
-        }
-        inIfState = false;
-        ifReturnWasmType = std::nullopt;
-        if (assembler.ifBlockInstructions_.size() > 0) {
-          assembler.Bcon(0, 4); //<=0 jump to else block    2=i32moveK  1= B   2+1+1 = 4
-        } else {
-          assembler.Bcon(0, 1); //<=0 jump to next block
-        }
-        assembler.notifyIfEnd();
-      } else {
-        i++;
-        if (stack.empty()) {
-          std::cout << "error: stack is empty, parse END OPCODE error" << std::endl;
-          exit(1);
-        }
-        const StackElement &stackElement = stack.top();
-        switch (static_cast<uint32_t>(stackElement.type)) {
-        case StackType::CONSTANT_I32: {
-          auto const constValue = stackElement.data.constUnion.u32;
-          assembler.MOVimm(false, TReg::R0, constValue);
-          break;
-        }
-        case StackType::CONSTANT_I64: {
-          auto const constValue = stackElement.data.constUnion.u64;
-          assembler.MOVimm(true, TReg::R0, constValue);
-          break;
-        }
-        case StackType::LOCAL: {
-          // to do if local var in stack.
-          bool is64 = stackElement.variableData.location.wasmtype == WasmType::I64; // TO USE RETURN TYPE
-          assembler.MOVRegister(is64, TReg::R0, stackElement.variableData.location.reg);
-
-          std::cout << "GKB ADDED" << static_cast<uint32_t>(stackElement.variableData.location.reg) << std::endl;
-          break;
-        }
-        default: {
-          throw std::runtime_error("Error: unknown op code");
-        }
-        }
-        // exit(1);
-        stack.pop();
-        assembler.Ret();
+    case OPCode::CALL: {
+      // without the signature the arguments are not popped, the bound just stays on the safe side
+      static_cast<void>(readULEB128(functionInstructionsCode, index));
+      depth++;
+      break;
+    }
+    case OPCode::I32_LOAD:
+    case OPCode::I64_LOAD:
+    case OPCode::F32_LOAD:
+    case OPCode::F64_LOAD:
+    case OPCode::I32_LOAD8_S:
+    case OPCode::I32_LOAD8_U:
+    case OPCode::I32_LOAD16_S:
+    case OPCode::I32_LOAD16_U:
+    case OPCode::I64_LOAD8_S:
+    case OPCode::I64_LOAD8_U:
+    case OPCode::I64_LOAD16_S:
+    case OPCode::I64_LOAD16_U:
+    case OPCode::I64_LOAD32_S:
+    case OPCode::I64_LOAD32_U: {
+      static_cast<void>(readULEB128(functionInstructionsCode, index)); // alignment
+      static_cast<void>(readULEB128(functionInstructionsCode, index)); // offset
+      break;
+    }
+    case OPCode::I32_STORE:
+    case OPCode::I64_STORE:
+    case OPCode::F32_STORE:
+    case OPCode::F64_STORE:
+    case OPCode::I32_STORE8:
+    case OPCode::I32_STORE16:
+    case OPCode::I64_STORE8:
+    case OPCode::I64_STORE16:
+    case OPCode::I64_STORE32: {
+      static_cast<void>(readULEB128(functionInstructionsCode, index));
+      static_cast<void>(readULEB128(functionInstructionsCode, index));
+      popOperands(2U);
+      break;
+    }
+    case OPCode::MEMORY_SIZE: {
+      index++; // memory index
+      depth++;
+      break;
+    }
+    case OPCode::MEMORY_GROW: {
+      index++;
+      break;
+    }
+    case OPCode::NOP:
+    case OPCode::ELSE:
+    case OPCode::END:
+    case OPCode::RETURN: {
+      break;
+    }
+    case OPCode::I32_EQZ:
+    case OPCode::I64_EQZ: {
+      maxDepth = std::max(maxDepth, depth + 1U); // compiled as a comparison with a pushed zero
+      break;
+    }
+    case OPCode::I32_EQ:
+    case OPCode::I32_NE:
+    case OPCode::I32_LT_S:
+    case OPCode::I32_LT_U:
+    case OPCode::I32_GT_S:
+    case OPCode::I32_GT_U:
+    case OPCode::I32_LE_S:
+    case OPCode::I32_LE_U:
+    case OPCode::I32_GE_S:
+    case OPCode::I32_GE_U:
+    case OPCode::I64_EQ:
+    case OPCode::I64_NE:
+    case OPCode::I64_LT_S:
+    case OPCode::I64_LT_U:
+    case OPCode::I64_GT_S:
+    case OPCode::I64_GT_U:
+    case OPCode::I64_LE_S:
+    case OPCode::I64_LE_U:
+    case OPCode::I64_GE_S:
+    case OPCode::I64_GE_U:
+    case OPCode::I32_ADD:
+    case OPCode::I32_SUB:
+    case OPCode::I32_MUL:
+    case OPCode::I32_DIV_S:
+    case OPCode::I32_DIV_U:
+    case OPCode::I32_REM_S:
+    case OPCode::I32_REM_U:
+    case OPCode::I32_AND:
+    case OPCode::I32_OR:
+    case OPCode::I32_XOR:
+    case OPCode::I32_SHL:
+    case OPCode::I32_SHR_S:
+    case OPCode::I32_SHR_U:
+    case OPCode::I64_ADD:
+    case OPCode::I64_SUB:
+    case OPCode::I64_MUL:
+    case OPCode::I64_DIV_S:
+    case OPCode::I64_DIV_U:
+    case OPCode::I64_REM_S:
+    case OPCode::I64_REM_U:
+    case OPCode::I64_AND:
+    case OPCode::I64_OR:
+    case OPCode::I64_XOR:
+    case OPCode::I64_SHL:
+    case OPCode::I64_SHR_S:
+    case OPCode::I64_SHR_U: {
+      popOperands(1U);
+      break;
+    }
+    case OPCode::SCALAR_EXTEND_OP_CODE: {
+      if (readULEB128(functionInstructionsCode, index) > 7U) { // only the saturating truncations
+        return maxDepth;
       }
       break;
     }
-    case OPCode::I32_ADD: {
-      i++;
-      if (stack.size() < 2) {
-        throw std::runtime_error("error: stack size less than 2, parse I32_ADD wasm opCode error.");
+    case OPCode::VECTOR_EXTEND_OP_CODE: {
+      uint32_t const subOpcode = readULEB128(functionInstructionsCode, index);
+      if (!isVectorOperation(subOpcode)) {
+        return maxDepth;
       }
-      std::cout << "GKB ADDED" << std::endl;
-      StackElement right = stack.top();
-      stack.pop();
-      StackElement left = stack.top();
-      stack.pop();
-      if (static_cast<uint32_t>(left.type) != StackType::LOCAL || static_cast<uint32_t>(right.type) != StackType::LOCAL) {
-        throw std::runtime_error("error: stack element type is not LOCAL, parse I32_ADD wasm opCode error.");
+      auto const opcode = static_cast<OPCode>(static_cast<uint32_t>(OPCode::VECTOR_EXTEND_OP_CODE_PREFIX) | subOpcode);
+      if (hasVectorMemoryArgument(opcode)) {
+        static_cast<void>(readULEB128(functionInstructionsCode, index));
+        static_cast<void>(readULEB128(functionInstructionsCode, index));
       }
-      auto returnType = moduleInfo.getReturnTypeForSignature(moduleInfo.functionInfos[funcIndex].typeIndex);
-
-      if (returnType == WasmType::I32) {
-        assembler.AddShiftedRegister(false, moduleInfo.functionsLocalVars[funcIndex][left.variableData.location.localIdx].reg,
-                                     moduleInfo.functionsLocalVars[funcIndex][right.variableData.location.localIdx].reg);
-      } else {
-        auto leftLocalVarType = moduleInfo.functionsLocalVars[funcIndex][left.variableData.location.localIdx].wasmType;
-        auto rightLocalVarType = moduleInfo.functionsLocalVars[funcIndex][right.variableData.location.localIdx].wasmType;
-        if (rightLocalVarType == WasmType::I32) {
-          assembler.Sxtw(moduleInfo.functionsLocalVars[funcIndex][right.variableData.location.localIdx].reg,
-                         moduleInfo.functionsLocalVars[funcIndex][right.variableData.location.localIdx].reg);
-        } else {
-          throw std::runtime_error("error: I32_ADD right type is not I32 or I64, parse I32_ADD wasm opCode error.");
-        }
-        if (leftLocalVarType == WasmType::I32) {
-          assembler.Sxtw(moduleInfo.functionsLocalVars[funcIndex][left.variableData.location.localIdx].reg,
-                         moduleInfo.functionsLocalVars[funcIndex][left.variableData.location.localIdx].reg);
-        } else {
-          throw std::runtime_error("error: I32_ADD left type is not I32 or I64, parse I32_ADD wasm opCode error.");
-        }
-        assembler.AddShiftedRegister(true, moduleInfo.functionsLocalVars[funcIndex][left.variableData.location.localIdx].reg,
-                                     moduleInfo.functionsLocalVars[funcIndex][right.variableData.location.localIdx].reg);
+      index += vectorImmediateBytes(opcode);
+      popOperands(vectorOperandCount(opcode));
+      if (!isVectorStore(opcode)) {
+        depth++;
       }
-
-      StackElement stackElement;
-      stackElement.type = StackType::LOCAL;
-
-      StackElement::VariableData data;
-      stackElement.variableData.location.localIdx = left.variableData.location.localIdx;
-      stackElement.variableData.location.reg = moduleInfo.functionsLocalVars[funcIndex][left.variableData.location.localIdx].reg;
-      stack.push(stackElement);
       break;
     }
-    case OPCode::I32_SUB: {
-      i++;
-      if (stack.size() < 2) {
-        throw std::runtime_error("error: stack size less than 2, parse I32_SUB wasm opCode error.");
+    default: {
+      auto const opcode = static_cast<OPCode>(functionInstructionsCode[index - 1U]);
+      if (isFloatBinaryOperation(opcode)) {
+        popOperands(1U);
+      } else if (!isUnaryOperation(opcode)) {
+        return maxDepth;
       }
-      StackElement right = stack.top();
-      stack.pop();
-      StackElement left = stack.top();
-      stack.pop();
-      if (static_cast<uint32_t>(left.type) != StackType::LOCAL || static_cast<uint32_t>(right.type) != StackType::LOCAL) {
-        throw std::runtime_error("error: stack element type is not LOCAL, parse I32_SUB wasm opCode error.");
+      break;
+    }
+    }
+    maxDepth = std::max(maxDepth, depth);
+  }
+  return maxDepth;
+}
+
+// an open BLOCK, LOOP or IF of the function body being compiled
+struct ControlFrame {
+  OPCode opcode;
+  WasmType resultType;
+  AArch64_Assembler::Label endLabel;  ///< bound at END, where branches out of a BLOCK or IF continue
+  AArch64_Assembler::Label elseLabel; ///< IF only: start of the else arm, bound at ELSE (or END if there is no else arm)
+  AArch64_Assembler::Label loopLabel; ///< LOOP only: start of the body, where branches to the loop continue
+  size_t stackHeight;                 ///< operand stack size when the frame was opened, without the IF condition
+  TReg resultReg;                     ///< every arm leaves its result in this register
+  bool unreachable;                   ///< the rest of the current arm can not be reached (after RETURN, BR or BR_TABLE)
+};
+
+// control frame storage of the compile thread, reused for every function it compiles
+std::vector<ControlFrame> &controlFrameStorage() {
+  thread_local std::vector<ControlFrame> storage;
+  return storage;
+}
+
+// Result type of a BLOCK/LOOP/IF, only the empty and the single value block types are supported
+WasmType readBlockType(const ByteSpan &functionInstructionsCode, size_t &index) {
+  auto const blockType = static_cast<WasmType>(functionInstructionsCode[index++]);
+  switch (blockType) {
+  case WasmType::TVOID:
+  case WasmType::I32:
+  case WasmType::I64:
+  case WasmType::F32:
+  case WasmType::F64:
+  case WasmType::VEC_TYPE: {
+    return blockType;
+  }
+  default: {
+    throw std::runtime_error("error: block types with a type index are not supported currently.");
+  }
+  }
+}
+
+// Register owned by operand stack slot, above the registers of the locals. Values that are not kept in a local register
+// (block results, locals loaded from the stack frame) live there while they are on the operand stack. The slots end below
+// the scratch registers R26 and R27.
+TReg operandRegister(const ModuleInfo::FunctionInfo &functionInfo, size_t const slot) {
+  size_t const reg = functionInfo.numLocalsInGPR + slot;
+  if (reg >= static_cast<size_t>(TReg::R26)) {
+    throw std::runtime_error("error: too many live operands for the available registers.");
+  }
+  return static_cast<TReg>(reg);
+}
+
+// Float register owned by operand stack slot, like operandRegister above the float locals. An operand stack slot owns both,
+// it only ever holds a value in the one of its type.
+TReg floatOperandRegister(const ModuleInfo::FunctionInfo &functionInfo, size_t const slot) {
+  size_t const index = functionInfo.numLocalsInFPR + slot;
+  if (index >= 22U) { // floatRegister(22) is the scratch register F30
+    throw std::runtime_error("error: too many live float operands for the available registers.");
+  }
+  return floatRegister(static_cast<uint32_t>(index));
+}
+
+bool isFloatType(WasmType const wasmType) {
+  return (wasmType == WasmType::F32) || (wasmType == WasmType::F64);
+}
+
+// f32 and f64 live in the S or D view of a V register, v128 in all of it
+bool usesFloatRegister(WasmType const wasmType) {
+  return isFloatType(wasmType) || (wasmType == WasmType::VEC_TYPE);
+}
+
+// Register of the operand stack slot for a value of wasmType
+TReg slotRegister(const ModuleInfo::FunctionInfo &functionInfo, size_t const slot, WasmType const wasmType) {
+  return usesFloatRegister(wasmType) ? floatOperandRegister(functionInfo, slot) : operandRegister(functionInfo, slot);
+}
+
+// Type of the value of an operand stack element, constants and scratch registers carry it in their stack type
+WasmType elementType(const StackElement &element) {
+  switch (static_cast<uint32_t>(element.type & StackType::TYPEMASK)) {
+  case StackType::I32: {
+    return WasmType::I32;
+  }
+  case StackType::I64: {
+    return WasmType::I64;
+  }
+  case StackType::F32: {
+    return WasmType::F32;
+  }
+  case StackType::F64: {
+    return WasmType::F64;
+  }
+  case StackType::V128: {
+    return WasmType::VEC_TYPE;
+  }
+  default: {
+    return element.variableData.location.wasmtype;
+  }
+  }
+}
+
+// R0 for integer results, F0 for float and v128 results (calls and the function body)
+TReg resultRegister(WasmType const wasmType) {
+  return usesFloatRegister(wasmType) ? TReg::F0 : TReg::R0;
+}
+
+bool isInRegister(const StackElement &element) {
+  uint32_t const type = static_cast<uint32_t>(element.type);
+  return (type == StackType::LOCAL) || ((type & StackType::BASEMASK) == StackType::SCRATCHREGISTER);
+}
+
+ControlFrame openControlFrame(AArch64_Assembler &assembler, OPCode const opcode, WasmType const resultType, size_t const stackHeight,
+                              const ModuleInfo::FunctionInfo &functionInfo) {
+  ControlFrame frame{};
+  frame.opcode = opcode;
+  frame.resultType = resultType;
+  frame.endLabel = assembler.newLabel();
+  frame.stackHeight = stackHeight;
+  frame.unreachable = false;
+  if (resultType != WasmType::TVOID) {
+    // the register follows the operand stack slot the result will occupy, so results that are live at the same time
+    // never share a register, and a block nested at the same height reuses the register of the enclosing one
+    frame.resultReg = slotRegister(functionInfo, stackHeight, resultType);
+  }
+  return frame;
+}
+
+bool is64BitOperation(OPCode const opcode) {
+  return ((opcode >= OPCode::I64_EQZ) && (opcode <= OPCode::I64_GE_U)) || ((opcode >= OPCode::I64_CLZ) && (opcode <= OPCode::I64_ROTR));
+}
+
+bool isComparison(OPCode const opcode) {
+  return ((opcode >= OPCode::I32_EQ) && (opcode <= OPCode::I32_GE_U)) || ((opcode >= OPCode::I64_EQ) && (opcode <= OPCode::I64_GE_U));
+}
+
+// DIV and REM, the operators that may trap
+bool isDivision(OPCode const opcode) {
+  return ((opcode >= OPCode::I32_DIV_S) && (opcode <= OPCode::I32_REM_U)) || ((opcode >= OPCode::I64_DIV_S) && (opcode <= OPCode::I64_REM_U));
+}
+
+// position of a comparison in the order EQ, NE, LT_S, LT_U, GT_S, GT_U, LE_S, LE_U, GE_S, GE_U
+uint32_t comparisonIndex(OPCode const opcode) {
+  OPCode const first = is64BitOperation(opcode) ? OPCode::I64_EQ : OPCode::I32_EQ;
+  return static_cast<uint32_t>(opcode) - static_cast<uint32_t>(first);
+}
+
+CC comparisonCondition(OPCode const opcode) {
+  constexpr CC conditions[] = {CC::EQ, CC::NE, CC::LT, CC::LO, CC::GT, CC::HI, CC::LE, CC::LS, CC::GE, CC::HS};
+  return conditions[comparisonIndex(opcode)];
+}
+
+// the comparison that gives the same result with swapped operands, a < b is b > a
+OPCode mirroredComparison(OPCode const opcode) {
+  constexpr uint32_t mirrored[] = {0U, 1U, 4U, 5U, 2U, 3U, 8U, 9U, 6U, 7U};
+  OPCode const first = is64BitOperation(opcode) ? OPCode::I64_EQ : OPCode::I32_EQ;
+  return static_cast<OPCode>(static_cast<uint32_t>(first) + mirrored[comparisonIndex(opcode)]);
+}
+
+// the comparison with the opposite result, a < b is !(a >= b)
+OPCode invertedComparison(OPCode const opcode) {
+  constexpr uint32_t inverted[] = {1U, 0U, 8U, 9U, 6U, 7U, 4U, 5U, 2U, 3U};
+  OPCode const first = is64BitOperation(opcode) ? OPCode::I64_EQ : OPCode::I32_EQ;
+  return static_cast<OPCode>(static_cast<uint32_t>(first) + inverted[comparisonIndex(opcode)]);
+}
+
+bool isDoubleOperation(OPCode const opcode) {
+  return ((opcode >= OPCode::F64_EQ) && (opcode <= OPCode::F64_GE)) || ((opcode >= OPCode::F64_ABS) && (opcode <= OPCode::F64_COPYSIGN));
+}
+
+// condition of a float comparison in the order EQ, NE, LT, GT, LE, GE. An unordered FCMP (a NaN operand) sets C and V, which
+// fails all of them but NE like wasm wants it, and their inverted codes hold for it.
+CC floatComparisonCondition(OPCode const opcode) {
+  constexpr CC conditions[] = {CC::EQ, CC::NE, CC::MI, CC::GT, CC::LS, CC::GE};
+  OPCode const first = isDoubleOperation(opcode) ? OPCode::F64_EQ : OPCode::F32_EQ;
+  return conditions[static_cast<uint32_t>(opcode) - static_cast<uint32_t>(first)];
+}
+
+// dst = lhs <opcode> rhs for the float binary operators. Comparisons set the W register dst to 0 or 1, a comparison with rhs
+// NONE compares with 0.0.
+void emitFloatOperation(AArch64_Assembler &assembler, OPCode const opcode, TReg const dst, TReg const lhs, TReg const rhs) {
+  bool const isDouble = isDoubleOperation(opcode);
+  if (isFloatComparison(opcode)) {
+    if (rhs == TReg::NONE) {
+      assembler.FCMPZero(isDouble, lhs);
+    } else {
+      assembler.FCMP(isDouble, lhs, rhs);
+    }
+    assembler.CSET(dst, floatComparisonCondition(opcode));
+    return;
+  }
+  switch (opcode) {
+  case OPCode::F32_ADD:
+  case OPCode::F64_ADD: {
+    assembler.FADD(isDouble, dst, lhs, rhs);
+    break;
+  }
+  case OPCode::F32_SUB:
+  case OPCode::F64_SUB: {
+    assembler.FSUB(isDouble, dst, lhs, rhs);
+    break;
+  }
+  case OPCode::F32_MUL:
+  case OPCode::F64_MUL: {
+    assembler.FMUL(isDouble, dst, lhs, rhs);
+    break;
+  }
+  case OPCode::F32_DIV:
+  case OPCode::F64_DIV: {
+    assembler.FDIV(isDouble, dst, lhs, rhs);
+    break;
+  }
+  case OPCode::F32_MIN:
+  case OPCode::F64_MIN: {
+    assembler.FMIN(isDouble, dst, lhs, rhs);
+    break;
+  }
+  case OPCode::F32_MAX:
+  case OPCode::F64_MAX: {
+    assembler.FMAX(isDouble, dst, lhs, rhs);
+    break;
+  }
+  case OPCode::F32_COPYSIGN:
+  case OPCode::F64_COPYSIGN: {
+    assembler.FCOPYSIGN(isDouble, dst, lhs, rhs);
+    break;
+  }
+  default: {
+    throw std::runtime_error("error: unsupported float binary operator.");
+  }
+  }
+}
+
+// dst = lhs <opcode> rhs for the binary operators, comparisons set dst to 0 or 1
+void emitBinaryOperation(AArch64_Assembler &assembler, OPCode const opcode, TReg const dst, TReg const lhs, TReg const rhs) {
+  if (isFloatBinaryOperation(opcode)) {
+    emitFloatOperation(assembler, opcode, dst, lhs, rhs);
+    return;
+  }
+  bool const is64 = is64BitOperation(opcode);
+  if (isComparison(opcode)) {
+    assembler.CMP(is64, lhs, rhs);
+    assembler.CSET(dst, comparisonCondition(opcode));
+    return;
+  }
+  switch (opcode) {
+  case OPCode::I32_ADD:
+  case OPCode::I64_ADD: {
+    assembler.AddShiftedRegister(is64, dst, lhs, rhs);
+    break;
+  }
+  case OPCode::I32_SUB:
+  case OPCode::I64_SUB: {
+    assembler.SubShiftedRegister(is64, dst, lhs, rhs);
+    break;
+  }
+  case OPCode::I32_MUL:
+  case OPCode::I64_MUL: {
+    assembler.Multiply(is64, dst, lhs, rhs);
+    break;
+  }
+  case OPCode::I32_DIV_S:
+  case OPCode::I64_DIV_S: {
+    assembler.SDIV(is64, dst, lhs, rhs);
+    break;
+  }
+  case OPCode::I32_DIV_U:
+  case OPCode::I64_DIV_U: {
+    assembler.UDIV(is64, dst, lhs, rhs);
+    break;
+  }
+  case OPCode::I32_REM_S:
+  case OPCode::I64_REM_S: {
+    assembler.SREM(is64, dst, lhs, rhs);
+    break;
+  }
+  case OPCode::I32_REM_U:
+  case OPCode::I64_REM_U: {
+    assembler.UREM(is64, dst, lhs, rhs);
+    break;
+  }
+  case OPCode::I32_AND:
+  case OPCode::I64_AND: {
+    assembler.ANDRegister(is64, dst, lhs, rhs);
+    break;
+  }
+  case OPCode::I32_OR:
+  case OPCode::I64_OR: {
+    assembler.ORRRegister(is64, dst, lhs, rhs);
+    break;
+  }
+  case OPCode::I32_XOR:
+  case OPCode::I64_XOR: {
+    assembler.EORRegister(is64, dst, lhs, rhs);
+    break;
+  }
+  case OPCode::I32_SHL:
+  case OPCode::I64_SHL: {
+    assembler.LSLV(is64, dst, lhs, rhs);
+    break;
+  }
+  case OPCode::I32_SHR_S:
+  case OPCode::I64_SHR_S: {
+    assembler.ASRV(is64, dst, lhs, rhs);
+    break;
+  }
+  case OPCode::I32_SHR_U:
+  case OPCode::I64_SHR_U: {
+    assembler.LSRV(is64, dst, lhs, rhs);
+    break;
+  }
+  default: {
+    throw std::runtime_error("error: unsupported binary operator.");
+  }
+  }
+}
+
+// ADD/SUB/CMP encode an unsigned imm12, optionally shifted left by 12. A constant that only fits negated flips the operation
+// (SUB for ADD, CMN for CMP).
+bool arithmeticImmediate(bool const is64, uint64_t const constant, bool &negate, uint32_t &imm12, bool &shift12) {
+  uint64_t const mask = is64 ? ~static_cast<uint64_t>(0U) : 0xFFFFFFFFU;
+  for (uint32_t n = 0U; n < 2U; ++n) {
+    uint64_t const value = ((n == 0U) ? constant : (0U - constant)) & mask;
+    negate = n != 0U;
+    if (value <= 0xFFFU) {
+      imm12 = static_cast<uint32_t>(value);
+      shift12 = false;
+      return true;
+    }
+    if (((value & 0xFFFU) == 0U) && (value <= 0xFFF000U)) {
+      imm12 = static_cast<uint32_t>(value >> 12U);
+      shift12 = true;
+      return true;
+    }
+  }
+  return false;
+}
+
+// Whether the constant right operand of opcode fits the immediate field of its instruction
+bool hasImmediateForm(OPCode const opcode, uint64_t const constant) {
+  bool const is64 = is64BitOperation(opcode);
+  if (isComparison(opcode)) {
+    bool negate;
+    uint32_t imm12;
+    bool shift12;
+    return arithmeticImmediate(is64, constant, negate, imm12, shift12);
+  }
+  switch (opcode) {
+  case OPCode::I32_ADD:
+  case OPCode::I32_SUB:
+  case OPCode::I64_ADD:
+  case OPCode::I64_SUB: {
+    bool negate;
+    uint32_t imm12;
+    bool shift12;
+    return arithmeticImmediate(is64, constant, negate, imm12, shift12);
+  }
+  case OPCode::I32_AND:
+  case OPCode::I32_OR:
+  case OPCode::I32_XOR:
+  case OPCode::I64_AND:
+  case OPCode::I64_OR:
+  case OPCode::I64_XOR: {
+    uint32_t encoding;
+    return AArch64_Assembler::logicalImmediate(is64, constant, encoding);
+  }
+  case OPCode::I32_SHL:
+  case OPCode::I32_SHR_S:
+  case OPCode::I32_SHR_U:
+  case OPCode::I64_SHL:
+  case OPCode::I64_SHR_S:
+  case OPCode::I64_SHR_U: {
+    return true; // the count is taken modulo the width
+  }
+  default: {
+    return false;
+  }
+  }
+}
+
+// flags of lhs - constant, the constant has to fit arithmeticImmediate
+void emitCompareImmediate(AArch64_Assembler &assembler, bool const is64, TReg const lhs, uint64_t const constant) {
+  bool negate = false;
+  uint32_t imm12 = 0U;
+  bool shift12 = false;
+  static_cast<void>(arithmeticImmediate(is64, constant, negate, imm12, shift12));
+  if (negate) {
+    assembler.CMN(is64, lhs, static_cast<uint16_t>(imm12), shift12);
+  } else {
+    assembler.CMP(is64, lhs, static_cast<uint16_t>(imm12), shift12);
+  }
+}
+
+// dst = lhs <opcode> #constant, the constant has to pass hasImmediateForm (or be 0.0 for a float comparison)
+void emitImmediateOperation(AArch64_Assembler &assembler, OPCode const opcode, TReg const dst, TReg const lhs, uint64_t const constant) {
+  if (isFloatComparison(opcode)) {
+    emitFloatOperation(assembler, opcode, dst, lhs, TReg::NONE);
+    return;
+  }
+  bool const is64 = is64BitOperation(opcode);
+  uint32_t const shift = static_cast<uint32_t>(constant) & (is64 ? 63U : 31U);
+  if (isComparison(opcode)) {
+    emitCompareImmediate(assembler, is64, lhs, constant);
+    assembler.CSET(dst, comparisonCondition(opcode));
+    return;
+  }
+  switch (opcode) {
+  case OPCode::I32_ADD:
+  case OPCode::I32_SUB:
+  case OPCode::I64_ADD:
+  case OPCode::I64_SUB: {
+    bool negate = false;
+    uint32_t imm12 = 0U;
+    bool shift12 = false;
+    static_cast<void>(arithmeticImmediate(is64, constant, negate, imm12, shift12));
+    bool const isAdd = ((opcode == OPCode::I32_ADD) || (opcode == OPCode::I64_ADD)) != negate;
+    if (isAdd) {
+      assembler.ADDImmediate(is64, dst, lhs, imm12, shift12);
+    } else {
+      assembler.SUBImmediate(is64, dst, lhs, imm12, shift12);
+    }
+    break;
+  }
+  case OPCode::I32_AND:
+  case OPCode::I64_AND: {
+    assembler.ANDImmediate(is64, dst, lhs, constant);
+    break;
+  }
+  case OPCode::I32_OR:
+  case OPCode::I64_OR: {
+    assembler.ORRImmediate(is64, dst, lhs, constant);
+    break;
+  }
+  case OPCode::I32_XOR:
+  case OPCode::I64_XOR: {
+    assembler.EORImmediate(is64, dst, lhs, constant);
+    break;
+  }
+  case OPCode::I32_SHL:
+  case OPCode::I64_SHL: {
+    assembler.LSLImmediate(is64, dst, lhs, shift);
+    break;
+  }
+  case OPCode::I32_SHR_S:
+  case OPCode::I64_SHR_S: {
+    assembler.ASRImmediate(is64, dst, lhs, shift);
+    break;
+  }
+  case OPCode::I32_SHR_U:
+  case OPCode::I64_SHR_U: {
+    assembler.LSRImmediate(is64, dst, lhs, shift);
+    break;
+  }
+  default: {
+    throw std::runtime_error("error: binary operator without an immediate form.");
+  }
+  }
+}
+
+// dst = lhs <opcode> #divisor for DIV and REM by a constant divisor other than 0, neither divides nor checks for a zero divisor
+void emitConstantDivision(AArch64_Assembler &assembler, OPCode const opcode, TReg const dst, TReg const lhs, uint64_t const divisor) {
+  bool const is64 = is64BitOperation(opcode);
+  switch (opcode) {
+  case OPCode::I32_DIV_S:
+  case OPCode::I64_DIV_S: {
+    assembler.SDIVConstant(is64, dst, lhs, divisor);
+    break;
+  }
+  case OPCode::I32_DIV_U:
+  case OPCode::I64_DIV_U: {
+    assembler.UDIVConstant(is64, dst, lhs, divisor);
+    break;
+  }
+  case OPCode::I32_REM_S:
+  case OPCode::I64_REM_S: {
+    assembler.SREMConstant(is64, dst, lhs, divisor);
+    break;
+  }
+  case OPCode::I32_REM_U:
+  case OPCode::I64_REM_U: {
+    assembler.UREMConstant(is64, dst, lhs, divisor);
+    break;
+  }
+  default: {
+    throw std::runtime_error("error: not a division.");
+  }
+  }
+}
+
+// Move the value of an operand stack element into dst
+void moveToRegister(AArch64_Assembler &assembler, const StackElement &element, TReg const dst) {
+  switch (static_cast<uint32_t>(element.type)) {
+  case StackType::CONSTANT_I32: {
+    assembler.MOVimm(false, dst, element.data.constUnion.u32);
+    break;
+  }
+  case StackType::CONSTANT_I64: {
+    assembler.MOVimm(true, dst, element.data.constUnion.u64);
+    break;
+  }
+  case StackType::CONSTANT_F32: {
+    assembler.FMOVimm(false, dst, element.data.constUnion.rawF32());
+    break;
+  }
+  case StackType::CONSTANT_F64: {
+    assembler.FMOVimm(true, dst, element.data.constUnion.rawF64());
+    break;
+  }
+  case StackType::DEFERREDACTION: {
+    const StackElement::DeferredAction &action = element.data.deferred;
+    if (action.rhs == TReg::NONE) {
+      emitImmediateOperation(assembler, action.opcode, dst, action.lhs, action.rhsConstant);
+    } else {
+      emitBinaryOperation(assembler, action.opcode, dst, action.lhs, action.rhs);
+    }
+    break;
+  }
+  case StackType::LOCAL:
+  case StackType::SCRATCHREGISTER_I32:
+  case StackType::SCRATCHREGISTER_I64:
+  case StackType::SCRATCHREGISTER_F32:
+  case StackType::SCRATCHREGISTER_F64:
+  case StackType::SCRATCHREGISTER_V128: {
+    if (element.variableData.location.reg != dst) {
+      WasmType const wasmType = element.variableData.location.wasmtype;
+      if (wasmType == WasmType::VEC_TYPE) {
+        assembler.MOVVector(dst, element.variableData.location.reg);
+      } else if (isFloatType(wasmType)) {
+        assembler.FMOVRegister(wasmType == WasmType::F64, dst, element.variableData.location.reg);
+      } else {
+        assembler.MOVRegister(wasmType == WasmType::I64, dst, element.variableData.location.reg);
+      }
+    }
+    break;
+  }
+  default: {
+    throw std::runtime_error("Error: unknown op code");
+  }
+  }
+}
+
+// Register holding the value of element, constants and deferred actions are emitted into scratch first
+TReg valueRegister(AArch64_Assembler &assembler, const StackElement &element, TReg const scratch) {
+  if (isInRegister(element)) {
+    return element.variableData.location.reg;
+  }
+  moveToRegister(assembler, element, scratch);
+  return scratch;
+}
+
+StackElement scratchRegisterElement(TReg const reg, WasmType const wasmType) {
+  StackElement stackElement;
+  switch (wasmType) {
+  case WasmType::I64: {
+    stackElement.type = StackType::SCRATCHREGISTER_I64;
+    break;
+  }
+  case WasmType::F32: {
+    stackElement.type = StackType::SCRATCHREGISTER_F32;
+    break;
+  }
+  case WasmType::F64: {
+    stackElement.type = StackType::SCRATCHREGISTER_F64;
+    break;
+  }
+  case WasmType::VEC_TYPE: {
+    stackElement.type = StackType::SCRATCHREGISTER_V128;
+    break;
+  }
+  default: {
+    stackElement.type = StackType::SCRATCHREGISTER_I32;
+    break;
+  }
+  }
+  stackElement.variableData.location.reg = reg;
+  stackElement.variableData.location.wasmtype = wasmType;
+  return stackElement;
+}
+
+// Branch to target if the i32 condition is not zero (branchIfTrue) or zero. A deferred comparison is fused into CMP (FCMP for
+// floats) + B.cond, an integer one against 0 into CBZ/CBNZ, or TBZ/TBNZ on the sign bit for LT/GE. A deferred AND with a
+// single bit becomes TBZ/TBNZ on it. Any other value is tested by CBZ/CBNZ, a constant is an unconditional branch or none at all.
+void emitConditionalBranch(AArch64_Assembler &assembler, const StackElement &condition, bool const branchIfTrue,
+                           AArch64_Assembler::Label const target, TReg const scratch) {
+  if (static_cast<uint32_t>(condition.type) == StackType::CONSTANT_I32) {
+    if ((condition.data.constUnion.u32 != 0U) == branchIfTrue) {
+      assembler.B(target);
+    }
+    return;
+  }
+  if (static_cast<uint32_t>(condition.type) == StackType::DEFERREDACTION) {
+    const StackElement::DeferredAction &action = condition.data.deferred;
+    if (isFloatComparison(action.opcode)) {
+      CC const condition = floatComparisonCondition(action.opcode);
+      if (action.rhs == TReg::NONE) {
+        assembler.FCMPZero(isDoubleOperation(action.opcode), action.lhs);
+      } else {
+        assembler.FCMP(isDoubleOperation(action.opcode), action.lhs, action.rhs);
+      }
+      assembler.Bcon(branchIfTrue ? condition : static_cast<CC>(static_cast<uint32_t>(condition) ^ 1U), target);
+      return;
+    }
+    bool const is64 = is64BitOperation(action.opcode);
+    uint64_t const constant = action.rhsConstant & (is64 ? ~static_cast<uint64_t>(0U) : 0xFFFFFFFFU);
+    bool const immediate = action.rhs == TReg::NONE;
+    if (isComparison(action.opcode)) {
+      CC const condition = comparisonCondition(action.opcode);
+      // the codes come in pairs that only differ in the lowest bit
+      CC const branchCondition = branchIfTrue ? condition : static_cast<CC>(static_cast<uint32_t>(condition) ^ 1U);
+      if (immediate && (constant == 0U)) {
+        switch (branchCondition) {
+        case CC::EQ:
+        case CC::LS: {
+          assembler.CBZ(is64, action.lhs, target);
+          return;
+        }
+        case CC::NE:
+        case CC::HI: {
+          assembler.CBNZ(is64, action.lhs, target);
+          return;
+        }
+        case CC::LT: {
+          assembler.TBNZ(action.lhs, is64 ? 63U : 31U, target);
+          return;
+        }
+        case CC::GE: {
+          assembler.TBZ(action.lhs, is64 ? 63U : 31U, target);
+          return;
+        }
+        default: {
+          break;
+        }
+        }
+      }
+      if (immediate) {
+        emitCompareImmediate(assembler, is64, action.lhs, constant);
+      } else {
+        assembler.CMP(is64, action.lhs, action.rhs);
+      }
+      assembler.Bcon(branchCondition, target);
+      return;
+    }
+    bool const isAnd = (action.opcode == OPCode::I32_AND) || (action.opcode == OPCode::I64_AND);
+    if (isAnd && immediate && (constant != 0U) && ((constant & (constant - 1U)) == 0U)) {
+      uint32_t const bit = static_cast<uint32_t>(__builtin_ctzll(constant));
+      if (branchIfTrue) {
+        assembler.TBNZ(action.lhs, bit, target);
+      } else {
+        assembler.TBZ(action.lhs, bit, target);
       }
-      auto returnType = moduleInfo.getReturnTypeForSignature(moduleInfo.functionInfos[funcIndex].typeIndex);
+      return;
+    }
+  }
+  TReg const reg = valueRegister(assembler, condition, scratch);
+  if (branchIfTrue) {
+    assembler.CBNZ(false, reg, target);
+  } else {
+    assembler.CBZ(false, reg, target);
+  }
+}
+
+// Emit the operands from depth firstDepth downwards that read reg (every local and deferred action if reg is NONE) into the
+// register of their slot. Needed before reg is overwritten, and before control flow splits so the copies are made on every path.
+void materializeOperands(AArch64_Assembler &assembler, Stack &stack, size_t const firstDepth, TReg const reg,
+                         const ModuleInfo::FunctionInfo &functionInfo) {
+  for (size_t depth = firstDepth; depth < stack.size(); ++depth) {
+    StackElement &element = stack.peek(depth);
+    uint32_t const type = static_cast<uint32_t>(element.type);
+    bool reads;
+    if (type == StackType::LOCAL) {
+      reads = (reg == TReg::NONE) || (element.variableData.location.reg == reg);
+    } else if (type == StackType::DEFERREDACTION) {
+      reads = (reg == TReg::NONE) || (element.data.deferred.lhs == reg) || (element.data.deferred.rhs == reg);
+    } else {
+      reads = false;
+    }
+    if (reads) {
+      WasmType const wasmType = elementType(element);
+      TReg const slotReg = slotRegister(functionInfo, stack.size() - 1U - depth, wasmType);
+      moveToRegister(assembler, element, slotReg);
+      element = scratchRegisterElement(slotReg, wasmType);
+    }
+  }
+}
+
+bool isConstant(const StackElement &element) {
+  return static_cast<uint32_t>(element.type & StackType::BASEMASK) == StackType::CONSTANT;
+}
+
+// value of a constant, the raw bits for floats
+uint64_t constantValue(const StackElement &element) {
+  uint32_t const type = static_cast<uint32_t>(element.type);
+  return ((type == StackType::CONSTANT_I64) || (type == StackType::CONSTANT_F64)) ? element.data.constUnion.u64 : element.data.constUnion.u32;
+}
+
+StackElement constantElement(uint64_t const value, WasmType const wasmType) {
+  return (wasmType == WasmType::I64) ? StackElement::i64Const(value) : StackElement::i32Const(static_cast<uint32_t>(value));
+}
+
+bool isCommutative(OPCode const opcode) {
+  switch (opcode) {
+  case OPCode::I32_ADD:
+  case OPCode::I32_MUL:
+  case OPCode::I32_AND:
+  case OPCode::I32_OR:
+  case OPCode::I32_XOR:
+  case OPCode::I64_ADD:
+  case OPCode::I64_MUL:
+  case OPCode::I64_AND:
+  case OPCode::I64_OR:
+  case OPCode::I64_XOR: {
+    return true;
+  }
+  default: {
+    return false;
+  }
+  }
+}
+
+// Evaluate lhs <opcode> rhs with the wrap around, shift count and signedness rules of wasm
+// @return false for the divisions that trap, they are left to the generated code
+bool foldConstants(OPCode const opcode, uint64_t const lhs, uint64_t const rhs, uint64_t &result) {
+  bool const is64 = is64BitOperation(opcode);
+  uint64_t const mask = is64 ? ~static_cast<uint64_t>(0U) : 0xFFFFFFFFU;
+  int64_t const signedLhs = is64 ? static_cast<int64_t>(lhs) : static_cast<int64_t>(static_cast<int32_t>(lhs));
+  int64_t const signedRhs = is64 ? static_cast<int64_t>(rhs) : static_cast<int64_t>(static_cast<int32_t>(rhs));
+  int64_t const minValue = is64 ? INT64_MIN : INT32_MIN;
+  uint32_t const count = static_cast<uint32_t>(rhs) & (is64 ? 63U : 31U);
+  if (isComparison(opcode)) {
+    bool const results[] = {lhs == rhs,           lhs != rhs,          signedLhs < signedRhs, lhs < rhs,
+                            signedLhs > signedRhs, lhs > rhs,           signedLhs <= signedRhs, lhs <= rhs,
+                            signedLhs >= signedRhs, lhs >= rhs};
+    result = results[comparisonIndex(opcode)] ? 1U : 0U;
+    return true;
+  }
+  switch (opcode) {
+  case OPCode::I32_ADD:
+  case OPCode::I64_ADD: {
+    result = lhs + rhs;
+    break;
+  }
+  case OPCode::I32_SUB:
+  case OPCode::I64_SUB: {
+    result = lhs - rhs;
+    break;
+  }
+  case OPCode::I32_MUL:
+  case OPCode::I64_MUL: {
+    result = lhs * rhs;
+    break;
+  }
+  case OPCode::I32_DIV_S:
+  case OPCode::I64_DIV_S: {
+    if ((rhs == 0U) || ((signedRhs == -1) && (signedLhs == minValue))) {
+      return false;
+    }
+    result = static_cast<uint64_t>(signedLhs / signedRhs);
+    break;
+  }
+  case OPCode::I32_DIV_U:
+  case OPCode::I64_DIV_U: {
+    if (rhs == 0U) {
+      return false;
+    }
+    result = lhs / rhs;
+    break;
+  }
+  case OPCode::I32_REM_S:
+  case OPCode::I64_REM_S: {
+    if (rhs == 0U) {
+      return false;
+    }
+    result = (signedRhs == -1) ? 0U : static_cast<uint64_t>(signedLhs % signedRhs);
+    break;
+  }
+  case OPCode::I32_REM_U:
+  case OPCode::I64_REM_U: {
+    if (rhs == 0U) {
+      return false;
+    }
+    result = lhs % rhs;
+    break;
+  }
+  case OPCode::I32_AND:
+  case OPCode::I64_AND: {
+    result = lhs & rhs;
+    break;
+  }
+  case OPCode::I32_OR:
+  case OPCode::I64_OR: {
+    result = lhs | rhs;
+    break;
+  }
+  case OPCode::I32_XOR:
+  case OPCode::I64_XOR: {
+    result = lhs ^ rhs;
+    break;
+  }
+  case OPCode::I32_SHL:
+  case OPCode::I64_SHL: {
+    result = lhs << count;
+    break;
+  }
+  case OPCode::I32_SHR_S:
+  case OPCode::I64_SHR_S: {
+    result = static_cast<uint64_t>(signedLhs >> count);
+    break;
+  }
+  case OPCode::I32_SHR_U:
+  case OPCode::I64_SHR_U: {
+    result = lhs >> count;
+    break;
+  }
+  default: {
+    return false;
+  }
+  }
+  result &= mask;
+  return true;
+}
+
+// Trap a division by the constant divisor raises for sure (a zero divisor, or -1 with the minimum value as constant dividend),
+// 0 if it may not trap
+uint32_t constantDivisionTrap(OPCode const opcode, const StackElement &left, uint64_t const divisor) {
+  bool const is64 = is64BitOperation(opcode);
+  uint64_t const mask = is64 ? ~static_cast<uint64_t>(0U) : 0xFFFFFFFFU;
+  uint64_t const minValue = is64 ? 0x8000000000000000U : 0x80000000U;
+  if ((divisor & mask) == 0U) {
+    return 1U;
+  }
+  bool const isSignedDivision = (opcode == OPCode::I32_DIV_S) || (opcode == OPCode::I64_DIV_S);
+  if (isSignedDivision && ((divisor & mask) == mask) && isConstant(left) && (constantValue(left) == minValue)) {
+    return 2U;
+  }
+  return 0U;
+}
+
+// what x <opcode> constant simplifies to
+enum class Identity : uint8_t { NONE, LEFT, ZERO };
+
+Identity algebraicIdentity(OPCode const opcode, uint64_t const constant) {
+  bool const is64 = is64BitOperation(opcode);
+  uint64_t const mask = is64 ? ~static_cast<uint64_t>(0U) : 0xFFFFFFFFU;
+  uint64_t const value = constant & mask;
+  switch (opcode) {
+  case OPCode::I32_ADD:
+  case OPCode::I32_SUB:
+  case OPCode::I32_OR:
+  case OPCode::I32_XOR:
+  case OPCode::I64_ADD:
+  case OPCode::I64_SUB:
+  case OPCode::I64_OR:
+  case OPCode::I64_XOR: {
+    return (value == 0U) ? Identity::LEFT : Identity::NONE;
+  }
+  case OPCode::I32_SHL:
+  case OPCode::I32_SHR_S:
+  case OPCode::I32_SHR_U:
+  case OPCode::I64_SHL:
+  case OPCode::I64_SHR_S:
+  case OPCode::I64_SHR_U: {
+    return ((value & (is64 ? 63U : 31U)) == 0U) ? Identity::LEFT : Identity::NONE;
+  }
+  case OPCode::I32_MUL:
+  case OPCode::I64_MUL: {
+    return (value == 1U) ? Identity::LEFT : ((value == 0U) ? Identity::ZERO : Identity::NONE);
+  }
+  case OPCode::I32_DIV_S:
+  case OPCode::I32_DIV_U:
+  case OPCode::I64_DIV_S:
+  case OPCode::I64_DIV_U: {
+    return (value == 1U) ? Identity::LEFT : Identity::NONE;
+  }
+  case OPCode::I32_REM_S:
+  case OPCode::I64_REM_S: {
+    return ((value == 1U) || (value == mask)) ? Identity::ZERO : Identity::NONE;
+  }
+  case OPCode::I32_REM_U:
+  case OPCode::I64_REM_U: {
+    return (value == 1U) ? Identity::ZERO : Identity::NONE;
+  }
+  case OPCode::I32_AND:
+  case OPCode::I64_AND: {
+    return (value == mask) ? Identity::LEFT : ((value == 0U) ? Identity::ZERO : Identity::NONE);
+  }
+  default: {
+    return Identity::NONE;
+  }
+  }
+}
+
+// Binary integer operator, folded at compile time where possible:
+// - two constants are evaluated (divisions that trap excepted), a division by a constant that always traps becomes the trap
+// - x+0, x-0, x|0, x^0, x<<0, x*1, x/1 and x&-1 are x, x*0, x&0 and x%1 are 0, x*2^n is x<<n
+// - the other divisions by a constant become shifts or a multiply-high without trap checks, a constant dividend other than
+//   the minimum value drops the overflow check of a signed division
+// Otherwise a right operand in a local register, or a constant that fits the immediate field of the instruction, makes it a
+// deferred action that is emitted straight into the register that consumes the result (a constant left operand of a
+// commutative operator or a comparison is swapped to the right first). A comparison that a branch consumes next
+// (branchFollows) is deferred with any right operand, the branch emits it as CMP + B.cond. Everything else, and divisions
+// (they may trap), is emitted now into the register of the result slot.
+void binaryOperator(AArch64_Assembler &assembler, Stack &stack, OPCode const opcode, WasmType const resultType, const ModuleInfo &moduleInfo,
+                    const ModuleInfo::FunctionInfo &functionInfo, bool const branchFollows = false) {
+  if (stack.size() < 2U) {
+    throw std::runtime_error("error: stack size less than 2, parse binary operator error.");
+  }
+  size_t const slot = stack.size() - 2U;
+  StackElement right = stack.peek(0U);
+  StackElement left = stack.peek(1U);
+  TReg const dst = operandRegister(functionInfo, slot);
+  uint64_t folded = 0U;
+  if (isConstant(left) && isConstant(right) && foldConstants(opcode, constantValue(left), constantValue(right), folded)) {
+    stack.pop(2U);
+    stack.push(constantElement(folded, resultType));
+    return;
+  }
+  if (isDivision(opcode) && isConstant(right)) {
+    uint32_t const trapCode = constantDivisionTrap(opcode, left, constantValue(right));
+    if (trapCode != 0U) {
+      // what follows up to the end of the block is unreachable, it is still compiled against a result in the slot register
+      assembler.Trap(trapCode);
+      stack.pop(2U);
+      stack.push(scratchRegisterElement(dst, resultType));
+      return;
+    }
+  }
+
+  OPCode operation = opcode;
+  bool swapped = false;
+  if (moduleInfo.immediateSelection && isConstant(left) && !isConstant(right) && (isCommutative(opcode) || isComparison(opcode))) {
+    std::swap(left, right);
+    operation = isComparison(opcode) ? mirroredComparison(opcode) : opcode;
+    swapped = true;
+  }
+  if (isConstant(right)) {
+    Identity const identity = algebraicIdentity(operation, constantValue(right));
+    if (identity != Identity::NONE) {
+      StackElement result = left;
+      if (identity == Identity::ZERO) {
+        result = constantElement(0U, resultType);
+      } else if (swapped && (static_cast<uint32_t>(left.type) != StackType::LOCAL)) {
+        // came from the slot above, its register is handed to the next operand
+        moveToRegister(assembler, left, dst);
+        result = scratchRegisterElement(dst, resultType);
+      }
+      stack.pop(2U);
+      stack.push(result);
+      return;
+    }
+    uint64_t const multiplier = constantValue(right);
+    if (((operation == OPCode::I32_MUL) || (operation == OPCode::I64_MUL)) && ((multiplier & (multiplier - 1U)) == 0U)) {
+      operation = (operation == OPCode::I64_MUL) ? OPCode::I64_SHL : OPCode::I32_SHL;
+      right = constantElement(static_cast<uint64_t>(__builtin_ctzll(multiplier)), resultType);
+    }
+    if (isDivision(operation) && moduleInfo.constantDivision) {
+      TReg const lhs = valueRegister(assembler, left, dst);
+      emitConstantDivision(assembler, operation, dst, lhs, constantValue(right));
+      stack.pop(2U);
+      stack.push(scratchRegisterElement(dst, resultType));
+      return;
+    }
+  }
+
+  bool const immediate = moduleInfo.immediateSelection && isConstant(right) && hasImmediateForm(operation, constantValue(right));
+  // a left operand in a scratch register is always in the register of its own slot, which the result takes over
+  TReg const lhs = valueRegister(assembler, left, dst);
+  bool const stableLeft = (static_cast<uint32_t>(left.type) == StackType::LOCAL) || (lhs == dst);
+  bool const deferrable = !isDivision(operation) && stableLeft && (immediate || (static_cast<uint32_t>(right.type) == StackType::LOCAL));
+  // nothing is emitted before the branch, so the operand registers are still intact there
+  bool const fused = isComparison(operation) && branchFollows;
+  // a swapped left operand may still be in the register of the slot above, the result register is free then
+  TReg const above = operandRegister(functionInfo, slot + 1U);
+  TReg const rhsScratch = (lhs == above) ? dst : above;
+  StackElement result;
+  if ((deferrable || fused) && immediate) {
+    result = StackElement::action(operation, lhs, TReg::NONE, resultType, constantValue(right));
+  } else if (deferrable) {
+    result = StackElement::action(operation, lhs, right.variableData.location.reg, resultType);
+  } else if (fused) {
+    TReg const rhs = valueRegister(assembler, right, rhsScratch);
+    result = StackElement::action(operation, lhs, rhs, resultType);
+  } else if (immediate) {
+    emitImmediateOperation(assembler, operation, dst, lhs, constantValue(right));
+    result = scratchRegisterElement(dst, resultType);
+  } else {
+    TReg const rhs = valueRegister(assembler, right, rhsScratch);
+    bool const isSignedDivision = (operation == OPCode::I32_DIV_S) || (operation == OPCode::I64_DIV_S);
+    if (isSignedDivision && isConstant(left) && moduleInfo.constantDivision) {
+      uint64_t const minValue = is64BitOperation(operation) ? 0x8000000000000000U : 0x80000000U;
+      assembler.SDIV(is64BitOperation(operation), dst, lhs, rhs, constantValue(left) == minValue);
+    } else {
+      emitBinaryOperation(assembler, operation, dst, lhs, rhs);
+    }
+    result = scratchRegisterElement(dst, resultType);
+  }
+  stack.pop(2U);
+  stack.push(result);
+}
+
+// Binary float operator, emitted right away into the float register of the result slot (the integer one for comparisons). A
+// comparison that a branch consumes next (branchFollows) is deferred like an integer one, the branch emits it as FCMP + B.cond.
+// A comparison with the constant 0.0 compares with the immediate #0.0.
+void floatBinaryOperator(AArch64_Assembler &assembler, Stack &stack, OPCode const opcode, const ModuleInfo::FunctionInfo &functionInfo,
+                         bool const branchFollows = false) {
+  if (stack.size() < 2U) {
+    throw std::runtime_error("error: stack size less than 2, parse float binary operator error.");
+  }
+  size_t const slot = stack.size() - 2U;
+  WasmType const operandType = isDoubleOperation(opcode) ? WasmType::F64 : WasmType::F32;
+  StackElement const right = stack.peek(0U);
+  StackElement const left = stack.peek(1U);
+  TReg const lhs = valueRegister(assembler, left, floatOperandRegister(functionInfo, slot));
+  bool const comparison = isFloatComparison(opcode);
+  // -0.0 compares equal to 0.0
+  uint64_t const magnitudeMask = (operandType == WasmType::F64) ? 0x7FFFFFFFFFFFFFFFU : 0x7FFFFFFFU;
+  bool const withZero = comparison && isConstant(right) && ((constantValue(right) & magnitudeMask) == 0U);
+  TReg const rhs = withZero ? TReg::NONE : valueRegister(assembler, right, floatOperandRegister(functionInfo, slot + 1U));
+  WasmType const resultType = comparison ? WasmType::I32 : operandType;
+  StackElement result;
+  if (comparison && branchFollows) {
+    result = StackElement::action(opcode, lhs, rhs, resultType);
+  } else {
+    TReg const dst = slotRegister(functionInfo, slot, resultType);
+    emitFloatOperation(assembler, opcode, dst, lhs, rhs);
+    result = scratchRegisterElement(dst, resultType);
+  }
+  stack.pop(2U);
+  stack.push(result);
+}
+
+// Operand and result type of a unary operator
+struct UnaryTypes {
+  WasmType operand;
+  WasmType result;
+};
+
+UnaryTypes unaryOperatorTypes(OPCode const opcode) {
+  switch (opcode) {
+  case OPCode::F32_ABS:
+  case OPCode::F32_NEG:
+  case OPCode::F32_CEIL:
+  case OPCode::F32_FLOOR:
+  case OPCode::F32_TRUNC:
+  case OPCode::F32_NEAREST:
+  case OPCode::F32_SQRT: {
+    return {WasmType::F32, WasmType::F32};
+  }
+  case OPCode::F64_ABS:
+  case OPCode::F64_NEG:
+  case OPCode::F64_CEIL:
+  case OPCode::F64_FLOOR:
+  case OPCode::F64_TRUNC:
+  case OPCode::F64_NEAREST:
+  case OPCode::F64_SQRT: {
+    return {WasmType::F64, WasmType::F64};
+  }
+  case OPCode::I32_WRAP_I64: {
+    return {WasmType::I64, WasmType::I32};
+  }
+  case OPCode::I32_TRUNC_F32_S:
+  case OPCode::I32_TRUNC_F32_U:
+  case OPCode::I32_TRUNC_SAT_F32_S:
+  case OPCode::I32_TRUNC_SAT_F32_U:
+  case OPCode::I32_REINTERPRET_F32: {
+    return {WasmType::F32, WasmType::I32};
+  }
+  case OPCode::I32_TRUNC_F64_S:
+  case OPCode::I32_TRUNC_F64_U:
+  case OPCode::I32_TRUNC_SAT_F64_S:
+  case OPCode::I32_TRUNC_SAT_F64_U: {
+    return {WasmType::F64, WasmType::I32};
+  }
+  case OPCode::I64_EXTEND_I32_S:
+  case OPCode::I64_EXTEND_I32_U: {
+    return {WasmType::I32, WasmType::I64};
+  }
+  case OPCode::I64_TRUNC_F32_S:
+  case OPCode::I64_TRUNC_F32_U:
+  case OPCode::I64_TRUNC_SAT_F32_S:
+  case OPCode::I64_TRUNC_SAT_F32_U: {
+    return {WasmType::F32, WasmType::I64};
+  }
+  case OPCode::I64_TRUNC_F64_S:
+  case OPCode::I64_TRUNC_F64_U:
+  case OPCode::I64_TRUNC_SAT_F64_S:
+  case OPCode::I64_TRUNC_SAT_F64_U:
+  case OPCode::I64_REINTERPRET_F64: {
+    return {WasmType::F64, WasmType::I64};
+  }
+  case OPCode::F32_CONVERT_I32_S:
+  case OPCode::F32_CONVERT_I32_U:
+  case OPCode::F32_REINTERPRET_I32: {
+    return {WasmType::I32, WasmType::F32};
+  }
+  case OPCode::F32_CONVERT_I64_S:
+  case OPCode::F32_CONVERT_I64_U: {
+    return {WasmType::I64, WasmType::F32};
+  }
+  case OPCode::F32_DEMOTE_F64: {
+    return {WasmType::F64, WasmType::F32};
+  }
+  case OPCode::F64_CONVERT_I32_S:
+  case OPCode::F64_CONVERT_I32_U: {
+    return {WasmType::I32, WasmType::F64};
+  }
+  case OPCode::F64_CONVERT_I64_S:
+  case OPCode::F64_CONVERT_I64_U:
+  case OPCode::F64_REINTERPRET_I64: {
+    return {WasmType::I64, WasmType::F64};
+  }
+  case OPCode::F64_PROMOTE_F32: {
+    return {WasmType::F32, WasmType::F64};
+  }
+  default: {
+    throw std::runtime_error("error: unsupported unary operator.");
+  }
+  }
+}
+
+// dst = <opcode> src for the unary operators. The trapping truncations check with TruncateToInteger, the saturating ones are
+// a plain FCVTZS/FCVTZU, which saturates and converts NaN to 0 like wasm.
+void emitUnaryOperation(AArch64_Assembler &assembler, OPCode const opcode, TReg const dst, TReg const src) {
+  UnaryTypes const types = unaryOperatorTypes(opcode);
+  bool const fromDouble = types.operand == WasmType::F64;
+  bool const fromI64 = types.operand == WasmType::I64;
+  bool const toDouble = types.result == WasmType::F64;
+  bool const toI64 = types.result == WasmType::I64;
+  switch (opcode) {
+  case OPCode::F32_ABS:
+  case OPCode::F64_ABS: {
+    assembler.FABS(fromDouble, dst, src);
+    break;
+  }
+  case OPCode::F32_NEG:
+  case OPCode::F64_NEG: {
+    assembler.FNEG(fromDouble, dst, src);
+    break;
+  }
+  case OPCode::F32_CEIL:
+  case OPCode::F64_CEIL: {
+    assembler.FRINTP(fromDouble, dst, src);
+    break;
+  }
+  case OPCode::F32_FLOOR:
+  case OPCode::F64_FLOOR: {
+    assembler.FRINTM(fromDouble, dst, src);
+    break;
+  }
+  case OPCode::F32_TRUNC:
+  case OPCode::F64_TRUNC: {
+    assembler.FRINTZ(fromDouble, dst, src);
+    break;
+  }
+  case OPCode::F32_NEAREST:
+  case OPCode::F64_NEAREST: {
+    assembler.FRINTN(fromDouble, dst, src);
+    break;
+  }
+  case OPCode::F32_SQRT:
+  case OPCode::F64_SQRT: {
+    assembler.FSQRT(fromDouble, dst, src);
+    break;
+  }
+  case OPCode::I32_WRAP_I64:
+  case OPCode::I64_EXTEND_I32_U: {
+    assembler.MOVRegister(false, dst, src); // writing the W register clears the upper half
+    break;
+  }
+  case OPCode::I64_EXTEND_I32_S: {
+    assembler.Sxtw(dst, src);
+    break;
+  }
+  case OPCode::I32_TRUNC_F32_S:
+  case OPCode::I32_TRUNC_F64_S:
+  case OPCode::I64_TRUNC_F32_S:
+  case OPCode::I64_TRUNC_F64_S: {
+    assembler.TruncateToInteger(true, fromDouble, toI64, dst, src);
+    break;
+  }
+  case OPCode::I32_TRUNC_F32_U:
+  case OPCode::I32_TRUNC_F64_U:
+  case OPCode::I64_TRUNC_F32_U:
+  case OPCode::I64_TRUNC_F64_U: {
+    assembler.TruncateToInteger(false, fromDouble, toI64, dst, src);
+    break;
+  }
+  case OPCode::I32_TRUNC_SAT_F32_S:
+  case OPCode::I32_TRUNC_SAT_F64_S:
+  case OPCode::I64_TRUNC_SAT_F32_S:
+  case OPCode::I64_TRUNC_SAT_F64_S: {
+    assembler.FCVTZS(fromDouble, toI64, dst, src);
+    break;
+  }
+  case OPCode::I32_TRUNC_SAT_F32_U:
+  case OPCode::I32_TRUNC_SAT_F64_U:
+  case OPCode::I64_TRUNC_SAT_F32_U:
+  case OPCode::I64_TRUNC_SAT_F64_U: {
+    assembler.FCVTZU(fromDouble, toI64, dst, src);
+    break;
+  }
+  case OPCode::F32_CONVERT_I32_S:
+  case OPCode::F32_CONVERT_I64_S:
+  case OPCode::F64_CONVERT_I32_S:
+  case OPCode::F64_CONVERT_I64_S: {
+    assembler.SCVTF(toDouble, fromI64, dst, src);
+    break;
+  }
+  case OPCode::F32_CONVERT_I32_U:
+  case OPCode::F32_CONVERT_I64_U:
+  case OPCode::F64_CONVERT_I32_U:
+  case OPCode::F64_CONVERT_I64_U: {
+    assembler.UCVTF(toDouble, fromI64, dst, src);
+    break;
+  }
+  case OPCode::F32_DEMOTE_F64: {
+    assembler.FCVT(false, dst, src);
+    break;
+  }
+  case OPCode::F64_PROMOTE_F32: {
+    assembler.FCVT(true, dst, src);
+    break;
+  }
+  case OPCode::I32_REINTERPRET_F32:
+  case OPCode::I64_REINTERPRET_F64: {
+    assembler.FMOVToGeneral(fromDouble, dst, src);
+    break;
+  }
+  case OPCode::F32_REINTERPRET_I32:
+  case OPCode::F64_REINTERPRET_I64: {
+    assembler.FMOVFromGeneral(toDouble, dst, src);
+    break;
+  }
+  default: {
+    throw std::runtime_error("error: unsupported unary operator.");
+  }
+  }
+}
+
+// Unary operator: the float ABS to SQRT and the conversions, emitted right away into the register of the slot of its operand
+// that suits the result type
+void unaryOperator(AArch64_Assembler &assembler, Stack &stack, OPCode const opcode, const ModuleInfo::FunctionInfo &functionInfo) {
+  if (stack.empty()) {
+    throw std::runtime_error("error: stack is empty, parse unary operator error.");
+  }
+  size_t const slot = stack.size() - 1U;
+  UnaryTypes const types = unaryOperatorTypes(opcode);
+  TReg const src = valueRegister(assembler, stack.top(), slotRegister(functionInfo, slot, types.operand));
+  TReg const dst = slotRegister(functionInfo, slot, types.result);
+  emitUnaryOperation(assembler, opcode, dst, src);
+  stack.pop();
+  stack.push(scratchRegisterElement(dst, types.result));
+}
+
+// Leave the current arm of frame: move its result into the result register and drop what the arm left on the operand stack
+void closeArm(AArch64_Assembler &assembler, Stack &stack, const ControlFrame &frame) {
+  if (stack.size() < frame.stackHeight) {
+    throw std::runtime_error("error: operand stack underflow inside a block.");
+  }
+  if (frame.resultType != WasmType::TVOID) {
+    if (stack.size() > frame.stackHeight) {
+      moveToRegister(assembler, stack.top(), frame.resultReg);
+    } else if (!frame.unreachable) {
+      throw std::runtime_error("error: block ends without its result on the operand stack.");
+    }
+  }
+  stack.pop(stack.size() - frame.stackHeight);
+}
+
+StackElement blockResult(const ControlFrame &frame) {
+  return scratchRegisterElement(frame.resultReg, frame.resultType);
+}
+
+// Locals live in a register or, if the register allocator spilled them, in an 8 byte slot at [SP, #stackFramePosition] (two
+// slots 16 byte aligned for a v128)
+bool isSpilled(const ModuleInfo::LocalVar &localVar) {
+  return localVar.currentStorageType == StorageType::STACKMEMORY;
+}
+
+// LDR (load) or STR of a value of wasmType from or to its spill slot
+MemOp spillOperation(WasmType const wasmType, bool const load) {
+  switch (wasmType) {
+  case WasmType::I64: {
+    return load ? MemOp::LDRX : MemOp::STRX;
+  }
+  case WasmType::F32: {
+    return load ? MemOp::LDRS : MemOp::STRS;
+  }
+  case WasmType::F64: {
+    return load ? MemOp::LDRD : MemOp::STRD;
+  }
+  case WasmType::VEC_TYPE: {
+    return load ? MemOp::LDRQ : MemOp::STRQ;
+  }
+  default: {
+    return load ? MemOp::LDRW : MemOp::STRW;
+  }
+  }
+}
+
+// sub/add sp, sp, #size for frame sizes below 16 MiB
+void adjustStackPointer(AArch64_Assembler &assembler, bool const allocate, uint32_t const size) {
+  uint32_t const high = (size >> 12U) & 0xFFFU;
+  uint32_t const low = size & 0xFFFU;
+  if (high != 0U) {
+    if (allocate) {
+      assembler.SUBImmediate(true, TReg::SP, TReg::SP, high, true);
+    } else {
+      assembler.ADDImmediate(true, TReg::SP, TReg::SP, high, true);
+    }
+  }
+  if (low != 0U) {
+    if (allocate) {
+      assembler.SUBImmediate(true, TReg::SP, TReg::SP, low);
+    } else {
+      assembler.ADDImmediate(true, TReg::SP, TReg::SP, low);
+    }
+  }
+}
+
+// Prologue: reserve the spill slots, move spilled params into their slots and zero the locals whose implicit zero can be read
+void emitPrologue(AArch64_Assembler &assembler, const std::vector<ModuleInfo::LocalVar> &localVars, const ModuleInfo::FunctionInfo &functionInfo) {
+  if (functionInfo.stackFrameSize > 16384U) {
+    // 32 bit LDR/STR reach 16 KiB above SP
+    throw std::runtime_error("error: too many spilled locals for the stack frame.");
+  }
+  adjustStackPointer(assembler, true, functionInfo.stackFrameSize);
+  // params first, their registers may already be handed to locals that are zeroed below
+  uint32_t numGPRParams = 0U;
+  uint32_t numFPRParams = 0U;
+  for (size_t j = 0U; j < functionInfo.numParams; ++j) {
+    const ModuleInfo::LocalVar &param = localVars[j];
+    bool const isFloat = usesFloatRegister(param.wasmType);
+    TReg const incoming = isFloat ? floatRegister(numFPRParams++) : static_cast<TReg>(numGPRParams++);
+    if (isSpilled(param)) {
+      assembler.LoadStoreImmediate(spillOperation(param.wasmType, false), incoming, TReg::SP, param.stackFramePosition);
+    }
+  }
+  for (size_t j = functionInfo.numParams; j < localVars.size(); ++j) {
+    const ModuleInfo::LocalVar &localVar = localVars[j];
+    if (!localVar.zeroOnEntry) {
+      continue;
+    }
+    bool const is64 = (localVar.wasmType == WasmType::I64) || (localVar.wasmType == WasmType::F64);
+    if (localVar.wasmType == WasmType::VEC_TYPE) {
+      if (isSpilled(localVar)) {
+        assembler.STRImmediate(true, TReg::ZR, TReg::SP, localVar.stackFramePosition);
+        assembler.STRImmediate(true, TReg::ZR, TReg::SP, localVar.stackFramePosition + 8U);
+      } else {
+        assembler.MOVIZero(localVar.reg);
+      }
+    } else if (isSpilled(localVar)) {
+      assembler.STRImmediate(is64, TReg::ZR, TReg::SP, localVar.stackFramePosition);
+    } else if (isFloatType(localVar.wasmType)) {
+      assembler.FMOVimm(is64, localVar.reg, 0U);
+    } else {
+      assembler.MOVimm(is64, localVar.reg, 0);
+    }
+  }
+}
+
+// Epilogue of every return path: release the stack frame, the return value is in R0 already
+void emitReturn(AArch64_Assembler &assembler, const ModuleInfo::FunctionInfo &functionInfo) {
+  adjustStackPointer(assembler, false, functionInfo.stackFrameSize);
+  assembler.Ret();
+}
+
+// Frame a branch with relative depth targets, nullptr for the function body itself (the branch returns)
+const ControlFrame *branchTarget(const std::vector<ControlFrame> &controlFrames, uint32_t const depth) {
+  if (depth > controlFrames.size()) {
+    throw std::runtime_error("error: branch depth exceeds the enclosing blocks.");
+  }
+  return (depth == controlFrames.size()) ? nullptr : &controlFrames[controlFrames.size() - 1U - depth];
+}
+
+// true if a branch to frame passes the top of the operand stack along: the result of a BLOCK or IF, or the return value
+bool branchCarriesValue(const ControlFrame *const frame, const Stack &stack) {
+  if (frame == nullptr) {
+    return !stack.empty();
+  }
+  return (frame->opcode != OPCode::LOOP) && (frame->resultType != WasmType::TVOID);
+}
+
+// Branch to frame: back to the start of a LOOP, to the end of a BLOCK or IF with the top of the operand stack in its result
+// register, or out of the function with it in R0 (F0 for floats). The operand stack is left as it is, after BR_IF the value is still there.
+void emitBranchTo(AArch64_Assembler &assembler, const Stack &stack, const ControlFrame *const frame, const ModuleInfo::FunctionInfo &functionInfo) {
+  if (branchCarriesValue(frame, stack)) {
+    if (stack.empty() || ((frame != nullptr) && (stack.size() <= frame->stackHeight))) {
+      throw std::runtime_error("error: branch without the block result on the operand stack.");
+    }
+    moveToRegister(assembler, stack.top(), (frame == nullptr) ? resultRegister(elementType(stack.top())) : frame->resultReg);
+  }
+  if (frame == nullptr) {
+    emitReturn(assembler, functionInfo);
+  } else {
+    assembler.B((frame->opcode == OPCode::LOOP) ? frame->loopLabel : frame->endLabel);
+  }
+}
+
+// Every register a local may live in (bit n = TReg n), saved around a call if the register allocator has no liveness for it
+uint64_t localRegisterMask(const ModuleInfo::FunctionInfo &functionInfo) {
+  uint64_t mask = (static_cast<uint64_t>(1U) << functionInfo.numLocalsInGPR) - 1U;
+  for (uint32_t j = 0U; j < functionInfo.numLocalsInFPR; ++j) {
+    mask |= static_cast<uint64_t>(1U) << static_cast<uint32_t>(floatRegister(j));
+  }
+  return mask;
+}
+
+// Registers pushed around a call, the float ones as whole Q registers if a v128 may be in one of them
+struct SavedRegisters {
+  std::vector<TReg> registers;
+  bool wholeVectors;
+};
+
+// Push what a call clobbers and the code after it still needs: the registers of the locals in callSaveMask, the operand stack
+// registers of the slots below numKept that hold a value, and LR. X and D (or Q) registers are pushed in pairs of their own, ZR or
+// F31 fills up the last one.
+// @return The pushed registers, for restoreCallerRegisters
+SavedRegisters saveCallerRegisters(AArch64_Assembler &assembler, const Stack &stack, size_t const numKept, uint64_t const callSaveMask,
+                                   const ModuleInfo::FunctionInfo &functionInfo) {
+  std::vector<TReg> gprs;
+  std::vector<TReg> fprs;
+  bool wholeVectors = functionInfo.usesVectorRegisters;
+  auto const save = [&gprs, &fprs](TReg const reg) {
+    if (isFloatRegister(reg)) {
+      fprs.push_back(reg);
+    } else {
+      gprs.push_back(reg);
+    }
+  };
+  for (uint32_t reg = 0U; reg < 64U; ++reg) {
+    if ((callSaveMask & (static_cast<uint64_t>(1U) << reg)) != 0U) {
+      save(static_cast<TReg>(reg));
+    }
+  }
+  for (size_t slot = 0U; slot < numKept; ++slot) {
+    // a deferred action reads locals (saved above if still needed) or the register of its own slot
+    const StackElement &element = stack.peek(stack.size() - 1U - slot);
+    uint32_t const type = static_cast<uint32_t>(element.type);
+    if (((type & StackType::BASEMASK) == StackType::SCRATCHREGISTER) || (type == StackType::DEFERREDACTION)) {
+      save(slotRegister(functionInfo, slot, elementType(element)));
+      wholeVectors = wholeVectors || (elementType(element) == WasmType::VEC_TYPE);
+    }
+  }
+  gprs.push_back(TReg::LR);
+  if ((gprs.size() % 2U) != 0U) {
+    gprs.push_back(TReg::ZR);
+  }
+  if ((fprs.size() % 2U) != 0U) {
+    fprs.push_back(TReg::F31);
+  }
+  SavedRegisters saved{std::move(gprs), wholeVectors};
+  saved.registers.insert(saved.registers.end(), fprs.begin(), fprs.end());
+  for (size_t j = 0U; j < saved.registers.size(); j += 2U) {
+    if (wholeVectors && isFloatRegister(saved.registers[j])) {
+      assembler.STPVectorPreIndex(saved.registers[j], saved.registers[j + 1U], TReg::SP, -32);
+    } else {
+      assembler.STPPreIndex(saved.registers[j], saved.registers[j + 1U], TReg::SP, -16);
+    }
+  }
+  return saved;
+}
+
+void restoreCallerRegisters(AArch64_Assembler &assembler, const SavedRegisters &saved) {
+  for (size_t j = saved.registers.size() - 2U;; j -= 2U) {
+    if (saved.wholeVectors && isFloatRegister(saved.registers[j])) {
+      assembler.LDPVectorPostIndex(saved.registers[j], saved.registers[j + 1U], TReg::SP, 32);
+    } else {
+      assembler.LDPPostIndex(saved.registers[j], saved.registers[j + 1U], TReg::SP, 16);
+    }
+    if (j == 0U) {
+      break;
+    }
+  }
+}
+
+// Direct call. Every register is caller-saved: the locals live across the call (callSaveMask), the operand stack registers below
+// the arguments and LR are pushed around the BL. Arguments are passed like the params of a host invocation, integers in X0 and
+// floats in floatRegister(0) upwards, and the result comes back in X0 or D0. The BL is recorded in callSites and pointed at the
+// callee once the code arena is laid out.
+void emitCall(AArch64_Assembler &assembler, Stack &stack, uint32_t const callee, uint64_t const callSaveMask, const ModuleInfo &moduleInfo,
+              const ModuleInfo::FunctionInfo &functionInfo, std::vector<ModuleInfo::CallSite> &callSites) {
+  if (callee >= moduleInfo.functionInfos.size()) {
+    throw std::runtime_error("error: calls to imported functions are not supported currently.");
+  }
+  uint32_t const typeIndex = moduleInfo.functionInfos[callee].typeIndex;
+  const std::string &signature = moduleInfo.signatureTypes[typeIndex];
+  uint32_t const numParams = moduleInfo.getNumParamsForSignature(typeIndex);
+  WasmType const resultType = moduleInfo.getReturnTypeForSignature(typeIndex);
+  if (stack.size() < numParams) {
+    throw std::runtime_error("error: operand stack underflow at a call.");
+  }
+  size_t const base = stack.size() - numParams;
+  // argument register of every param, counted per register class
+  std::vector<TReg> argumentRegisters(numParams);
+  uint32_t numGPRArguments = 0U;
+  uint32_t numFPRArguments = 0U;
+  for (uint32_t k = 0U; k < numParams; ++k) {
+    auto const paramType = static_cast<SignatureType>(signature[1U + k]);
+    bool const isFloat = (paramType == SignatureType::F32) || (paramType == SignatureType::F64) || (paramType == SignatureType::V128);
+    argumentRegisters[k] = isFloat ? floatRegister(numFPRArguments++) : static_cast<TReg>(numGPRArguments++);
+  }
+  if ((numGPRArguments > 16U) || (numFPRArguments > 16U)) {
+    throw std::runtime_error("error: too many params for a call.");
+  }
+
+  // the argument registers are written in ascending order, so an argument is copied into its slot register first unless it
+  // only reads registers no earlier argument overwrites
+  for (uint32_t k = 0U; k < numParams; ++k) {
+    StackElement &argument = stack.peek(numParams - 1U - k);
+    auto const keeps = [&argumentRegisters, k](TReg const reg) {
+      return std::find(argumentRegisters.begin(), argumentRegisters.begin() + k, reg) == argumentRegisters.begin() + k;
+    };
+    uint32_t const type = static_cast<uint32_t>(argument.type);
+    bool direct = isConstant(argument);
+    if (type == StackType::DEFERREDACTION) {
+      direct = keeps(argument.data.deferred.lhs) && keeps(argument.data.deferred.rhs);
+    } else if (isInRegister(argument)) {
+      direct = keeps(argument.variableData.location.reg);
+    }
+    if (!direct) {
+      WasmType const wasmType = elementType(argument);
+      TReg const slotReg = slotRegister(functionInfo, base + k, wasmType);
+      moveToRegister(assembler, argument, slotReg);
+      argument = scratchRegisterElement(slotReg, wasmType);
+    }
+  }
+
+  SavedRegisters const saved = saveCallerRegisters(assembler, stack, base, callSaveMask, functionInfo);
+
+  for (uint32_t k = 0U; k < numParams; ++k) {
+    moveToRegister(assembler, stack.peek(numParams - 1U - k), argumentRegisters[k]);
+  }
+  callSites.push_back({static_cast<uint32_t>(assembler.instructions().size()), callee});
+  assembler.BL(0);
+  stack.pop(numParams);
+
+  // the result goes to its slot register before X0 or D0 may be restored
+  if (resultType != WasmType::TVOID) {
+    TReg const resultReg = slotRegister(functionInfo, base, resultType);
+    moveToRegister(assembler, scratchRegisterElement(resultRegister(resultType), resultType), resultReg);
+    restoreCallerRegisters(assembler, saved);
+    stack.push(scratchRegisterElement(resultReg, resultType));
+  } else {
+    restoreCallerRegisters(assembler, saved);
+  }
+}
+
+// Load or store of the given width and extension for a wasm load/store opcode, loads into a W register zero extend into the X register.
+// f32 and f64 go through an S or D register.
+MemOp memoryOperation(OPCode const opcode) {
+  switch (opcode) {
+  case OPCode::I32_LOAD:
+  case OPCode::I64_LOAD32_U: {
+    return MemOp::LDRW;
+  }
+  case OPCode::I64_LOAD: {
+    return MemOp::LDRX;
+  }
+  case OPCode::F32_LOAD: {
+    return MemOp::LDRS;
+  }
+  case OPCode::F64_LOAD: {
+    return MemOp::LDRD;
+  }
+  case OPCode::I32_LOAD8_S: {
+    return MemOp::LDRSBW;
+  }
+  case OPCode::I32_LOAD8_U:
+  case OPCode::I64_LOAD8_U: {
+    return MemOp::LDRB;
+  }
+  case OPCode::I32_LOAD16_S: {
+    return MemOp::LDRSHW;
+  }
+  case OPCode::I32_LOAD16_U:
+  case OPCode::I64_LOAD16_U: {
+    return MemOp::LDRH;
+  }
+  case OPCode::I64_LOAD8_S: {
+    return MemOp::LDRSBX;
+  }
+  case OPCode::I64_LOAD16_S: {
+    return MemOp::LDRSHX;
+  }
+  case OPCode::I64_LOAD32_S: {
+    return MemOp::LDRSWX;
+  }
+  case OPCode::I32_STORE:
+  case OPCode::I64_STORE32: {
+    return MemOp::STRW;
+  }
+  case OPCode::I64_STORE: {
+    return MemOp::STRX;
+  }
+  case OPCode::F32_STORE: {
+    return MemOp::STRS;
+  }
+  case OPCode::F64_STORE: {
+    return MemOp::STRD;
+  }
+  case OPCode::I32_STORE8:
+  case OPCode::I64_STORE8: {
+    return MemOp::STRB;
+  }
+  case OPCode::I32_STORE16:
+  case OPCode::I64_STORE16: {
+    return MemOp::STRH;
+  }
+  default: {
+    throw std::runtime_error("error: not a load or store.");
+  }
+  }
+}
+
+// Emit op on the linear memory at address + offset. The memory reservation covers every uint32 address plus uint32 offset, so
+// there is no bounds check: the address is zero extended and added to the memory base in R28, out of bounds accesses fault.
+// A constant address is folded with the offset, else the offset goes into the immediate of the access after an ADD to R26.
+// The address is emitted into scratch if it is no register yet.
+void emitMemoryAccess(AArch64_Assembler &assembler, MemOp const op, TReg const rt, const StackElement &address, uint32_t const offset,
+                      TReg const scratch) {
+  uint64_t const size = AArch64_Assembler::accessSize(op);
+  auto const fitsImmediate = [size](uint64_t const value) {
+    return ((value % size) == 0U) && ((value / size) < 4096U);
+  };
+  if (static_cast<uint32_t>(address.type) == StackType::CONSTANT_I32) {
+    uint64_t const effectiveAddress = static_cast<uint64_t>(address.data.constUnion.u32) + offset; // 33 bits, never wraps
+    if (fitsImmediate(effectiveAddress)) {
+      assembler.LoadStoreImmediate(op, rt, memoryBaseRegister, static_cast<uint32_t>(effectiveAddress));
+    } else {
+      assembler.MOVimm(true, TReg::R26, effectiveAddress);
+      assembler.LoadStoreRegister(op, rt, memoryBaseRegister, TReg::R26, false);
+    }
+    return;
+  }
+  TReg const index = valueRegister(assembler, address, scratch);
+  if (offset == 0U) {
+    assembler.LoadStoreRegister(op, rt, memoryBaseRegister, index, true);
+    return;
+  }
+  assembler.AddExtendedRegister(TReg::R26, memoryBaseRegister, index, 0U);
+  if (fitsImmediate(offset)) {
+    assembler.LoadStoreImmediate(op, rt, TReg::R26, offset);
+  } else if (offset <= 255U) {
+    assembler.LoadStoreUnscaled(op, rt, TReg::R26, static_cast<int32_t>(offset));
+  } else {
+    assembler.MOVimm(true, TReg::R27, offset);
+    assembler.LoadStoreRegister(op, rt, TReg::R26, TReg::R27, false);
+  }
+}
+
+// memory.grow calls the grow function of the memory header like a direct call: the delta goes to W1 and the memory base to
+// X0, the previous size or -1 comes back in W0
+void emitMemoryGrow(AArch64_Assembler &assembler, Stack &stack, uint64_t const callSaveMask, const ModuleInfo::FunctionInfo &functionInfo) {
+  size_t const slot = stack.size() - 1U;
+  SavedRegisters const saved = saveCallerRegisters(assembler, stack, slot, callSaveMask, functionInfo);
+  moveToRegister(assembler, stack.top(), TReg::R1);
+  stack.pop();
+  assembler.MOVRegister(true, TReg::R0, memoryBaseRegister);
+  assembler.LoadStoreUnscaled(MemOp::LDRX, TReg::R16, memoryBaseRegister, LinearMemory::growFunctionOffset);
+  assembler.BLR(TReg::R16);
+  TReg const resultReg = operandRegister(functionInfo, slot);
+  if (resultReg != TReg::R0) {
+    assembler.MOVRegister(false, resultReg, TReg::R0);
+  }
+  restoreCallerRegisters(assembler, saved);
+  stack.push(scratchRegisterElement(resultReg, WasmType::I32));
+}
+
+// Lanes of the integer SIMD operators 0x60 to 0xDF, the same operation of the next wider lanes follows 0x20 later
+Lanes integerVectorLanes(OPCode const opcode) {
+  return static_cast<Lanes>(((static_cast<uint32_t>(opcode) & 0xFFU) - 0x60U) >> 5U);
+}
+
+// Half as wide lanes, the operands of the extending operators
+Lanes narrowerLanes(Lanes const lanes) {
+  return static_cast<Lanes>(static_cast<uint32_t>(lanes) - 1U);
+}
+
+// f64x2 rather than f32x4
+bool isDoubleVectorOperation(OPCode const opcode) {
+  return ((opcode >= OPCode::F64X2_EQ) && (opcode <= OPCode::F64X2_GE)) || (opcode >= OPCode::F64X2_ABS) || (opcode == OPCode::F64X2_CEIL) ||
+         (opcode == OPCode::F64X2_FLOOR) || (opcode == OPCode::F64X2_TRUNC) || (opcode == OPCode::F64X2_NEAREST);
+}
+
+// Lane size and scalar type of splat, extract_lane and replace_lane
+struct LaneAccess {
+  Lanes lanes;
+  WasmType scalarType;
+};
+
+LaneAccess laneAccess(OPCode const opcode) {
+  switch (opcode) {
+  case OPCode::I8X16_SPLAT:
+  case OPCode::I8X16_EXTRACT_LANE_S:
+  case OPCode::I8X16_EXTRACT_LANE_U:
+  case OPCode::I8X16_REPLACE_LANE: {
+    return {Lanes::B16, WasmType::I32};
+  }
+  case OPCode::I16X8_SPLAT:
+  case OPCode::I16X8_EXTRACT_LANE_S:
+  case OPCode::I16X8_EXTRACT_LANE_U:
+  case OPCode::I16X8_REPLACE_LANE: {
+    return {Lanes::H8, WasmType::I32};
+  }
+  case OPCode::I32X4_SPLAT:
+  case OPCode::I32X4_EXTRACT_LANE:
+  case OPCode::I32X4_REPLACE_LANE: {
+    return {Lanes::S4, WasmType::I32};
+  }
+  case OPCode::I64X2_SPLAT:
+  case OPCode::I64X2_EXTRACT_LANE:
+  case OPCode::I64X2_REPLACE_LANE: {
+    return {Lanes::D2, WasmType::I64};
+  }
+  case OPCode::F32X4_SPLAT:
+  case OPCode::F32X4_EXTRACT_LANE:
+  case OPCode::F32X4_REPLACE_LANE: {
+    return {Lanes::S4, WasmType::F32};
+  }
+  case OPCode::F64X2_SPLAT:
+  case OPCode::F64X2_EXTRACT_LANE:
+  case OPCode::F64X2_REPLACE_LANE: {
+    return {Lanes::D2, WasmType::F64};
+  }
+  default: {
+    throw std::runtime_error("error: not a lane access.");
+  }
+  }
+}
+
+// dst = the 128 bit constant hi:lo, through X26
+void emitVectorConstant(AArch64_Assembler &assembler, TReg const dst, uint64_t const lo, uint64_t const hi) {
+  if ((lo == 0U) && (hi == 0U)) {
+    assembler.MOVIZero(dst);
+    return;
+  }
+  assembler.MOVimm(true, TReg::R26, lo);
+  if (lo == hi) {
+    assembler.DUPGeneral(Lanes::D2, dst, TReg::R26);
+    return;
+  }
+  assembler.FMOVFromGeneral(true, dst, TReg::R26); // clears the upper half
+  if (hi != 0U) {
+    assembler.MOVimm(true, TReg::R26, hi);
+    assembler.INSGeneral(Lanes::D2, dst, 1U, TReg::R26);
+  }
+}
+
+// Lane-wise integer comparison in the order EQ, NE, LT_S, LT_U, GT_S, GT_U, LE_S, LE_U, GE_S, GE_U of the scalar ones. LT and LE
+// are GT and GE with swapped operands, NE is the inverted EQ.
+void emitVectorComparison(AArch64_Assembler &assembler, uint32_t const index, Lanes const lanes, TReg const dst, TReg const lhs, TReg const rhs) {
+  constexpr VectorOp operations[] = {VectorOp::CMEQ, VectorOp::CMEQ, VectorOp::CMGT, VectorOp::CMHI, VectorOp::CMGT,
+                                     VectorOp::CMHI, VectorOp::CMGE, VectorOp::CMHS, VectorOp::CMGE, VectorOp::CMHS};
+  bool const swapped = (index == 2U) || (index == 3U) || (index == 6U) || (index == 7U);
+  assembler.Vector(operations[index], lanes, dst, swapped ? rhs : lhs, swapped ? lhs : rhs);
+  if (index == 1U) {
+    assembler.Vector(VectorOp::NOT, Lanes::B16, dst, dst);
+  }
+}
+
+// dst = lhs <opcode> rhs (rhs NONE for one operand) for the SIMD operators on v128 values that produce a v128. Every lowering
+// reads lhs and rhs before it writes dst, so dst may be one of them. V30 and V31 are scratch.
+void emitVectorOperation(AArch64_Assembler &assembler, OPCode const opcode, TReg const dst, TReg const lhs, TReg const rhs) {
+  bool const isDouble = isDoubleVectorOperation(opcode);
+  switch (opcode) {
+  case OPCode::I8X16_SWIZZLE: {
+    assembler.Vector(VectorOp::TBL, Lanes::B16, dst, lhs, rhs); // indices from 16 up select 0 like wasm wants it
+    break;
+  }
+  case OPCode::I8X16_EQ:
+  case OPCode::I8X16_NE:
+  case OPCode::I8X16_LT_S:
+  case OPCode::I8X16_LT_U:
+  case OPCode::I8X16_GT_S:
+  case OPCode::I8X16_GT_U:
+  case OPCode::I8X16_LE_S:
+  case OPCode::I8X16_LE_U:
+  case OPCode::I8X16_GE_S:
+  case OPCode::I8X16_GE_U:
+  case OPCode::I16X8_EQ:
+  case OPCode::I16X8_NE:
+  case OPCode::I16X8_LT_S:
+  case OPCode::I16X8_LT_U:
+  case OPCode::I16X8_GT_S:
+  case OPCode::I16X8_GT_U:
+  case OPCode::I16X8_LE_S:
+  case OPCode::I16X8_LE_U:
+  case OPCode::I16X8_GE_S:
+  case OPCode::I16X8_GE_U:
+  case OPCode::I32X4_EQ:
+  case OPCode::I32X4_NE:
+  case OPCode::I32X4_LT_S:
+  case OPCode::I32X4_LT_U:
+  case OPCode::I32X4_GT_S:
+  case OPCode::I32X4_GT_U:
+  case OPCode::I32X4_LE_S:
+  case OPCode::I32X4_LE_U:
+  case OPCode::I32X4_GE_S:
+  case OPCode::I32X4_GE_U: {
+    uint32_t const position = static_cast<uint32_t>(opcode) - static_cast<uint32_t>(OPCode::I8X16_EQ);
+    emitVectorComparison(assembler, position % 10U, static_cast<Lanes>(position / 10U), dst, lhs, rhs);
+    break;
+  }
+  case OPCode::I64X2_EQ:
+  case OPCode::I64X2_NE:
+  case OPCode::I64X2_LT_S:
+  case OPCode::I64X2_GT_S:
+  case OPCode::I64X2_LE_S:
+  case OPCode::I64X2_GE_S: {
+    // only the signed ones, at every second position of the order above
+    uint32_t const position = static_cast<uint32_t>(opcode) - static_cast<uint32_t>(OPCode::I64X2_EQ);
+    emitVectorComparison(assembler, (position < 2U) ? position : (position * 2U - 2U), Lanes::D2, dst, lhs, rhs);
+    break;
+  }
+  case OPCode::F32X4_EQ:
+  case OPCode::F32X4_NE:
+  case OPCode::F32X4_LT:
+  case OPCode::F32X4_GT:
+  case OPCode::F32X4_LE:
+  case OPCode::F32X4_GE:
+  case OPCode::F64X2_EQ:
+  case OPCode::F64X2_NE:
+  case OPCode::F64X2_LT:
+  case OPCode::F64X2_GT:
+  case OPCode::F64X2_LE:
+  case OPCode::F64X2_GE: {
+    // EQ, NE, LT, GT, LE, GE. A NaN lane fails FCMEQ, FCMGT and FCMGE, so it is only true for NE.
+    constexpr VectorOp operations[] = {VectorOp::FCMEQ, VectorOp::FCMEQ, VectorOp::FCMGT, VectorOp::FCMGT, VectorOp::FCMGE, VectorOp::FCMGE};
+    OPCode const first = isDouble ? OPCode::F64X2_EQ : OPCode::F32X4_EQ;
+    uint32_t const index = static_cast<uint32_t>(opcode) - static_cast<uint32_t>(first);
+    bool const swapped = (index == 2U) || (index == 4U);
+    assembler.VectorFloat(operations[index], isDouble, dst, swapped ? rhs : lhs, swapped ? lhs : rhs);
+    if (index == 1U) {
+      assembler.Vector(VectorOp::NOT, Lanes::B16, dst, dst);
+    }
+    break;
+  }
+  case OPCode::V128_NOT: {
+    assembler.Vector(VectorOp::NOT, Lanes::B16, dst, lhs);
+    break;
+  }
+  case OPCode::V128_AND: {
+    assembler.Vector(VectorOp::AND, Lanes::B16, dst, lhs, rhs);
+    break;
+  }
+  case OPCode::V128_ANDNOT: {
+    assembler.Vector(VectorOp::BIC, Lanes::B16, dst, lhs, rhs);
+    break;
+  }
+  case OPCode::V128_OR: {
+    assembler.Vector(VectorOp::ORR, Lanes::B16, dst, lhs, rhs);
+    break;
+  }
+  case OPCode::V128_XOR: {
+    assembler.Vector(VectorOp::EOR, Lanes::B16, dst, lhs, rhs);
+    break;
+  }
+  case OPCode::F32X4_DEMOTE_F64X2_ZERO: {
+    assembler.VectorFloat(VectorOp::FCVTN, true, dst, lhs); // the upper half is cleared
+    break;
+  }
+  case OPCode::F64X2_PROMOTE_LOW_F32X4: {
+    assembler.VectorFloat(VectorOp::FCVTL, true, dst, lhs);
+    break;
+  }
+  case OPCode::I8X16_ABS:
+  case OPCode::I16X8_ABS:
+  case OPCode::I32X4_ABS:
+  case OPCode::I64X2_ABS: {
+    assembler.Vector(VectorOp::ABS, integerVectorLanes(opcode), dst, lhs);
+    break;
+  }
+  case OPCode::I8X16_NEG:
+  case OPCode::I16X8_NEG:
+  case OPCode::I32X4_NEG:
+  case OPCode::I64X2_NEG: {
+    assembler.Vector(VectorOp::NEG, integerVectorLanes(opcode), dst, lhs);
+    break;
+  }
+  case OPCode::I8X16_POPCNT: {
+    assembler.Vector(VectorOp::CNT, Lanes::B16, dst, lhs);
+    break;
+  }
+  case OPCode::I8X16_NARROW_I16X8_S:
+  case OPCode::I16X8_NARROW_I32X4_S: {
+    Lanes const lanes = integerVectorLanes(opcode);
+    assembler.Vector(VectorOp::SQXTN, lanes, dst, lhs);
+    assembler.Vector(VectorOp::SQXTN2, lanes, dst, rhs);
+    break;
+  }
+  case OPCode::I8X16_NARROW_I16X8_U:
+  case OPCode::I16X8_NARROW_I32X4_U: {
+    // unsigned saturation of the signed operands
+    Lanes const lanes = integerVectorLanes(opcode);
+    assembler.Vector(VectorOp::SQXTUN, lanes, dst, lhs);
+    assembler.Vector(VectorOp::SQXTUN2, lanes, dst, rhs);
+    break;
+  }
+  case OPCode::F32X4_CEIL:
+  case OPCode::F64X2_CEIL: {
+    assembler.VectorFloat(VectorOp::FRINTP, isDouble, dst, lhs);
+    break;
+  }
+  case OPCode::F32X4_FLOOR:
+  case OPCode::F64X2_FLOOR: {
+    assembler.VectorFloat(VectorOp::FRINTM, isDouble, dst, lhs);
+    break;
+  }
+  case OPCode::F32X4_TRUNC:
+  case OPCode::F64X2_TRUNC: {
+    assembler.VectorFloat(VectorOp::FRINTZ, isDouble, dst, lhs);
+    break;
+  }
+  case OPCode::F32X4_NEAREST:
+  case OPCode::F64X2_NEAREST: {
+    assembler.VectorFloat(VectorOp::FRINTN, isDouble, dst, lhs);
+    break;
+  }
+  case OPCode::I8X16_ADD:
+  case OPCode::I16X8_ADD:
+  case OPCode::I32X4_ADD:
+  case OPCode::I64X2_ADD: {
+    assembler.Vector(VectorOp::ADD, integerVectorLanes(opcode), dst, lhs, rhs);
+    break;
+  }
+  case OPCode::I8X16_ADD_SAT_S:
+  case OPCode::I16X8_ADD_SAT_S: {
+    assembler.Vector(VectorOp::SQADD, integerVectorLanes(opcode), dst, lhs, rhs);
+    break;
+  }
+  case OPCode::I8X16_ADD_SAT_U:
+  case OPCode::I16X8_ADD_SAT_U: {
+    assembler.Vector(VectorOp::UQADD, integerVectorLanes(opcode), dst, lhs, rhs);
+    break;
+  }
+  case OPCode::I8X16_SUB:
+  case OPCode::I16X8_SUB:
+  case OPCode::I32X4_SUB:
+  case OPCode::I64X2_SUB: {
+    assembler.Vector(VectorOp::SUB, integerVectorLanes(opcode), dst, lhs, rhs);
+    break;
+  }
+  case OPCode::I8X16_SUB_SAT_S:
+  case OPCode::I16X8_SUB_SAT_S: {
+    assembler.Vector(VectorOp::SQSUB, integerVectorLanes(opcode), dst, lhs, rhs);
+    break;
+  }
+  case OPCode::I8X16_SUB_SAT_U:
+  case OPCode::I16X8_SUB_SAT_U: {
+    assembler.Vector(VectorOp::UQSUB, integerVectorLanes(opcode), dst, lhs, rhs);
+    break;
+  }
+  case OPCode::I8X16_MIN_S:
+  case OPCode::I16X8_MIN_S:
+  case OPCode::I32X4_MIN_S: {
+    assembler.Vector(VectorOp::SMIN, integerVectorLanes(opcode), dst, lhs, rhs);
+    break;
+  }
+  case OPCode::I8X16_MIN_U:
+  case OPCode::I16X8_MIN_U:
+  case OPCode::I32X4_MIN_U: {
+    assembler.Vector(VectorOp::UMIN, integerVectorLanes(opcode), dst, lhs, rhs);
+    break;
+  }
+  case OPCode::I8X16_MAX_S:
+  case OPCode::I16X8_MAX_S:
+  case OPCode::I32X4_MAX_S: {
+    assembler.Vector(VectorOp::SMAX, integerVectorLanes(opcode), dst, lhs, rhs);
+    break;
+  }
+  case OPCode::I8X16_MAX_U:
+  case OPCode::I16X8_MAX_U:
+  case OPCode::I32X4_MAX_U: {
+    assembler.Vector(VectorOp::UMAX, integerVectorLanes(opcode), dst, lhs, rhs);
+    break;
+  }
+  case OPCode::I8X16_AVGR_U:
+  case OPCode::I16X8_AVGR_U: {
+    assembler.Vector(VectorOp::URHADD, integerVectorLanes(opcode), dst, lhs, rhs);
+    break;
+  }
+  case OPCode::I16X8_EXTADD_PAIRWISE_I8X16_S: {
+    assembler.Vector(VectorOp::SADDLP, Lanes::B16, dst, lhs);
+    break;
+  }
+  case OPCode::I16X8_EXTADD_PAIRWISE_I8X16_U: {
+    assembler.Vector(VectorOp::UADDLP, Lanes::B16, dst, lhs);
+    break;
+  }
+  case OPCode::I32X4_EXTADD_PAIRWISE_I16X8_S: {
+    assembler.Vector(VectorOp::SADDLP, Lanes::H8, dst, lhs);
+    break;
+  }
+  case OPCode::I32X4_EXTADD_PAIRWISE_I16X8_U: {
+    assembler.Vector(VectorOp::UADDLP, Lanes::H8, dst, lhs);
+    break;
+  }
+  case OPCode::I16X8_Q15MULR_SAT_S: {
+    assembler.Vector(VectorOp::SQRDMULH, Lanes::H8, dst, lhs, rhs);
+    break;
+  }
+  case OPCode::I16X8_EXTEND_LOW_I8X16_S:
+  case OPCode::I16X8_EXTEND_HIGH_I8X16_S:
+  case OPCode::I32X4_EXTEND_LOW_I16X8_S:
+  case OPCode::I32X4_EXTEND_HIGH_I16X8_S:
+  case OPCode::I64X2_EXTEND_LOW_I32X4_S:
+  case OPCode::I64X2_EXTEND_HIGH_I32X4_S: {
+    bool const upperHalf = (opcode == OPCode::I16X8_EXTEND_HIGH_I8X16_S) || (opcode == OPCode::I32X4_EXTEND_HIGH_I16X8_S) ||
+                           (opcode == OPCode::I64X2_EXTEND_HIGH_I32X4_S);
+    assembler.SSHLL(narrowerLanes(integerVectorLanes(opcode)), upperHalf, dst, lhs);
+    break;
+  }
+  case OPCode::I16X8_EXTEND_LOW_I8X16_U:
+  case OPCode::I16X8_EXTEND_HIGH_I8X16_U:
+  case OPCode::I32X4_EXTEND_LOW_I16X8_U:
+  case OPCode::I32X4_EXTEND_HIGH_I16X8_U:
+  case OPCode::I64X2_EXTEND_LOW_I32X4_U:
+  case OPCode::I64X2_EXTEND_HIGH_I32X4_U: {
+    bool const upperHalf = (opcode == OPCode::I16X8_EXTEND_HIGH_I8X16_U) || (opcode == OPCode::I32X4_EXTEND_HIGH_I16X8_U) ||
+                           (opcode == OPCode::I64X2_EXTEND_HIGH_I32X4_U);
+    assembler.USHLL(narrowerLanes(integerVectorLanes(opcode)), upperHalf, dst, lhs);
+    break;
+  }
+  case OPCode::I16X8_MUL:
+  case OPCode::I32X4_MUL: {
+    assembler.Vector(VectorOp::MUL, integerVectorLanes(opcode), dst, lhs, rhs);
+    break;
+  }
+  case OPCode::I64X2_MUL: {
+    // NEON has no 64 bit lane multiply, both lanes go through X26 and X27 into V30
+    for (uint32_t lane = 0U; lane < 2U; ++lane) {
+      assembler.UMOV(Lanes::D2, TReg::R26, lhs, lane);
+      assembler.UMOV(Lanes::D2, TReg::R27, rhs, lane);
+      assembler.Multiply(true, TReg::R26, TReg::R26, TReg::R27);
+      assembler.INSGeneral(Lanes::D2, TReg::F30, lane, TReg::R26);
+    }
+    assembler.MOVVector(dst, TReg::F30);
+    break;
+  }
+  case OPCode::I32X4_DOT_I16X8_S: {
+    // the products of the lower and the upper four lanes, then the sums of neighbouring products
+    assembler.Vector(VectorOp::SMULL, Lanes::H8, TReg::F30, lhs, rhs);
+    assembler.Vector(VectorOp::SMULL2, Lanes::H8, TReg::F31, lhs, rhs);
+    assembler.Vector(VectorOp::ADDP, Lanes::S4, dst, TReg::F30, TReg::F31);
+    break;
+  }
+  case OPCode::I16X8_EXTMUL_LOW_I8X16_S:
+  case OPCode::I32X4_EXTMUL_LOW_I16X8_S:
+  case OPCode::I64X2_EXTMUL_LOW_I32X4_S: {
+    assembler.Vector(VectorOp::SMULL, narrowerLanes(integerVectorLanes(opcode)), dst, lhs, rhs);
+    break;
+  }
+  case OPCode::I16X8_EXTMUL_HIGH_I8X16_S:
+  case OPCode::I32X4_EXTMUL_HIGH_I16X8_S:
+  case OPCode::I64X2_EXTMUL_HIGH_I32X4_S: {
+    assembler.Vector(VectorOp::SMULL2, narrowerLanes(integerVectorLanes(opcode)), dst, lhs, rhs);
+    break;
+  }
+  case OPCode::I16X8_EXTMUL_LOW_I8X16_U:
+  case OPCode::I32X4_EXTMUL_LOW_I16X8_U:
+  case OPCode::I64X2_EXTMUL_LOW_I32X4_U: {
+    assembler.Vector(VectorOp::UMULL, narrowerLanes(integerVectorLanes(opcode)), dst, lhs, rhs);
+    break;
+  }
+  case OPCode::I16X8_EXTMUL_HIGH_I8X16_U:
+  case OPCode::I32X4_EXTMUL_HIGH_I16X8_U:
+  case OPCode::I64X2_EXTMUL_HIGH_I32X4_U: {
+    assembler.Vector(VectorOp::UMULL2, narrowerLanes(integerVectorLanes(opcode)), dst, lhs, rhs);
+    break;
+  }
+  case OPCode::F32X4_ABS:
+  case OPCode::F64X2_ABS: {
+    assembler.VectorFloat(VectorOp::FABS, isDouble, dst, lhs);
+    break;
+  }
+  case OPCode::F32X4_NEG:
+  case OPCode::F64X2_NEG: {
+    assembler.VectorFloat(VectorOp::FNEG, isDouble, dst, lhs);
+    break;
+  }
+  case OPCode::F32X4_SQRT:
+  case OPCode::F64X2_SQRT: {
+    assembler.VectorFloat(VectorOp::FSQRT, isDouble, dst, lhs);
+    break;
+  }
+  case OPCode::F32X4_ADD:
+  case OPCode::F64X2_ADD: {
+    assembler.VectorFloat(VectorOp::FADD, isDouble, dst, lhs, rhs);
+    break;
+  }
+  case OPCode::F32X4_SUB:
+  case OPCode::F64X2_SUB: {
+    assembler.VectorFloat(VectorOp::FSUB, isDouble, dst, lhs, rhs);
+    break;
+  }
+  case OPCode::F32X4_MUL:
+  case OPCode::F64X2_MUL: {
+    assembler.VectorFloat(VectorOp::FMUL, isDouble, dst, lhs, rhs);
+    break;
+  }
+  case OPCode::F32X4_DIV:
+  case OPCode::F64X2_DIV: {
+    assembler.VectorFloat(VectorOp::FDIV, isDouble, dst, lhs, rhs);
+    break;
+  }
+  case OPCode::F32X4_MIN:
+  case OPCode::F64X2_MIN: {
+    assembler.VectorFloat(VectorOp::FMIN, isDouble, dst, lhs, rhs);
+    break;
+  }
+  case OPCode::F32X4_MAX:
+  case OPCode::F64X2_MAX: {
+    assembler.VectorFloat(VectorOp::FMAX, isDouble, dst, lhs, rhs);
+    break;
+  }
+  case OPCode::F32X4_PMIN:
+  case OPCode::F64X2_PMIN: {
+    // rhs < lhs ? rhs : lhs, a NaN lhs is kept
+    assembler.VectorFloat(VectorOp::FCMGT, isDouble, TReg::F31, lhs, rhs);
+    assembler.Vector(VectorOp::BSL, Lanes::B16, TReg::F31, rhs, lhs);
+    assembler.MOVVector(dst, TReg::F31);
+    break;
+  }
+  case OPCode::F32X4_PMAX:
+  case OPCode::F64X2_PMAX: {
+    // lhs < rhs ? rhs : lhs
+    assembler.VectorFloat(VectorOp::FCMGT, isDouble, TReg::F31, rhs, lhs);
+    assembler.Vector(VectorOp::BSL, Lanes::B16, TReg::F31, rhs, lhs);
+    assembler.MOVVector(dst, TReg::F31);
+    break;
+  }
+  case OPCode::I32X4_TRUNC_SAT_F32X4_S: {
+    assembler.VectorFloat(VectorOp::FCVTZS, false, dst, lhs); // saturates and converts NaN to 0 like wasm
+    break;
+  }
+  case OPCode::I32X4_TRUNC_SAT_F32X4_U: {
+    assembler.VectorFloat(VectorOp::FCVTZU, false, dst, lhs);
+    break;
+  }
+  case OPCode::F32X4_CONVERT_I32X4_S: {
+    assembler.VectorFloat(VectorOp::SCVTF, false, dst, lhs);
+    break;
+  }
+  case OPCode::F32X4_CONVERT_I32X4_U: {
+    assembler.VectorFloat(VectorOp::UCVTF, false, dst, lhs);
+    break;
+  }
+  case OPCode::I32X4_TRUNC_SAT_F64X2_S_ZERO: {
+    assembler.VectorFloat(VectorOp::FCVTZS, true, dst, lhs);
+    assembler.Vector(VectorOp::SQXTN, Lanes::S4, dst, dst); // clears the upper half
+    break;
+  }
+  case OPCode::I32X4_TRUNC_SAT_F64X2_U_ZERO: {
+    assembler.VectorFloat(VectorOp::FCVTZU, true, dst, lhs);
+    assembler.Vector(VectorOp::UQXTN, Lanes::S4, dst, dst);
+    break;
+  }
+  case OPCode::F64X2_CONVERT_LOW_I32X4_S: {
+    assembler.SSHLL(Lanes::S4, false, dst, lhs);
+    assembler.VectorFloat(VectorOp::SCVTF, true, dst, dst);
+    break;
+  }
+  case OPCode::F64X2_CONVERT_LOW_I32X4_U: {
+    assembler.USHLL(Lanes::S4, false, dst, lhs);
+    assembler.VectorFloat(VectorOp::UCVTF, true, dst, dst);
+    break;
+  }
+  default: {
+    throw std::runtime_error("error: unsupported SIMD operator.");
+  }
+  }
+}
+
+// i8x16 to i64x2 shl, shr_s and shr_u. The count is taken modulo the lane width like wasm wants it: a constant one is an
+// immediate shift (none for 0), otherwise the count is masked in W26 and broadcast into V31 for SSHL/USHL, which shift right
+// for negative counts.
+void emitVectorShift(AArch64_Assembler &assembler, OPCode const opcode, TReg const dst, TReg const lhs, const StackElement &count,
+                     TReg const countScratch) {
+  Lanes const lanes = integerVectorLanes(opcode);
+  uint32_t const mask = (8U << static_cast<uint32_t>(lanes)) - 1U;
+  uint32_t const kind = (static_cast<uint32_t>(opcode) & 0x1FU) - 0x0BU; // shl, shr_s, shr_u
+  if (isConstant(count)) {
+    uint32_t const shift = static_cast<uint32_t>(constantValue(count)) & mask;
+    if (shift == 0U) {
+      if (dst != lhs) {
+        assembler.MOVVector(dst, lhs);
+      }
+    } else if (kind == 0U) {
+      assembler.SHLVector(lanes, dst, lhs, shift);
+    } else if (kind == 1U) {
+      assembler.SSHRVector(lanes, dst, lhs, shift);
+    } else {
+      assembler.USHRVector(lanes, dst, lhs, shift);
+    }
+    return;
+  }
+  TReg const countReg = valueRegister(assembler, count, countScratch);
+  assembler.ANDImmediate(false, TReg::R26, countReg, mask);
+  if (kind != 0U) {
+    assembler.SubShiftedRegister(false, TReg::R26, TReg::ZR, TReg::R26);
+  }
+  assembler.DUPGeneral(lanes, TReg::F31, TReg::R26);
+  assembler.Vector((kind == 2U) ? VectorOp::USHL : VectorOp::SSHL, lanes, dst, lhs, TReg::F31);
+}
+
+// any_true, all_true and bitmask into the W register dst. any_true and all_true leave a value that is not 0 for true in dst and
+// return the comparison with 0 that makes it a boolean (NOP for bitmask). V30 and V31 are scratch.
+OPCode emitVectorReduction(AArch64_Assembler &assembler, OPCode const opcode, TReg const dst, TReg const src) {
+  OPCode comparison = OPCode::I32_NE;
+  switch (opcode) {
+  case OPCode::V128_ANY_TRUE: {
+    assembler.Vector(VectorOp::UMAXV, Lanes::B16, TReg::F31, src);
+    break;
+  }
+  case OPCode::I8X16_ALL_TRUE:
+  case OPCode::I16X8_ALL_TRUE:
+  case OPCode::I32X4_ALL_TRUE: {
+    assembler.Vector(VectorOp::UMINV, integerVectorLanes(opcode), TReg::F31, src);
+    break;
+  }
+  case OPCode::I64X2_ALL_TRUE: {
+    // no UMINV of 64 bit lanes: a zero lane becomes all ones and their maximum is 0 if there is none
+    assembler.Vector(VectorOp::CMEQZERO, Lanes::D2, TReg::F31, src);
+    assembler.Vector(VectorOp::UMAXV, Lanes::B16, TReg::F31, TReg::F31);
+    comparison = OPCode::I32_EQ;
+    break;
+  }
+  case OPCode::I8X16_BITMASK: {
+    // the sign of each lane selects its bit of 0x80..0x01, then the upper half is interleaved with the lower one so the
+    // eight 16 bit sums of the bit of lane n and lane n + 8 add up to the mask
+    assembler.Vector(VectorOp::CMLTZERO, Lanes::B16, TReg::F31, src);
+    emitVectorConstant(assembler, TReg::F30, 0x8040201008040201U, 0x8040201008040201U);
+    assembler.Vector(VectorOp::AND, Lanes::B16, TReg::F31, TReg::F31, TReg::F30);
+    assembler.EXT(TReg::F30, TReg::F31, TReg::F31, 8U);
+    assembler.Vector(VectorOp::ZIP1, Lanes::B16, TReg::F31, TReg::F31, TReg::F30);
+    assembler.Vector(VectorOp::ADDV, Lanes::H8, TReg::F31, TReg::F31);
+    comparison = OPCode::NOP;
+    break;
+  }
+  case OPCode::I16X8_BITMASK:
+  case OPCode::I32X4_BITMASK:
+  case OPCode::I64X2_BITMASK: {
+    // the sign of each lane selects its bit, the sum of the lanes is the mask
+    Lanes const lanes = integerVectorLanes(opcode);
+    assembler.Vector(VectorOp::CMLTZERO, lanes, TReg::F31, src);
+    if (lanes == Lanes::H8) {
+      emitVectorConstant(assembler, TReg::F30, 0x0008000400020001U, 0x0080004000200010U);
+    } else if (lanes == Lanes::S4) {
+      emitVectorConstant(assembler, TReg::F30, 0x0000000200000001U, 0x0000000800000004U);
+    } else {
+      emitVectorConstant(assembler, TReg::F30, 1U, 2U);
+    }
+    assembler.Vector(VectorOp::AND, Lanes::B16, TReg::F31, TReg::F31, TReg::F30);
+    if (lanes == Lanes::D2) {
+      assembler.ADDPScalar(TReg::F31, TReg::F31);
+    } else {
+      assembler.Vector(VectorOp::ADDV, lanes, TReg::F31, TReg::F31);
+    }
+    comparison = OPCode::NOP;
+    break;
+  }
+  default: {
+    throw std::runtime_error("error: not a SIMD reduction.");
+  }
+  }
+  assembler.FMOVToGeneral(false, dst, TReg::F31); // ADDV, UMAXV and UMINV clear the rest of the register
+  return comparison;
+}
 
-      if (returnType == WasmType::I32) {
-        assembler.SubShiftedRegister(false, moduleInfo.functionsLocalVars[funcIndex][left.variableData.location.localIdx].reg,
-                                     moduleInfo.functionsLocalVars[funcIndex][right.variableData.location.localIdx].reg);
-      } else {
-        auto leftLocalVarType = moduleInfo.functionsLocalVars[funcIndex][left.variableData.location.localIdx].wasmType;
-        auto rightLocalVarType = moduleInfo.functionsLocalVars[funcIndex][right.variableData.location.localIdx].wasmType;
-        if (rightLocalVarType == WasmType::I32) {
-          assembler.Sxtw(moduleInfo.functionsLocalVars[funcIndex][right.variableData.location.localIdx].reg,
-                         moduleInfo.functionsLocalVars[funcIndex][right.variableData.location.localIdx].reg);
-        } else {
-          throw std::runtime_error("error: I32_SUB right type is not I32 or I64, parse I32_SUB wasm opCode error.");
-        }
-        if (leftLocalVarType == WasmType::I32) {
-          assembler.Sxtw(moduleInfo.functionsLocalVars[funcIndex][left.variableData.location.localIdx].reg,
-                         moduleInfo.functionsLocalVars[funcIndex][left.variableData.location.localIdx].reg);
-        } else {
-          throw std::runtime_error("error: I32_SUB left type is not I32 or I64, parse I32_SUB wasm opCode error.");
-        }
-        assembler.SubShiftedRegister(true, moduleInfo.functionsLocalVars[funcIndex][left.variableData.location.localIdx].reg,
-                                     moduleInfo.functionsLocalVars[funcIndex][right.variableData.location.localIdx].reg);
+// v128.load and v128.store, the loads that extend, splat, zero fill or replace a single lane, and the lane stores. The address
+// is below the vector of the lane loads and stores. Only a single lane or half of the register goes through a W/X register or
+// a D register, the rest is an LDR/STR of the Q register.
+void vectorMemoryOperator(AArch64_Assembler &assembler, Stack &stack, OPCode const opcode, uint32_t const offset, uint32_t const lane,
+                          const ModuleInfo::FunctionInfo &functionInfo) {
+  constexpr MemOp laneLoads[] = {MemOp::LDRB, MemOp::LDRH, MemOp::LDRW, MemOp::LDRX};
+  constexpr MemOp laneStores[] = {MemOp::STRB, MemOp::STRH, MemOp::STRW, MemOp::STRX};
+  size_t const slot = stack.size() - vectorOperandCount(opcode);
+  StackElement const address = stack.peek(stack.size() - 1U - slot);
+  TReg const addressScratch = operandRegister(functionInfo, slot);
+  TReg const dst = floatOperandRegister(functionInfo, slot);
+  switch (opcode) {
+  case OPCode::V128_LOAD: {
+    emitMemoryAccess(assembler, MemOp::LDRQ, dst, address, offset, addressScratch);
+    break;
+  }
+  case OPCode::V128_LOAD8X8_S:
+  case OPCode::V128_LOAD8X8_U:
+  case OPCode::V128_LOAD16X4_S:
+  case OPCode::V128_LOAD16X4_U:
+  case OPCode::V128_LOAD32X2_S:
+  case OPCode::V128_LOAD32X2_U: {
+    uint32_t const position = static_cast<uint32_t>(opcode) - static_cast<uint32_t>(OPCode::V128_LOAD8X8_S);
+    emitMemoryAccess(assembler, MemOp::LDRD, dst, address, offset, addressScratch);
+    if ((position % 2U) == 0U) {
+      assembler.SSHLL(static_cast<Lanes>(position / 2U), false, dst, dst);
+    } else {
+      assembler.USHLL(static_cast<Lanes>(position / 2U), false, dst, dst);
+    }
+    break;
+  }
+  case OPCode::V128_LOAD8_SPLAT:
+  case OPCode::V128_LOAD16_SPLAT:
+  case OPCode::V128_LOAD32_SPLAT:
+  case OPCode::V128_LOAD64_SPLAT: {
+    uint32_t const position = static_cast<uint32_t>(opcode) - static_cast<uint32_t>(OPCode::V128_LOAD8_SPLAT);
+    emitMemoryAccess(assembler, laneLoads[position], addressScratch, address, offset, addressScratch);
+    assembler.DUPGeneral(static_cast<Lanes>(position), dst, addressScratch);
+    break;
+  }
+  case OPCode::V128_LOAD32_ZERO: {
+    emitMemoryAccess(assembler, MemOp::LDRS, dst, address, offset, addressScratch); // clears the rest of the register
+    break;
+  }
+  case OPCode::V128_LOAD64_ZERO: {
+    emitMemoryAccess(assembler, MemOp::LDRD, dst, address, offset, addressScratch);
+    break;
+  }
+  case OPCode::V128_LOAD8_LANE:
+  case OPCode::V128_LOAD16_LANE:
+  case OPCode::V128_LOAD32_LANE:
+  case OPCode::V128_LOAD64_LANE: {
+    uint32_t const position = static_cast<uint32_t>(opcode) - static_cast<uint32_t>(OPCode::V128_LOAD8_LANE);
+    TReg const vector = valueRegister(assembler, stack.top(), floatOperandRegister(functionInfo, slot + 1U));
+    TReg const value = operandRegister(functionInfo, slot + 1U); // its slot holds a v128, the W/X register is free
+    emitMemoryAccess(assembler, laneLoads[position], value, address, offset, addressScratch);
+    if (vector != dst) {
+      assembler.MOVVector(dst, vector);
+    }
+    assembler.INSGeneral(static_cast<Lanes>(position), dst, lane, value);
+    break;
+  }
+  case OPCode::V128_STORE: {
+    TReg const value = valueRegister(assembler, stack.top(), floatOperandRegister(functionInfo, slot + 1U));
+    emitMemoryAccess(assembler, MemOp::STRQ, value, address, offset, addressScratch);
+    break;
+  }
+  case OPCode::V128_STORE8_LANE:
+  case OPCode::V128_STORE16_LANE:
+  case OPCode::V128_STORE32_LANE:
+  case OPCode::V128_STORE64_LANE: {
+    uint32_t const position = static_cast<uint32_t>(opcode) - static_cast<uint32_t>(OPCode::V128_STORE8_LANE);
+    TReg const vector = valueRegister(assembler, stack.top(), floatOperandRegister(functionInfo, slot + 1U));
+    TReg const value = operandRegister(functionInfo, slot + 1U);
+    assembler.UMOV(static_cast<Lanes>(position), value, vector, lane);
+    emitMemoryAccess(assembler, laneStores[position], value, address, offset, addressScratch);
+    break;
+  }
+  default: {
+    throw std::runtime_error("error: not a SIMD load or store.");
+  }
+  }
+  stack.pop(vectorOperandCount(opcode));
+  if (!isVectorStore(opcode)) {
+    stack.push(scratchRegisterElement(dst, WasmType::VEC_TYPE));
+  }
+}
+
+// Lanes of a lane index immediate, for the range check
+uint32_t numLanesOfAccess(OPCode const opcode) {
+  if ((opcode >= OPCode::V128_LOAD8_LANE) && (opcode <= OPCode::V128_STORE64_LANE)) {
+    return 16U >> ((static_cast<uint32_t>(opcode) - static_cast<uint32_t>(OPCode::V128_LOAD8_LANE)) % 4U);
+  }
+  return 16U >> static_cast<uint32_t>(laneAccess(opcode).lanes);
+}
+
+// SIMD instruction after VECTOR_EXTEND_OP_CODE and its sub opcode, i is at its immediates and advanced past them. The operands are
+// replaced by the result in the register of the slot of the lowest one, a V register for v128 and f32/f64 lanes and a W/X
+// register otherwise. v128 values are always in a register, they are never constants or deferred. The truth value of
+// any_true and all_true that a branch consumes next (branchFollows) is deferred as comparison with 0.
+void vectorOperator(AArch64_Assembler &assembler, Stack &stack, const ByteSpan &functionInstructionsCode, size_t &i, OPCode const opcode,
+                    const ModuleInfo &moduleInfo, const ModuleInfo::FunctionInfo &functionInfo, bool const branchFollows) {
+  uint32_t offset = 0U;
+  if (hasVectorMemoryArgument(opcode)) {
+    static_cast<void>(readULEB128(functionInstructionsCode, i)); // the alignment is only a hint
+    offset = readULEB128(functionInstructionsCode, i);
+    if (!moduleInfo.hasMemory) {
+      throw std::runtime_error("error: memory access without a linear memory.");
+    }
+  }
+  uint32_t const numImmediateBytes = vectorImmediateBytes(opcode);
+  if ((i + numImmediateBytes) > functionInstructionsCode.size()) {
+    throw std::runtime_error("error: SIMD immediate exceeds the function body.");
+  }
+  uint64_t lo = 0U;
+  uint64_t hi = 0U;
+  uint32_t lane = 0U;
+  if (numImmediateBytes == 16U) {
+    for (uint32_t byte = 0U; byte < 8U; ++byte) {
+      lo |= static_cast<uint64_t>(functionInstructionsCode[i + byte]) << (8U * byte);
+      hi |= static_cast<uint64_t>(functionInstructionsCode[i + 8U + byte]) << (8U * byte);
+    }
+  } else if (numImmediateBytes == 1U) {
+    lane = functionInstructionsCode[i];
+    if (lane >= numLanesOfAccess(opcode)) {
+      throw std::runtime_error("error: SIMD lane index out of range.");
+    }
+  }
+  i += numImmediateBytes;
+  uint32_t const numOperands = vectorOperandCount(opcode);
+  if (stack.size() < numOperands) {
+    throw std::runtime_error("error: operand stack underflow at a SIMD instruction.");
+  }
+  if (hasVectorMemoryArgument(opcode)) {
+    vectorMemoryOperator(assembler, stack, opcode, offset, lane, functionInfo);
+    return;
+  }
+  size_t const slot = stack.size() - numOperands;
+  TReg const dst = floatOperandRegister(functionInfo, slot);
+  StackElement result = scratchRegisterElement(dst, WasmType::VEC_TYPE);
+  switch (opcode) {
+  case OPCode::V128_CONST: {
+    emitVectorConstant(assembler, dst, lo, hi);
+    break;
+  }
+  case OPCode::I8X16_SHUFFLE: {
+    // TBL over the register pair V30:V31, the lane indices are the constant table index vector
+    for (uint32_t byte = 0U; byte < 16U; ++byte) {
+      if (((byte < 8U ? (lo >> (8U * byte)) : (hi >> (8U * (byte - 8U)))) & 0xFFU) >= 32U) {
+        throw std::runtime_error("error: i8x16.shuffle lane index out of range.");
       }
+    }
+    assembler.MOVVector(TReg::F30, valueRegister(assembler, stack.peek(1U), dst));
+    assembler.MOVVector(TReg::F31, valueRegister(assembler, stack.peek(0U), floatOperandRegister(functionInfo, slot + 1U)));
+    emitVectorConstant(assembler, dst, lo, hi);
+    assembler.Vector(VectorOp::TBL2, Lanes::B16, dst, TReg::F30, dst);
+    break;
+  }
+  case OPCode::I8X16_SPLAT:
+  case OPCode::I16X8_SPLAT:
+  case OPCode::I32X4_SPLAT:
+  case OPCode::I64X2_SPLAT:
+  case OPCode::F32X4_SPLAT:
+  case OPCode::F64X2_SPLAT: {
+    LaneAccess const access = laneAccess(opcode);
+    TReg const src = valueRegister(assembler, stack.top(), slotRegister(functionInfo, slot, access.scalarType));
+    if (isFloatType(access.scalarType)) {
+      assembler.DUPElement(access.lanes, dst, src, 0U);
+    } else {
+      assembler.DUPGeneral(access.lanes, dst, src);
+    }
+    break;
+  }
+  case OPCode::I8X16_EXTRACT_LANE_S:
+  case OPCode::I8X16_EXTRACT_LANE_U:
+  case OPCode::I16X8_EXTRACT_LANE_S:
+  case OPCode::I16X8_EXTRACT_LANE_U:
+  case OPCode::I32X4_EXTRACT_LANE:
+  case OPCode::I64X2_EXTRACT_LANE:
+  case OPCode::F32X4_EXTRACT_LANE:
+  case OPCode::F64X2_EXTRACT_LANE: {
+    LaneAccess const access = laneAccess(opcode);
+    TReg const src = valueRegister(assembler, stack.top(), dst);
+    TReg const scalar = slotRegister(functionInfo, slot, access.scalarType);
+    if (isFloatType(access.scalarType)) {
+      assembler.DUPScalar(access.lanes, scalar, src, lane);
+    } else if ((opcode == OPCode::I8X16_EXTRACT_LANE_S) || (opcode == OPCode::I16X8_EXTRACT_LANE_S)) {
+      assembler.SMOV(access.lanes, scalar, src, lane);
+    } else {
+      assembler.UMOV(access.lanes, scalar, src, lane);
+    }
+    result = scratchRegisterElement(scalar, access.scalarType);
+    break;
+  }
+  case OPCode::I8X16_REPLACE_LANE:
+  case OPCode::I16X8_REPLACE_LANE:
+  case OPCode::I32X4_REPLACE_LANE:
+  case OPCode::I64X2_REPLACE_LANE:
+  case OPCode::F32X4_REPLACE_LANE:
+  case OPCode::F64X2_REPLACE_LANE: {
+    LaneAccess const access = laneAccess(opcode);
+    TReg const value = valueRegister(assembler, stack.peek(0U), slotRegister(functionInfo, slot + 1U, access.scalarType));
+    TReg const vector = valueRegister(assembler, stack.peek(1U), dst);
+    if (vector != dst) {
+      assembler.MOVVector(dst, vector);
+    }
+    if (isFloatType(access.scalarType)) {
+      assembler.INSElement(access.lanes, dst, lane, value, 0U);
+    } else {
+      assembler.INSGeneral(access.lanes, dst, lane, value);
+    }
+    break;
+  }
+  case OPCode::V128_BITSELECT: {
+    // lanes of the first operand where the mask is set, of the second elsewhere
+    TReg const mask = valueRegister(assembler, stack.peek(0U), floatOperandRegister(functionInfo, slot + 2U));
+    TReg const second = valueRegister(assembler, stack.peek(1U), floatOperandRegister(functionInfo, slot + 1U));
+    TReg const first = valueRegister(assembler, stack.peek(2U), dst);
+    if (first != dst) {
+      assembler.MOVVector(dst, first);
+    }
+    assembler.Vector(VectorOp::BIF, Lanes::B16, dst, second, mask);
+    break;
+  }
+  case OPCode::V128_ANY_TRUE:
+  case OPCode::I8X16_ALL_TRUE:
+  case OPCode::I16X8_ALL_TRUE:
+  case OPCode::I32X4_ALL_TRUE:
+  case OPCode::I64X2_ALL_TRUE:
+  case OPCode::I8X16_BITMASK:
+  case OPCode::I16X8_BITMASK:
+  case OPCode::I32X4_BITMASK:
+  case OPCode::I64X2_BITMASK: {
+    TReg const reg = operandRegister(functionInfo, slot);
+    OPCode const comparison = emitVectorReduction(assembler, opcode, reg, valueRegister(assembler, stack.top(), dst));
+    if (comparison == OPCode::NOP) {
+      result = scratchRegisterElement(reg, WasmType::I32);
+    } else if (branchFollows) {
+      result = StackElement::action(comparison, reg, TReg::NONE, WasmType::I32, 0U);
+    } else {
+      emitImmediateOperation(assembler, comparison, reg, reg, 0U);
+      result = scratchRegisterElement(reg, WasmType::I32);
+    }
+    break;
+  }
+  case OPCode::I8X16_SHL:
+  case OPCode::I8X16_SHR_S:
+  case OPCode::I8X16_SHR_U:
+  case OPCode::I16X8_SHL:
+  case OPCode::I16X8_SHR_S:
+  case OPCode::I16X8_SHR_U:
+  case OPCode::I32X4_SHL:
+  case OPCode::I32X4_SHR_S:
+  case OPCode::I32X4_SHR_U:
+  case OPCode::I64X2_SHL:
+  case OPCode::I64X2_SHR_S:
+  case OPCode::I64X2_SHR_U: {
+    TReg const src = valueRegister(assembler, stack.peek(1U), dst);
+    emitVectorShift(assembler, opcode, dst, src, stack.peek(0U), operandRegister(functionInfo, slot + 1U));
+    break;
+  }
+  default: {
+    TReg const lhs = valueRegister(assembler, stack.peek(numOperands - 1U), dst);
+    TReg const rhs = (numOperands == 2U) ? valueRegister(assembler, stack.peek(0U), floatOperandRegister(functionInfo, slot + 1U)) : TReg::NONE;
+    emitVectorOperation(assembler, opcode, dst, lhs, rhs);
+    break;
+  }
+  }
+  stack.pop(numOperands);
+  stack.push(result);
+}
 
-      StackElement stackElement;
-      stackElement.type = StackType::LOCAL;
+// After RETURN, BR and BR_TABLE the rest of the current arm is unreachable and what it left on the operand stack is dropped.
+// Outside of any block the rest of the function body is skipped.
+void endReachableCode(std::vector<ControlFrame> &controlFrames, Stack &stack, size_t &i, size_t const bodySize) {
+  if (controlFrames.empty()) {
+    i = bodySize;
+    return;
+  }
+  ControlFrame &frame = controlFrames.back();
+  frame.unreachable = true;
+  if (stack.size() > frame.stackHeight) {
+    stack.pop(stack.size() - frame.stackHeight);
+  }
+}
+
+// Push the value of a local. A local in a register is referenced directly, a spilled one is loaded into the register of
+// its operand stack slot.
+void pushLocal(AArch64_Assembler &assembler, Stack &stack, uint32_t const localIndex, const ModuleInfo::LocalVar &localVar,
+               const ModuleInfo::FunctionInfo &functionInfo) {
+  StackElement stackElement;
+  stackElement.variableData.location.localIdx = localIndex;
+  stackElement.variableData.location.wasmtype = localVar.wasmType;
+  if (isSpilled(localVar)) {
+    TReg const reg = slotRegister(functionInfo, stack.size(), localVar.wasmType);
+    assembler.LoadStoreImmediate(spillOperation(localVar.wasmType, true), reg, TReg::SP, localVar.stackFramePosition);
+    stackElement = scratchRegisterElement(reg, localVar.wasmType);
+    stackElement.variableData.location.localIdx = localIndex;
+  } else {
+    stackElement.type = StackType::LOCAL;
+    stackElement.variableData.location.reg = localVar.reg;
+  }
+  stack.push(stackElement);
+}
+
+// Write the top of the operand stack to a local, without popping it
+void storeLocal(AArch64_Assembler &assembler, Stack &stack, const ModuleInfo::LocalVar &localVar,
+                const ModuleInfo::FunctionInfo &functionInfo) {
+  const StackElement &element = stack.top();
+  if (!isSpilled(localVar)) {
+    materializeOperands(assembler, stack, 1U, localVar.reg, functionInfo);
+    moveToRegister(assembler, element, localVar.reg);
+    return;
+  }
+  TReg reg = element.variableData.location.reg;
+  if (!isInRegister(element)) {
+    reg = slotRegister(functionInfo, stack.size() - 1U, localVar.wasmType);
+    moveToRegister(assembler, element, reg);
+  }
+  assembler.LoadStoreImmediate(spillOperation(localVar.wasmType, false), reg, TReg::SP, localVar.stackFramePosition);
+}
+
+// operand stack storage of the compile thread, reused for every function it compiles
+std::vector<StackElement> &operandStackStorage() {
+  thread_local std::vector<StackElement> storage;
+  return storage;
+}
+
+MachineCode parseOpCode(const ByteSpan &functionInstructionsCode, size_t index, const size_t funcIndex, ModuleInfo &moduleInfo,
+                        std::vector<ModuleInfo::CallSite> &callSites, std::vector<ModuleInfo::TrapSite> &trapSites) {
+  Stack stack(operandStackStorage());
+  stack.reserve(maxOperandStackDepth(functionInstructionsCode, index));
+  AArch64_Assembler assembler(moduleInfo);
+  // about one instruction per body byte in the spec tests, twice that plus the local initialization covers nearly every function
+  assembler.reserve(functionInstructionsCode.size() * 2U + moduleInfo.functionsLocalVars[funcIndex].size() * 2U + 8U);
+
+  emitPrologue(assembler, moduleInfo.functionsLocalVars[funcIndex], moduleInfo.functionInfos[funcIndex]);
 
-      StackElement::VariableData data;
-      stackElement.variableData.location.localIdx = left.variableData.location.localIdx;
-      stackElement.variableData.location.reg = moduleInfo.functionsLocalVars[funcIndex][left.variableData.location.localIdx].reg;
+  std::vector<ControlFrame> &controlFrames = controlFrameStorage();
+  controlFrames.clear();
+  uint32_t numCalls = 0U;
+
+  for (size_t i = index; i < functionInstructionsCode.size();) {
+    switch (static_cast<OPCode>(functionInstructionsCode[i])) {
+    case OPCode::I32_CONST: {
+      i++;
+      int32_t const i32ConstValue = readSLEB128(functionInstructionsCode, i);
+      StackElement stackElement;
+      stackElement.type = StackType::CONSTANT_I32;
+      stackElement.data.constUnion.u32 = static_cast<uint32_t>(i32ConstValue);
       stack.push(stackElement);
       break;
     }
-    case OPCode::I32_MUL: {
+    case OPCode::I64_CONST: {
       i++;
-      if (stack.size() < 2) {
-        throw std::runtime_error("error: stack size less than 2, parse I32_MUL wasm opCode error.");
-      }
-      StackElement right = stack.top();
-      stack.pop();
-      StackElement left = stack.top();
-      stack.pop();
-      if (static_cast<uint32_t>(left.type) != StackType::LOCAL || static_cast<uint32_t>(right.type) != StackType::LOCAL) {
-        throw std::runtime_error("error: stack element type is not LOCAL, parse I32_MUL wasm opCode error.");
-      }
-      auto returnType = moduleInfo.getReturnTypeForSignature(moduleInfo.functionInfos[funcIndex].typeIndex);
-
-      if (returnType == WasmType::I32) {
-        assembler.Multiply(false, moduleInfo.functionsLocalVars[funcIndex][left.variableData.location.localIdx].reg,
-                           moduleInfo.functionsLocalVars[funcIndex][right.variableData.location.localIdx].reg);
+      int64_t const i64ConstValue = readSLEB128_64(functionInstructionsCode, i);
+      StackElement stackElement;
+      stackElement.type = StackType::CONSTANT_I64;
+      stackElement.data.constUnion.u64 = static_cast<uint64_t>(i64ConstValue);
+      stack.push(stackElement);
+      break;
+    }
+    case OPCode::F32_CONST:
+    case OPCode::F64_CONST: {
+      // the raw little endian bits, the value is never computed with on the host
+      bool const isDouble = static_cast<OPCode>(functionInstructionsCode[i++]) == OPCode::F64_CONST;
+      uint32_t const numBytes = isDouble ? 8U : 4U;
+      if ((i + numBytes) > functionInstructionsCode.size()) {
+        throw std::runtime_error("error: float constant exceeds the function body.");
+      }
+      uint64_t bits = 0U;
+      for (uint32_t byte = 0U; byte < numBytes; ++byte) {
+        bits |= static_cast<uint64_t>(functionInstructionsCode[i + byte]) << (8U * byte);
+      }
+      i += numBytes;
+      StackElement stackElement;
+      if (isDouble) {
+        stackElement.type = StackType::CONSTANT_F64;
+        stackElement.data.constUnion.u64 = bits;
       } else {
-        auto leftLocalVarType = moduleInfo.functionsLocalVars[funcIndex][left.variableData.location.localIdx].wasmType;
-        auto rightLocalVarType = moduleInfo.functionsLocalVars[funcIndex][right.variableData.location.localIdx].wasmType;
-        if (rightLocalVarType == WasmType::I32) {
-          assembler.Sxtw(moduleInfo.functionsLocalVars[funcIndex][right.variableData.location.localIdx].reg,
-                         moduleInfo.functionsLocalVars[funcIndex][right.variableData.location.localIdx].reg);
-        } else {
-          throw std::runtime_error("error: I32_MUL right type is not I32 or I64, parse I32_MUL wasm opCode error.");
-        }
-        if (leftLocalVarType == WasmType::I32) {
-          assembler.Sxtw(moduleInfo.functionsLocalVars[funcIndex][left.variableData.location.localIdx].reg,
-                         moduleInfo.functionsLocalVars[funcIndex][left.variableData.location.localIdx].reg);
-        } else {
-          throw std::runtime_error("error: I32_MUL left type is not I32 or I64, parse I32_MUL wasm opCode error.");
-        }
-        assembler.Multiply(true, moduleInfo.functionsLocalVars[funcIndex][left.variableData.location.localIdx].reg,
-                           moduleInfo.functionsLocalVars[funcIndex][right.variableData.location.localIdx].reg);
+        stackElement.type = StackType::CONSTANT_F32;
+        stackElement.data.constUnion.u32 = static_cast<uint32_t>(bits);
       }
-
-      StackElement stackElement;
-      stackElement.type = StackType::LOCAL;
-
-      StackElement::VariableData data;
-      stackElement.variableData.location.localIdx = left.variableData.location.localIdx;
-      stackElement.variableData.location.reg = moduleInfo.functionsLocalVars[funcIndex][left.variableData.location.localIdx].reg;
       stack.push(stackElement);
       break;
     }
-    case OPCode::I64_ADD: {
+    case OPCode::LOCAL_GET: {
+      i++;
+      uint32_t localIndex = readULEB128(functionInstructionsCode, i);
+      pushLocal(assembler, stack, localIndex, moduleInfo.functionsLocalVars[funcIndex][localIndex], moduleInfo.functionInfos[funcIndex]);
+      break;
+    }
+    case OPCode::BLOCK:
+    case OPCode::LOOP: {
+      auto const opcode = static_cast<OPCode>(functionInstructionsCode[i++]);
+      WasmType const resultType = readBlockType(functionInstructionsCode, i);
+      materializeOperands(assembler, stack, 0U, TReg::NONE, moduleInfo.functionInfos[funcIndex]);
+      ControlFrame frame = openControlFrame(assembler, opcode, resultType, stack.size(), moduleInfo.functionInfos[funcIndex]);
+      if (opcode == OPCode::LOOP) {
+        frame.loopLabel = assembler.newLabel();
+        assembler.bind(frame.loopLabel);
+      }
+      controlFrames.push_back(frame);
+      break;
+    }
+    case OPCode::IF: {
       i++;
-      if (stack.size() < 2) {
-        throw std::runtime_error("error: stack size less than 2, parse I64_ADD wasm opCode error.");
+      WasmType const resultType = readBlockType(functionInstructionsCode, i);
+      if (stack.empty()) {
+        LOG_ERROR("error: stack is empty, parse IF OPCODE error");
+        exit(1);
       }
-      StackElement right = stack.top();
-      stack.pop();
-      StackElement left = stack.top();
-      stack.pop();
-      if (static_cast<uint32_t>(left.type) != StackType::LOCAL || static_cast<uint32_t>(right.type) != StackType::LOCAL) {
-        throw std::runtime_error("error: stack element type is not LOCAL, parse I64_ADD wasm opCode error.");
+      ControlFrame frame = openControlFrame(assembler, OPCode::IF, resultType, stack.size() - 1U, moduleInfo.functionInfos[funcIndex]);
+      frame.elseLabel = assembler.newLabel();
+      materializeOperands(assembler, stack, 1U, TReg::NONE, moduleInfo.functionInfos[funcIndex]);
+      const StackElement &stackElement = stack.top();
+      switch (static_cast<uint32_t>(stackElement.type)) {
+      case StackType::LOCAL:
+      case StackType::SCRATCHREGISTER_I32:
+      case StackType::DEFERREDACTION:
+      case StackType::CONSTANT_I32: {
+        TReg const scratch = operandRegister(moduleInfo.functionInfos[funcIndex], stack.size() - 1U);
+        emitConditionalBranch(assembler, stackElement, false, frame.elseLabel, scratch);
+        break;
       }
-      auto returnType = moduleInfo.getReturnTypeForSignature(moduleInfo.functionInfos[funcIndex].typeIndex);
-
-      if (returnType == WasmType::I32) {
-        assembler.AddShiftedRegister(false, moduleInfo.functionsLocalVars[funcIndex][left.variableData.location.localIdx].reg,
-                                     moduleInfo.functionsLocalVars[funcIndex][right.variableData.location.localIdx].reg);
-      } else {
-        auto leftLocalVarType = moduleInfo.functionsLocalVars[funcIndex][left.variableData.location.localIdx].wasmType;
-        auto rightLocalVarType = moduleInfo.functionsLocalVars[funcIndex][right.variableData.location.localIdx].wasmType;
-        if (rightLocalVarType == WasmType::I32) {
-          assembler.Sxtw(moduleInfo.functionsLocalVars[funcIndex][right.variableData.location.localIdx].reg,
-                         moduleInfo.functionsLocalVars[funcIndex][right.variableData.location.localIdx].reg);
-        } else if (rightLocalVarType != WasmType::I64) {
-          throw std::runtime_error("error: I64_ADD right type is not I32 or I64, parse I64_ADD wasm opCode error.");
-        }
-        if (leftLocalVarType == WasmType::I32) {
-          assembler.Sxtw(moduleInfo.functionsLocalVars[funcIndex][left.variableData.location.localIdx].reg,
-                         moduleInfo.functionsLocalVars[funcIndex][left.variableData.location.localIdx].reg);
-        } else if (rightLocalVarType != WasmType::I64) {
-          throw std::runtime_error("error: I64_ADD left type is not I32 or I64, parse I64_ADD wasm opCode error.");
-        }
-        assembler.AddShiftedRegister(true, moduleInfo.functionsLocalVars[funcIndex][left.variableData.location.localIdx].reg,
-                                     moduleInfo.functionsLocalVars[funcIndex][right.variableData.location.localIdx].reg);
+      default: {
+        throw std::runtime_error("Error: no support if compare.");
       }
-
-      StackElement stackElement;
-      stackElement.type = StackType::LOCAL;
-
-      StackElement::VariableData data;
-      stackElement.variableData.location.localIdx = left.variableData.location.localIdx;
-      stackElement.variableData.location.reg = moduleInfo.functionsLocalVars[funcIndex][left.variableData.location.localIdx].reg;
-      stack.push(stackElement);
+      }
+      stack.pop();
+      controlFrames.push_back(frame);
       break;
     }
-    case OPCode::I64_SUB: {
+    case OPCode::NOP: {
+      i++;
+      break;
+    }
+    case OPCode::DROP: {
       i++;
-      if (stack.size() < 2) {
-        throw std::runtime_error("error: stack size less than 2, parse I64_SUB wasm opCode error.");
+      if (stack.empty()) {
+        throw std::runtime_error("error: stack is empty, parse DROP error.");
       }
-      StackElement right = stack.top();
-      stack.pop();
-      StackElement left = stack.top();
       stack.pop();
-      if (static_cast<uint32_t>(left.type) != StackType::LOCAL || static_cast<uint32_t>(right.type) != StackType::LOCAL) {
-        throw std::runtime_error("error: stack element type is not LOCAL, parse I64_SUB wasm opCode error.");
+      break;
+    }
+    case OPCode::ELSE: {
+      i++;
+      if (controlFrames.empty() || (controlFrames.back().opcode != OPCode::IF)) {
+        throw std::runtime_error("error: ELSE without a matching IF.");
       }
-      auto returnType = moduleInfo.getReturnTypeForSignature(moduleInfo.functionInfos[funcIndex].typeIndex);
-
-      if (returnType == WasmType::I32) {
-        assembler.SubShiftedRegister(false, moduleInfo.functionsLocalVars[funcIndex][left.variableData.location.localIdx].reg,
-                                     moduleInfo.functionsLocalVars[funcIndex][right.variableData.location.localIdx].reg);
-      } else {
-        auto leftLocalVarType = moduleInfo.functionsLocalVars[funcIndex][left.variableData.location.localIdx].wasmType;
-        auto rightLocalVarType = moduleInfo.functionsLocalVars[funcIndex][right.variableData.location.localIdx].wasmType;
-        if (rightLocalVarType == WasmType::I32) {
-          assembler.Sxtw(moduleInfo.functionsLocalVars[funcIndex][right.variableData.location.localIdx].reg,
-                         moduleInfo.functionsLocalVars[funcIndex][right.variableData.location.localIdx].reg);
-        } else if (rightLocalVarType != WasmType::I64) {
-          throw std::runtime_error("error: I64_SUB right type is not I32 or I64, parse I64_SUB wasm opCode error.");
-        }
-        if (leftLocalVarType == WasmType::I32) {
-          assembler.Sxtw(moduleInfo.functionsLocalVars[funcIndex][left.variableData.location.localIdx].reg,
-                         moduleInfo.functionsLocalVars[funcIndex][left.variableData.location.localIdx].reg);
-        } else if (rightLocalVarType != WasmType::I64) {
-          throw std::runtime_error("error: I64_SUB left type is not I32 or I64, parse I64_SUB wasm opCode error.");
-        }
-        assembler.SubShiftedRegister(true, moduleInfo.functionsLocalVars[funcIndex][left.variableData.location.localIdx].reg,
-                                     moduleInfo.functionsLocalVars[funcIndex][right.variableData.location.localIdx].reg);
+      ControlFrame &frame = controlFrames.back();
+      closeArm(assembler, stack, frame);
+      if (!frame.unreachable) {
+        assembler.B(frame.endLabel);
       }
-
-      StackElement stackElement;
-      stackElement.type = StackType::LOCAL;
-
-      StackElement::VariableData data;
-      stackElement.variableData.location.localIdx = left.variableData.location.localIdx;
-      stackElement.variableData.location.reg = moduleInfo.functionsLocalVars[funcIndex][left.variableData.location.localIdx].reg;
-      stack.push(stackElement);
+      assembler.bind(frame.elseLabel);
+      frame.unreachable = false;
       break;
     }
-    case OPCode::I64_MUL: {
+    case OPCode::LOCAL_SET: { // pop stack and set value
       i++;
-      if (stack.size() < 2) {
-        throw std::runtime_error("error: stack size less than 2, parse I64_MUL wasm opCode error.");
+      uint32_t localIndex = readULEB128(functionInstructionsCode, i);
+      if (stack.empty()) {
+        LOG_ERROR("error: stack is empty, parse LOCAL_SET error");
+        exit(1);
       }
-      StackElement right = stack.top();
+      storeLocal(assembler, stack, moduleInfo.functionsLocalVars[funcIndex][localIndex], moduleInfo.functionInfos[funcIndex]);
       stack.pop();
-      StackElement left = stack.top();
-      stack.pop();
-      if (static_cast<uint32_t>(left.type) != StackType::LOCAL || static_cast<uint32_t>(right.type) != StackType::LOCAL) {
-        throw std::runtime_error("error: stack element type is not LOCAL, parse I64_MUL wasm opCode error.");
+      break;
+    }
+    case OPCode::LOCAL_TEE: {
+      i++;
+      uint32_t localIndex = readULEB128(functionInstructionsCode, i);
+      if (stack.empty()) {
+        LOG_ERROR("error: stack is empty, parse LOCAL_SET error");
+        exit(1);
       }
-      auto returnType = moduleInfo.getReturnTypeForSignature(moduleInfo.functionInfos[funcIndex].typeIndex);
-
-      if (returnType == WasmType::I32) {
-        assembler.Multiply(false, moduleInfo.functionsLocalVars[funcIndex][left.variableData.location.localIdx].reg,
-                           moduleInfo.functionsLocalVars[funcIndex][right.variableData.location.localIdx].reg);
-      } else {
-        auto leftLocalVarType = moduleInfo.functionsLocalVars[funcIndex][left.variableData.location.localIdx].wasmType;
-        auto rightLocalVarType = moduleInfo.functionsLocalVars[funcIndex][right.variableData.location.localIdx].wasmType;
-        if (rightLocalVarType == WasmType::I32) {
-          assembler.Sxtw(moduleInfo.functionsLocalVars[funcIndex][right.variableData.location.localIdx].reg,
-                         moduleInfo.functionsLocalVars[funcIndex][right.variableData.location.localIdx].reg);
-        } else if (rightLocalVarType != WasmType::I64) {
-          throw std::runtime_error("error: I64_MUL right type is not I32 or I64, parse I64_MUL wasm opCode error.");
-        }
-        if (leftLocalVarType == WasmType::I32) {
-          assembler.Sxtw(moduleInfo.functionsLocalVars[funcIndex][left.variableData.location.localIdx].reg,
-                         moduleInfo.functionsLocalVars[funcIndex][left.variableData.location.localIdx].reg);
-        } else if (rightLocalVarType != WasmType::I64) {
-          throw std::runtime_error("error: I64_MUL left type is not I32 or I64, parse I64_MUL wasm opCode error.");
+      const ModuleInfo::LocalVar &localVar = moduleInfo.functionsLocalVars[funcIndex][localIndex];
+      storeLocal(assembler, stack, localVar, moduleInfo.functionInfos[funcIndex]);
+      if (static_cast<uint32_t>(stack.top().type) == StackType::DEFERREDACTION) {
+        // the store emitted the action, keep its result instead of emitting it again from possibly overwritten operands
+        if (isSpilled(localVar)) {
+          stack.top() = scratchRegisterElement(slotRegister(moduleInfo.functionInfos[funcIndex], stack.size() - 1U, localVar.wasmType),
+                                               localVar.wasmType);
+        } else {
+          stack.top() = scratchRegisterElement(localVar.reg, localVar.wasmType);
+          stack.top().type = StackType::LOCAL;
+          stack.top().variableData.location.localIdx = localIndex;
         }
-        assembler.Multiply(true, moduleInfo.functionsLocalVars[funcIndex][left.variableData.location.localIdx].reg,
-                           moduleInfo.functionsLocalVars[funcIndex][right.variableData.location.localIdx].reg);
       }
-
-      StackElement stackElement;
-      stackElement.type = StackType::LOCAL;
-
-      StackElement::VariableData data;
-      stackElement.variableData.location.localIdx = left.variableData.location.localIdx;
-      stackElement.variableData.location.reg = moduleInfo.functionsLocalVars[funcIndex][left.variableData.location.localIdx].reg;
-      stack.push(stackElement);
       break;
     }
-    case OPCode::I64_DIV_S: {
+    case OPCode::END: {
       i++;
-      if (stack.size() < 2) {
-        throw std::runtime_error("error: stack size less than 2, parse I64_DIV_S wasm opCode error.");
+      if (controlFrames.empty()) { // end of the function body
+        if (!stack.empty()) {
+          moveToRegister(assembler, stack.top(), resultRegister(elementType(stack.top())));
+          LOG_TRACE("return value moved to register 0");
+          stack.pop();
+        }
+        emitReturn(assembler, moduleInfo.functionInfos[funcIndex]);
+        break;
       }
-      StackElement right = stack.top();
-      stack.pop();
-      StackElement left = stack.top();
-      stack.pop();
-      if (static_cast<uint32_t>(left.type) != StackType::LOCAL || static_cast<uint32_t>(right.type) != StackType::LOCAL) {
-        throw std::runtime_error("error: stack element type is not LOCAL, parse I64_DIV_S wasm opCode error.");
+      ControlFrame const frame = controlFrames.back();
+      controlFrames.pop_back();
+      closeArm(assembler, stack, frame);
+      if ((frame.opcode == OPCode::IF) && !assembler.isBound(frame.elseLabel)) {
+        assembler.bind(frame.elseLabel); // IF without ELSE
+      }
+      assembler.bind(frame.endLabel);
+      if (frame.resultType != WasmType::TVOID) {
+        stack.push(blockResult(frame));
       }
-      auto returnType = moduleInfo.getReturnTypeForSignature(moduleInfo.functionInfos[funcIndex].typeIndex);
-
-      assembler.SDIV(true, moduleInfo.functionsLocalVars[funcIndex][left.variableData.location.localIdx].reg,
-                     moduleInfo.functionsLocalVars[funcIndex][right.variableData.location.localIdx].reg);
-
-      StackElement stackElement;
-      stackElement.type = StackType::LOCAL;
-
-      StackElement::VariableData data;
-      stackElement.variableData.location.localIdx = left.variableData.location.localIdx;
-      stackElement.variableData.location.reg = moduleInfo.functionsLocalVars[funcIndex][left.variableData.location.localIdx].reg;
-      stack.push(stackElement);
       break;
     }
-    case OPCode::I64_DIV_U: {
-      i++;
-      if (stack.size() < 2) {
-        throw std::runtime_error("error: stack size less than 2, parse I64_DIV_U wasm opCode error.");
+    case OPCode::I32_EQZ:
+    case OPCode::I64_EQZ: {
+      // x == 0, so the comparison is folded and fused like any other
+      bool const is64 = static_cast<OPCode>(functionInstructionsCode[i++]) == OPCode::I64_EQZ;
+      if (!stack.empty() && (static_cast<uint32_t>(stack.top().type) == StackType::DEFERREDACTION) &&
+          isComparison(stack.top().data.deferred.opcode)) {
+        // a comparison is 0 or 1, its eqz is the inverted comparison
+        stack.top().data.deferred.opcode = invertedComparison(stack.top().data.deferred.opcode);
+        break;
       }
-      StackElement right = stack.top();
-      stack.pop();
-      StackElement left = stack.top();
-      stack.pop();
-      if (static_cast<uint32_t>(left.type) != StackType::LOCAL || static_cast<uint32_t>(right.type) != StackType::LOCAL) {
-        throw std::runtime_error("error: stack element type is not LOCAL, parse I64_DIV_U wasm opCode error.");
+      stack.push(is64 ? StackElement::i64Const(0U) : StackElement::i32Const(0U));
+      binaryOperator(assembler, stack, is64 ? OPCode::I64_EQ : OPCode::I32_EQ, WasmType::I32, moduleInfo, moduleInfo.functionInfos[funcIndex]);
+      break;
+    }
+    case OPCode::I32_EQ:
+    case OPCode::I32_NE:
+    case OPCode::I32_LT_S:
+    case OPCode::I32_LT_U:
+    case OPCode::I32_GT_S:
+    case OPCode::I32_GT_U:
+    case OPCode::I32_LE_S:
+    case OPCode::I32_LE_U:
+    case OPCode::I32_GE_S:
+    case OPCode::I32_GE_U:
+    case OPCode::I64_EQ:
+    case OPCode::I64_NE:
+    case OPCode::I64_LT_S:
+    case OPCode::I64_LT_U:
+    case OPCode::I64_GT_S:
+    case OPCode::I64_GT_U:
+    case OPCode::I64_LE_S:
+    case OPCode::I64_LE_U:
+    case OPCode::I64_GE_S:
+    case OPCode::I64_GE_U:
+    case OPCode::I32_ADD:
+    case OPCode::I32_SUB:
+    case OPCode::I32_MUL:
+    case OPCode::I32_DIV_S:
+    case OPCode::I32_DIV_U:
+    case OPCode::I32_REM_S:
+    case OPCode::I32_REM_U:
+    case OPCode::I32_AND:
+    case OPCode::I32_OR:
+    case OPCode::I32_XOR:
+    case OPCode::I32_SHL:
+    case OPCode::I32_SHR_S:
+    case OPCode::I32_SHR_U: {
+      auto const opcode = static_cast<OPCode>(functionInstructionsCode[i++]);
+      OPCode const next = (i < functionInstructionsCode.size()) ? static_cast<OPCode>(functionInstructionsCode[i]) : OPCode::NOP;
+      bool const branchFollows = (next == OPCode::IF) || (next == OPCode::BR_IF);
+      binaryOperator(assembler, stack, opcode, WasmType::I32, moduleInfo, moduleInfo.functionInfos[funcIndex], branchFollows);
+      break;
+    }
+    case OPCode::I64_ADD:
+    case OPCode::I64_SUB:
+    case OPCode::I64_MUL:
+    case OPCode::I64_DIV_S:
+    case OPCode::I64_DIV_U:
+    case OPCode::I64_REM_S:
+    case OPCode::I64_REM_U:
+    case OPCode::I64_AND:
+    case OPCode::I64_OR:
+    case OPCode::I64_XOR:
+    case OPCode::I64_SHL:
+    case OPCode::I64_SHR_S:
+    case OPCode::I64_SHR_U: {
+      binaryOperator(assembler, stack, static_cast<OPCode>(functionInstructionsCode[i++]), WasmType::I64, moduleInfo,
+                     moduleInfo.functionInfos[funcIndex]);
+      break;
+    }
+    case OPCode::F32_EQ:
+    case OPCode::F32_NE:
+    case OPCode::F32_LT:
+    case OPCode::F32_GT:
+    case OPCode::F32_LE:
+    case OPCode::F32_GE:
+    case OPCode::F64_EQ:
+    case OPCode::F64_NE:
+    case OPCode::F64_LT:
+    case OPCode::F64_GT:
+    case OPCode::F64_LE:
+    case OPCode::F64_GE:
+    case OPCode::F32_ADD:
+    case OPCode::F32_SUB:
+    case OPCode::F32_MUL:
+    case OPCode::F32_DIV:
+    case OPCode::F32_MIN:
+    case OPCode::F32_MAX:
+    case OPCode::F32_COPYSIGN:
+    case OPCode::F64_ADD:
+    case OPCode::F64_SUB:
+    case OPCode::F64_MUL:
+    case OPCode::F64_DIV:
+    case OPCode::F64_MIN:
+    case OPCode::F64_MAX:
+    case OPCode::F64_COPYSIGN: {
+      auto const opcode = static_cast<OPCode>(functionInstructionsCode[i++]);
+      OPCode const next = (i < functionInstructionsCode.size()) ? static_cast<OPCode>(functionInstructionsCode[i]) : OPCode::NOP;
+      bool const branchFollows = (next == OPCode::IF) || (next == OPCode::BR_IF);
+      floatBinaryOperator(assembler, stack, opcode, moduleInfo.functionInfos[funcIndex], branchFollows);
+      break;
+    }
+    case OPCode::F32_ABS:
+    case OPCode::F32_NEG:
+    case OPCode::F32_CEIL:
+    case OPCode::F32_FLOOR:
+    case OPCode::F32_TRUNC:
+    case OPCode::F32_NEAREST:
+    case OPCode::F32_SQRT:
+    case OPCode::F64_ABS:
+    case OPCode::F64_NEG:
+    case OPCode::F64_CEIL:
+    case OPCode::F64_FLOOR:
+    case OPCode::F64_TRUNC:
+    case OPCode::F64_NEAREST:
+    case OPCode::F64_SQRT:
+    case OPCode::I32_WRAP_I64:
+    case OPCode::I32_TRUNC_F32_S:
+    case OPCode::I32_TRUNC_F32_U:
+    case OPCode::I32_TRUNC_F64_S:
+    case OPCode::I32_TRUNC_F64_U:
+    case OPCode::I64_EXTEND_I32_S:
+    case OPCode::I64_EXTEND_I32_U:
+    case OPCode::I64_TRUNC_F32_S:
+    case OPCode::I64_TRUNC_F32_U:
+    case OPCode::I64_TRUNC_F64_S:
+    case OPCode::I64_TRUNC_F64_U:
+    case OPCode::F32_CONVERT_I32_S:
+    case OPCode::F32_CONVERT_I32_U:
+    case OPCode::F32_CONVERT_I64_S:
+    case OPCode::F32_CONVERT_I64_U:
+    case OPCode::F32_DEMOTE_F64:
+    case OPCode::F64_CONVERT_I32_S:
+    case OPCode::F64_CONVERT_I32_U:
+    case OPCode::F64_CONVERT_I64_S:
+    case OPCode::F64_CONVERT_I64_U:
+    case OPCode::F64_PROMOTE_F32:
+    case OPCode::I32_REINTERPRET_F32:
+    case OPCode::I64_REINTERPRET_F64:
+    case OPCode::F32_REINTERPRET_I32:
+    case OPCode::F64_REINTERPRET_I64: {
+      unaryOperator(assembler, stack, static_cast<OPCode>(functionInstructionsCode[i++]), moduleInfo.functionInfos[funcIndex]);
+      break;
+    }
+    case OPCode::SCALAR_EXTEND_OP_CODE: {
+      i++;
+      uint32_t const subOpcode = readULEB128(functionInstructionsCode, i);
+      auto const opcode = static_cast<OPCode>(static_cast<uint32_t>(OPCode::SCALAR_EXTEND_OP_CODE_PREFIX) | subOpcode);
+      if ((subOpcode > 0xFFU) || !isUnaryOperation(opcode)) {
+        std::stringstream ss;
+        ss << "error: unknown op code is 0xFC " << subOpcode;
+        throw std::runtime_error(ss.str());
+      }
+      unaryOperator(assembler, stack, opcode, moduleInfo.functionInfos[funcIndex]);
+      break;
+    }
+    case OPCode::VECTOR_EXTEND_OP_CODE: {
+      i++;
+      uint32_t const subOpcode = readULEB128(functionInstructionsCode, i);
+      if (!isVectorOperation(subOpcode)) {
+        std::stringstream ss;
+        ss << "error: unknown op code is 0xFD " << subOpcode;
+        throw std::runtime_error(ss.str());
+      }
+      auto const opcode = static_cast<OPCode>(static_cast<uint32_t>(OPCode::VECTOR_EXTEND_OP_CODE_PREFIX) | subOpcode);
+      // the immediates come first, the following opcode is only known for the operators without them
+      size_t const next = i + vectorImmediateBytes(opcode);
+      bool const branchFollows = !hasVectorMemoryArgument(opcode) && (next < functionInstructionsCode.size()) &&
+                                 ((static_cast<OPCode>(functionInstructionsCode[next]) == OPCode::IF) ||
+                                  (static_cast<OPCode>(functionInstructionsCode[next]) == OPCode::BR_IF));
+      vectorOperator(assembler, stack, functionInstructionsCode, i, opcode, moduleInfo, moduleInfo.functionInfos[funcIndex], branchFollows);
+      break;
+    }
+    case OPCode::RETURN: {
+      i++;
+      if (stack.empty()) {
+        LOG_TRACE("stack is empty, RETURN opcode do nothing");
       }
-      auto returnType = moduleInfo.getReturnTypeForSignature(moduleInfo.functionInfos[funcIndex].typeIndex);
-
-      assembler.UDIV(true, moduleInfo.functionsLocalVars[funcIndex][left.variableData.location.localIdx].reg,
-                     moduleInfo.functionsLocalVars[funcIndex][right.variableData.location.localIdx].reg);
-
-      StackElement stackElement;
-      stackElement.type = StackType::LOCAL;
-
-      StackElement::VariableData data;
-      stackElement.variableData.location.localIdx = left.variableData.location.localIdx;
-      stackElement.variableData.location.reg = moduleInfo.functionsLocalVars[funcIndex][left.variableData.location.localIdx].reg;
-      stack.push(stackElement);
+      emitBranchTo(assembler, stack, nullptr, moduleInfo.functionInfos[funcIndex]);
+      endReachableCode(controlFrames, stack, i, functionInstructionsCode.size());
       break;
     }
-    case OPCode::I32_DIV_S: {
+    case OPCode::CALL: {
       i++;
-      if (stack.size() < 2) {
-        throw std::runtime_error("error: stack size less than 2, parse I32_DIV_S wasm opCode error.");
+      uint32_t const callee = readULEB128(functionInstructionsCode, i);
+      const ModuleInfo::FunctionInfo &functionInfo = moduleInfo.functionInfos[funcIndex];
+      // without liveness (an incomplete walk) every local register is saved
+      uint64_t const callSaveMask =
+          (numCalls < functionInfo.callSaveMasks.size()) ? functionInfo.callSaveMasks[numCalls] : localRegisterMask(functionInfo);
+      numCalls++;
+      emitCall(assembler, stack, callee, callSaveMask, moduleInfo, functionInfo, callSites);
+      break;
+    }
+    case OPCode::I32_LOAD:
+    case OPCode::I64_LOAD:
+    case OPCode::F32_LOAD:
+    case OPCode::F64_LOAD:
+    case OPCode::I32_LOAD8_S:
+    case OPCode::I32_LOAD8_U:
+    case OPCode::I32_LOAD16_S:
+    case OPCode::I32_LOAD16_U:
+    case OPCode::I64_LOAD8_S:
+    case OPCode::I64_LOAD8_U:
+    case OPCode::I64_LOAD16_S:
+    case OPCode::I64_LOAD16_U:
+    case OPCode::I64_LOAD32_S:
+    case OPCode::I64_LOAD32_U: {
+      auto const opcode = static_cast<OPCode>(functionInstructionsCode[i++]);
+      static_cast<void>(readULEB128(functionInstructionsCode, i)); // the alignment is only a hint
+      uint32_t const offset = readULEB128(functionInstructionsCode, i);
+      if (!moduleInfo.hasMemory) {
+        throw std::runtime_error("error: memory access without a linear memory.");
       }
-      StackElement right = stack.top();
-      stack.pop();
-      StackElement left = stack.top();
+      if (stack.empty()) {
+        throw std::runtime_error("error: stack is empty, parse load error.");
+      }
+      MemOp const op = memoryOperation(opcode);
+      bool const is64 = (opcode == OPCode::I64_LOAD) || ((opcode >= OPCode::I64_LOAD8_S) && (opcode <= OPCode::I64_LOAD32_U));
+      WasmType wasmType = is64 ? WasmType::I64 : WasmType::I32;
+      if ((opcode == OPCode::F32_LOAD) || (opcode == OPCode::F64_LOAD)) {
+        wasmType = (opcode == OPCode::F64_LOAD) ? WasmType::F64 : WasmType::F32;
+      }
+      // the value replaces the address in the register of its slot
+      const ModuleInfo::FunctionInfo &functionInfo = moduleInfo.functionInfos[funcIndex];
+      TReg const reg = slotRegister(functionInfo, stack.size() - 1U, wasmType);
+      emitMemoryAccess(assembler, op, reg, stack.top(), offset, operandRegister(functionInfo, stack.size() - 1U));
       stack.pop();
-      if (static_cast<uint32_t>(left.type) != StackType::LOCAL || static_cast<uint32_t>(right.type) != StackType::LOCAL) {
-        throw std::runtime_error("error: stack element type is not LOCAL, parse I32_DIV_S wasm opCode error.");
+      stack.push(scratchRegisterElement(reg, wasmType));
+      break;
+    }
+    case OPCode::I32_STORE:
+    case OPCode::I64_STORE:
+    case OPCode::F32_STORE:
+    case OPCode::F64_STORE:
+    case OPCode::I32_STORE8:
+    case OPCode::I32_STORE16:
+    case OPCode::I64_STORE8:
+    case OPCode::I64_STORE16:
+    case OPCode::I64_STORE32: {
+      auto const opcode = static_cast<OPCode>(functionInstructionsCode[i++]);
+      static_cast<void>(readULEB128(functionInstructionsCode, i));
+      uint32_t const offset = readULEB128(functionInstructionsCode, i);
+      if (!moduleInfo.hasMemory) {
+        throw std::runtime_error("error: memory access without a linear memory.");
+      }
+      if (stack.size() < 2U) {
+        throw std::runtime_error("error: stack underflow, parse store error.");
+      }
+      MemOp op = memoryOperation(opcode);
+      const ModuleInfo::FunctionInfo &functionInfo = moduleInfo.functionInfos[funcIndex];
+      const StackElement &value = stack.top();
+      TReg valueReg = TReg::ZR;
+      if (!isConstant(value) || (constantValue(value) != 0U)) {
+        valueReg = valueRegister(assembler, value, slotRegister(functionInfo, stack.size() - 1U, elementType(value)));
+      } else {
+        // +0.0 is stored from ZR by the integer store of its size, the float ones only differ in the V bit
+        op = static_cast<MemOp>(static_cast<uint32_t>(op) & ~0x04000000U);
       }
-      auto returnType = moduleInfo.getReturnTypeForSignature(moduleInfo.functionInfos[funcIndex].typeIndex);
-      assembler.SDIV(false, moduleInfo.functionsLocalVars[funcIndex][left.variableData.location.localIdx].reg,
-                     moduleInfo.functionsLocalVars[funcIndex][right.variableData.location.localIdx].reg);
-
-      StackElement stackElement;
-      stackElement.type = StackType::LOCAL;
-
-      StackElement::VariableData data;
-      stackElement.variableData.location.localIdx = left.variableData.location.localIdx;
-      stackElement.variableData.location.reg = moduleInfo.functionsLocalVars[funcIndex][left.variableData.location.localIdx].reg;
-      stack.push(stackElement);
+      emitMemoryAccess(assembler, op, valueReg, stack.peek(1U), offset, operandRegister(functionInfo, stack.size() - 2U));
+      stack.pop(2U);
+      break;
+    }
+    case OPCode::MEMORY_SIZE: {
+      i += 2U; // opcode and memory index
+      if (!moduleInfo.hasMemory) {
+        throw std::runtime_error("error: memory.size without a linear memory.");
+      }
+      TReg const reg = operandRegister(moduleInfo.functionInfos[funcIndex], stack.size());
+      assembler.LoadStoreUnscaled(MemOp::LDRW, reg, memoryBaseRegister, LinearMemory::pagesOffset);
+      stack.push(scratchRegisterElement(reg, WasmType::I32));
+      break;
+    }
+    case OPCode::MEMORY_GROW: {
+      i += 2U;
+      if (!moduleInfo.hasMemory) {
+        throw std::runtime_error("error: memory.grow without a linear memory.");
+      }
+      if (stack.empty()) {
+        throw std::runtime_error("error: stack is empty, parse memory.grow error.");
+      }
+      const ModuleInfo::FunctionInfo &functionInfo = moduleInfo.functionInfos[funcIndex];
+      // saves like a call, its mask is the next one
+      uint64_t const callSaveMask =
+          (numCalls < functionInfo.callSaveMasks.size()) ? functionInfo.callSaveMasks[numCalls] : localRegisterMask(functionInfo);
+      numCalls++;
+      emitMemoryGrow(assembler, stack, callSaveMask, functionInfo);
+      break;
+    }
+    case OPCode::BR: {
+      i++;
+      uint32_t const depth = readULEB128(functionInstructionsCode, i);
+      emitBranchTo(assembler, stack, branchTarget(controlFrames, depth), moduleInfo.functionInfos[funcIndex]);
+      endReachableCode(controlFrames, stack, i, functionInstructionsCode.size());
       break;
     }
-    case OPCode::I32_DIV_U: {
+    case OPCode::BR_IF: {
       i++;
-      if (stack.size() < 2) {
-        throw std::runtime_error("error: stack size less than 2, parse I32_DIV_U wasm opCode error.");
+      uint32_t const depth = readULEB128(functionInstructionsCode, i);
+      if (stack.empty()) {
+        throw std::runtime_error("error: stack is empty, parse BR_IF error.");
       }
-      StackElement right = stack.top();
-      stack.pop();
-      StackElement left = stack.top();
+      const ControlFrame *const frame = branchTarget(controlFrames, depth);
+      StackElement const condition = stack.top();
+      TReg const scratch = operandRegister(moduleInfo.functionInfos[funcIndex], stack.size() - 1U);
       stack.pop();
-      if (static_cast<uint32_t>(left.type) != StackType::LOCAL || static_cast<uint32_t>(right.type) != StackType::LOCAL) {
-        throw std::runtime_error("error: stack element type is not LOCAL, parse I32_DIV_U wasm opCode error.");
+      if (!branchCarriesValue(frame, stack) && (frame != nullptr)) {
+        emitConditionalBranch(assembler, condition, true, (frame->opcode == OPCode::LOOP) ? frame->loopLabel : frame->endLabel, scratch);
+        break;
       }
-      auto returnType = moduleInfo.getReturnTypeForSignature(moduleInfo.functionInfos[funcIndex].typeIndex);
-
-      assembler.UDIV(false, moduleInfo.functionsLocalVars[funcIndex][left.variableData.location.localIdx].reg,
-                     moduleInfo.functionsLocalVars[funcIndex][right.variableData.location.localIdx].reg);
-
-      StackElement stackElement;
-      stackElement.type = StackType::LOCAL;
-
-      StackElement::VariableData data;
-      stackElement.variableData.location.localIdx = left.variableData.location.localIdx;
-      stackElement.variableData.location.reg = moduleInfo.functionsLocalVars[funcIndex][left.variableData.location.localIdx].reg;
-      stack.push(stackElement);
+      // the value (or the epilogue) is only moved on the taken path, the fallthrough keeps it on the operand stack
+      AArch64_Assembler::Label const notTaken = assembler.newLabel();
+      emitConditionalBranch(assembler, condition, false, notTaken, scratch);
+      emitBranchTo(assembler, stack, frame, moduleInfo.functionInfos[funcIndex]);
+      assembler.bind(notTaken);
       break;
     }
-    case OPCode::RETURN: {
-      i = 99999999;
+    case OPCode::BR_TABLE: {
+      i++;
+      uint32_t const numTargets = readULEB128(functionInstructionsCode, i);
+      size_t const firstTarget = i;
+      for (uint32_t j = 0U; j < numTargets; ++j) {
+        static_cast<void>(readULEB128(functionInstructionsCode, i));
+      }
+      uint32_t const defaultDepth = readULEB128(functionInstructionsCode, i);
       if (stack.empty()) {
-        std::cout << "stack is empty, RETURN opcode do nothing" << std::endl;
-      } else {
-        const StackElement &stackElement = stack.top();
-        switch (static_cast<uint32_t>(stackElement.type)) {
-        case StackType::CONSTANT_I32: {
-          auto const constValue = stackElement.data.constUnion.u32;
-          assembler.MOVimm(false, TReg::R0, constValue);
-          break;
+        throw std::runtime_error("error: stack is empty, parse BR_TABLE error.");
+      }
+      const ModuleInfo::FunctionInfo &functionInfo = moduleInfo.functionInfos[funcIndex];
+      StackElement const index = stack.top();
+      stack.pop();
+      // every target takes the same values, so they all carry the value or none does
+      bool const carriesValue = branchCarriesValue(branchTarget(controlFrames, defaultDepth), stack);
+      // targets that take a value, and the function body (its epilogue), are reached through a stub after the table
+      std::vector<AArch64_Assembler::Label> stubs(controlFrames.size() + 1U);
+      std::vector<bool> stubUsed(controlFrames.size() + 1U, false);
+      auto const targetLabel = [&](uint32_t const depth) {
+        const ControlFrame *const frame = branchTarget(controlFrames, depth);
+        if (carriesValue || (frame == nullptr)) {
+          if (!stubUsed[depth]) {
+            stubs[depth] = assembler.newLabel();
+            stubUsed[depth] = true;
+          }
+          return stubs[depth];
         }
-        case StackType::CONSTANT_I64: {
-          auto const constValue = stackElement.data.constUnion.u64;
-          assembler.MOVimm(true, TReg::R0, constValue);
-          break;
+        return (frame->opcode == OPCode::LOOP) ? frame->loopLabel : frame->endLabel;
+      };
+      if (isConstant(index) || (numTargets == 0U)) {
+        // the target is known at compile time
+        uint32_t const selected = isConstant(index) ? index.data.constUnion.u32 : 0U;
+        size_t entry = firstTarget;
+        uint32_t depth = defaultDepth;
+        for (uint32_t j = 0U; j < numTargets; ++j) {
+          uint32_t const targetDepth = readULEB128(functionInstructionsCode, entry);
+          if (j == selected) {
+            depth = targetDepth;
+          }
         }
-        case StackType::LOCAL: {
-          // to do if local var in stack.
-          bool is64 = stackElement.variableData.location.wasmtype == WasmType::I64; // TO USE RETURN TYPE
-          assembler.MOVRegister(is64, TReg::R0, stackElement.variableData.location.reg);
-          break;
+        emitBranchTo(assembler, stack, branchTarget(controlFrames, depth), functionInfo);
+      } else {
+        TReg const indexReg = valueRegister(assembler, index, operandRegister(functionInfo, stack.size()));
+        if (numTargets <= 0xFFFU) {
+          assembler.CMP(false, indexReg, static_cast<uint16_t>(numTargets));
+        } else {
+          assembler.MOVimm(false, TReg::R26, numTargets);
+          assembler.CMP(false, indexReg, TReg::R26);
         }
-
-        default: {
-          throw std::runtime_error("Error: unknown op code");
+        assembler.Bcon(CC::HS, targetLabel(defaultDepth));
+        // R26 = address of the first entry (3 instructions ahead) + index * 4, every entry is a single B
+        assembler.ADR(TReg::R26, 12);
+        assembler.AddExtendedRegister(TReg::R26, TReg::R26, indexReg, 2U);
+        assembler.BR(TReg::R26);
+        size_t entry = firstTarget;
+        for (uint32_t j = 0U; j < numTargets; ++j) {
+          assembler.B(targetLabel(readULEB128(functionInstructionsCode, entry)));
         }
+      }
+      for (size_t depth = 0U; depth < stubs.size(); ++depth) {
+        if (stubUsed[depth]) {
+          assembler.bind(stubs[depth]);
+          emitBranchTo(assembler, stack, branchTarget(controlFrames, static_cast<uint32_t>(depth)), functionInfo);
         }
-        stack.pop();
       }
-      assembler.Ret();
+      endReachableCode(controlFrames, stack, i, functionInstructionsCode.size());
       break;
     }
     default: {
@@ -1031,28 +3829,80 @@ std::vector<uint8_t> parseOpCode(const std::vector<uint8_t> &functionInstruction
     }
     }
   }
-  return assembler.getInstructions();
+  trapSites = assembler.trapSites();
+  return assembler.releaseInstructions();
 }
 
-void compileOpCode(ModuleInfo &moduleInfo) {
-  std::cout << "Start compile wasm module using ModuleInfo." << std::endl;
+void compileFunction(ModuleInfo &moduleInfo, size_t const i) {
+  auto &singlefunctionLocalVars = moduleInfo.functionsLocalVars[i];
+  std::string &functionSignatureType = moduleInfo.signatureTypes[moduleInfo.functionInfos[i].typeIndex];
+
+  std::vector<ModuleInfo::LocalVar> funcParmLocals = parseFuncSignature(functionSignatureType, moduleInfo.functionInfos[i]);
+  parseFuncLocalVars(singlefunctionLocalVars, moduleInfo.functionInfos[i]);
+  funcParmLocals.insert(funcParmLocals.end(), moduleInfo.functionsLocalVars[i].begin(), moduleInfo.functionsLocalVars[i].end());
+  moduleInfo.functionsLocalVars[i] = std::move(funcParmLocals);
+  allocateRegisters(moduleInfo.functionsInstructions[i], 0U, moduleInfo.functionsLocalVars[i], moduleInfo.functionInfos[i], &moduleInfo);
+  if (moduleInfo.functionInfos[i].numSpilledLocals != 0U) {
+    LOG_INFO("function " << i << ": " << moduleInfo.functionInfos[i].numSpilledLocals << " of " << moduleInfo.functionInfos[i].numLocals
+                         << " locals spilled, stack frame " << moduleInfo.functionInfos[i].stackFrameSize << " bytes");
+  }
 
-  for (int i = 0; i < moduleInfo.functionsInstructions.size(); i++) {
-    auto &singlefunctionLocalVars = moduleInfo.functionsLocalVars[i];
-    std::string &functionSignatureType = moduleInfo.signatureTypes[moduleInfo.functionInfos[i].typeIndex];
+  std::vector<ModuleInfo::CallSite> callSites;
+  std::vector<ModuleInfo::TrapSite> trapSites;
+  auto funcMachineCodes = parseOpCode(moduleInfo.functionsInstructions[i], 0, i, moduleInfo, callSites, trapSites);
+
+  if (funcMachineCodes.empty()) {
+    std::stringstream ss;
+    ss << "Parse wasm func opCode error , got empty arm64 instructions. wasm func index is: " << i;
+    throw std::runtime_error(ss.str());
+  }
+  if (moduleInfo.machineCodes.size() <= i) {
+    moduleInfo.machineCodes.resize(i + 1U);
+  }
+  if (moduleInfo.callSites.size() <= i) {
+    moduleInfo.callSites.resize(i + 1U);
+  }
+  if (moduleInfo.trapSites.size() <= i) {
+    moduleInfo.trapSites.resize(i + 1U);
+  }
+  moduleInfo.machineCodes[i] = std::move(funcMachineCodes);
+  moduleInfo.callSites[i] = std::move(callSites);
+  moduleInfo.trapSites[i] = std::move(trapSites);
+}
 
-    std::vector<ModuleInfo::LocalVar> funcParmLocals = parseFuncSignature(functionSignatureType, moduleInfo.functionInfos[i]);
-    parseFuncLocalVars(singlefunctionLocalVars, moduleInfo.functionInfos[i]);
-    funcParmLocals.insert(funcParmLocals.end(), moduleInfo.functionsLocalVars[i].begin(), moduleInfo.functionsLocalVars[i].end());
-    moduleInfo.functionsLocalVars[i] = std::move(funcParmLocals);
+void compileOpCode(ModuleInfo &moduleInfo) {
+  compileOpCode(moduleInfo, 1U);
+}
 
-    auto funcMachineCodes = parseOpCode(moduleInfo.functionsInstructions[i], 0, i, moduleInfo);
+void compileOpCode(ModuleInfo &moduleInfo, uint32_t const numThreads) {
+  LOG_INFO("Start compile wasm module using ModuleInfo.");
+
+  // every slot is written by exactly one task, so the result does not depend on the scheduling
+  moduleInfo.machineCodes.resize(moduleInfo.functionsInstructions.size());
+  moduleInfo.callSites.resize(moduleInfo.functionsInstructions.size());
+  moduleInfo.trapSites.resize(moduleInfo.functionsInstructions.size());
+  std::vector<size_t> pendingFunctions;
+  for (size_t i = 0; i < moduleInfo.functionsInstructions.size(); i++) {
+    if (moduleInfo.machineCodes[i].empty()) { // already compiled while streaming
+      pendingFunctions.push_back(i);
+    }
+  }
 
-    if (funcMachineCodes.empty()) {
-      std::stringstream ss;
-      ss << "Parse wasm func opCode error , got empty arm64 instructions. wasm func index is: " << i;
-      throw std::runtime_error(ss.str());
+  if ((numThreads == 1U) || (pendingFunctions.size() < 2U)) {
+    for (size_t const funcIndex : pendingFunctions) {
+      compileFunction(moduleInfo, funcIndex);
     }
-    moduleInfo.machineCodes.emplace_back(funcMachineCodes);
+  } else {
+    // largest bodies first so no worker picks up a huge function at the very end
+    std::stable_sort(pendingFunctions.begin(), pendingFunctions.end(), [&moduleInfo](size_t const lhs, size_t const rhs) {
+      return moduleInfo.functionsInstructions[lhs].size() > moduleInfo.functionsInstructions[rhs].size();
+    });
+    WorkStealingPool pool(numThreads);
+    LOG_INFO("compile " << pendingFunctions.size() << " functions on " << pool.numThreads() << " threads");
+    pool.run(pendingFunctions, [&moduleInfo](size_t const funcIndex) {
+      compileFunction(moduleInfo, funcIndex);
+    });
   }
+
+  moduleInfo.codeArena = std::make_shared<CodeArena>(moduleInfo.machineCodes, moduleInfo.callSites, moduleInfo.trapSites);
 }
\ No newline at end of file
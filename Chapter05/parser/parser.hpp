@@ -4,10 +4,10 @@
 #include <cstdint>
 #include <vector>
 
+#include "ByteSpan.hpp"
+#include "LEB128.hpp"
 #include "ModuleInfo.hpp"
 
-uint32_t readULEB128(const std::vector<uint8_t> &data, size_t &index);
-
 enum class WASMSectionType : uint8_t {
   CUSTOM = 0,
   TYPE = 1,
@@ -20,15 +20,37 @@ enum class WASMSectionType : uint8_t {
   START = 8,
   ELEM = 9,
   CODE = 10,
-  DATA = 11
+  DATA = 11,
+  DATA_COUNT = 12
 };
 
-void parseTypeSection(const std::vector<uint8_t> &byteStream, size_t &index, ModuleInfo &moduleInfo);
+void parseTypeSection(const ByteSpan &byteStream, size_t &index, ModuleInfo &moduleInfo);
+
+///
+/// @brief Parse the local declarations of one function body and record a view of its instructions
+/// @param index Position right after the body size, advanced past the body
+void parseFunctionBody(const ByteSpan &byteStream, size_t &index, uint32_t functionBodySize, ModuleInfo &moduleInfo);
+
+///
+/// @brief Parse (or skip) one section
+/// @param index Position of the section size (right after the section id), advanced past the section
+void parseSection(WASMSectionType sectionType, const ByteSpan &byteStream, size_t &index, ModuleInfo &moduleInfo);
 
 std::vector<uint8_t> readFileToByteStream(const std::string &filePath);
 
 ModuleInfo processWasmFile(const char *filePath);
 
+///
+/// @brief Compile a single function, its signature, locals and instructions have to be parsed already
+void compileFunction(ModuleInfo &moduleInfo, size_t funcIndex);
+
+///
+/// @brief Compile every function that has not been compiled yet and place all of them in moduleInfo.codeArena
 void compileOpCode(ModuleInfo &moduleInfo);
 
+///
+/// @brief Compile every function that has not been compiled yet on a work-stealing thread pool, then build moduleInfo.codeArena
+/// @param numThreads Number of compile threads, 0 uses all hardware threads. The output is identical to the serial compile.
+void compileOpCode(ModuleInfo &moduleInfo, uint32_t numThreads);
+
 #endif // WASM_PARSER_HPP
\ No newline at end of file
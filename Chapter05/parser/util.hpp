@@ -1,3 +1,6 @@
+#ifndef UTIL_HPP
+#define UTIL_HPP
+
 #include <cstdint>
 #include <cstring>
 #include <type_traits>
@@ -46,4 +49,6 @@ union ConstUnion {
   inline uint64_t rawF64() const {
     return bit_cast<uint64_t>(f64);
   }
-};
\ No newline at end of file
+};
+
+#endif
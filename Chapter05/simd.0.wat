@@ -0,0 +1,7675 @@
+(module
+  (type (;0;) (func (param i64 i64 i64 i64 i32) (result i64)))
+  (type (;1;) (func (param i32 i32) (result i64)))
+  (type (;2;) (func (param i64 i32) (result i64)))
+  (type (;3;) (func (param i64 i64) (result i32)))
+  (type (;4;) (func (param i64 i64 i32 i32) (result i64)))
+  (type (;5;) (func (param i64 i64) (result i64)))
+  (type (;6;) (func (param i64 i64 i64 i32) (result i64)))
+  (type (;7;) (func (param i64 i64 i32) (result i64)))
+  (type (;8;) (func (param i64 i64 i64 i64 i64 i64 i32) (result i64)))
+  (type (;9;) (func (param i32) (result i64)))
+  (type (;10;) (func (param i32 i64 i64 i32) (result i64)))
+  (type (;11;) (func (param i32 i64 i64) (result i64)))
+  (type (;12;) (func (param i32 i32 i32) (result i64)))
+  (type (;13;) (func (param v128 v128) (result v128)))
+  (type (;14;) (func (param f64 v128 i32 v128 f32) (result v128)))
+  (type (;15;) (func (param i64 i64 i32) (result v128)))
+  (type (;16;) (func (result i32)))
+  (type (;17;) (func (param i32) (result i32)))
+  (type (;18;) (func (param i32 i32) (result i32)))
+  (func (;0;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i8x16.swizzle
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;1;) (type 1) (param i32 i32) (result i64)
+    (local v128)
+    local.get 0
+    i8x16.splat
+    local.set 2
+    local.get 1
+    if (result i64)  ;; label = @1
+      local.get 2
+      i64x2.extract_lane 1
+    else
+      local.get 2
+      i64x2.extract_lane 0
+    end)
+  (func (;2;) (type 1) (param i32 i32) (result i64)
+    (local v128)
+    local.get 0
+    i16x8.splat
+    local.set 2
+    local.get 1
+    if (result i64)  ;; label = @1
+      local.get 2
+      i64x2.extract_lane 1
+    else
+      local.get 2
+      i64x2.extract_lane 0
+    end)
+  (func (;3;) (type 1) (param i32 i32) (result i64)
+    (local v128)
+    local.get 0
+    i32x4.splat
+    local.set 2
+    local.get 1
+    if (result i64)  ;; label = @1
+      local.get 2
+      i64x2.extract_lane 1
+    else
+      local.get 2
+      i64x2.extract_lane 0
+    end)
+  (func (;4;) (type 2) (param i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.set 2
+    local.get 1
+    if (result i64)  ;; label = @1
+      local.get 2
+      i64x2.extract_lane 1
+    else
+      local.get 2
+      i64x2.extract_lane 0
+    end)
+  (func (;5;) (type 1) (param i32 i32) (result i64)
+    (local v128)
+    local.get 0
+    f32.reinterpret_i32
+    f32x4.splat
+    local.set 2
+    local.get 1
+    if (result i64)  ;; label = @1
+      local.get 2
+      i64x2.extract_lane 1
+    else
+      local.get 2
+      i64x2.extract_lane 0
+    end)
+  (func (;6;) (type 2) (param i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    f64.reinterpret_i64
+    f64x2.splat
+    local.set 2
+    local.get 1
+    if (result i64)  ;; label = @1
+      local.get 2
+      i64x2.extract_lane 1
+    else
+      local.get 2
+      i64x2.extract_lane 0
+    end)
+  (func (;7;) (type 3) (param i64 i64) (result i32)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i8x16.extract_lane_s 0)
+  (func (;8;) (type 3) (param i64 i64) (result i32)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i8x16.extract_lane_s 1)
+  (func (;9;) (type 3) (param i64 i64) (result i32)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i8x16.extract_lane_s 9)
+  (func (;10;) (type 3) (param i64 i64) (result i32)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i8x16.extract_lane_s 15)
+  (func (;11;) (type 3) (param i64 i64) (result i32)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i8x16.extract_lane_u 0)
+  (func (;12;) (type 3) (param i64 i64) (result i32)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i8x16.extract_lane_u 1)
+  (func (;13;) (type 3) (param i64 i64) (result i32)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i8x16.extract_lane_u 9)
+  (func (;14;) (type 3) (param i64 i64) (result i32)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i8x16.extract_lane_u 15)
+  (func (;15;) (type 4) (param i64 i64 i32 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i8x16.replace_lane 0
+    local.set 4
+    local.get 3
+    if (result i64)  ;; label = @1
+      local.get 4
+      i64x2.extract_lane 1
+    else
+      local.get 4
+      i64x2.extract_lane 0
+    end)
+  (func (;16;) (type 4) (param i64 i64 i32 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i8x16.replace_lane 8
+    local.set 4
+    local.get 3
+    if (result i64)  ;; label = @1
+      local.get 4
+      i64x2.extract_lane 1
+    else
+      local.get 4
+      i64x2.extract_lane 0
+    end)
+  (func (;17;) (type 4) (param i64 i64 i32 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i8x16.replace_lane 15
+    local.set 4
+    local.get 3
+    if (result i64)  ;; label = @1
+      local.get 4
+      i64x2.extract_lane 1
+    else
+      local.get 4
+      i64x2.extract_lane 0
+    end)
+  (func (;18;) (type 3) (param i64 i64) (result i32)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i16x8.extract_lane_s 0)
+  (func (;19;) (type 3) (param i64 i64) (result i32)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i16x8.extract_lane_s 1)
+  (func (;20;) (type 3) (param i64 i64) (result i32)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i16x8.extract_lane_s 5)
+  (func (;21;) (type 3) (param i64 i64) (result i32)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i16x8.extract_lane_s 7)
+  (func (;22;) (type 3) (param i64 i64) (result i32)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i16x8.extract_lane_u 0)
+  (func (;23;) (type 3) (param i64 i64) (result i32)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i16x8.extract_lane_u 1)
+  (func (;24;) (type 3) (param i64 i64) (result i32)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i16x8.extract_lane_u 5)
+  (func (;25;) (type 3) (param i64 i64) (result i32)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i16x8.extract_lane_u 7)
+  (func (;26;) (type 4) (param i64 i64 i32 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i16x8.replace_lane 0
+    local.set 4
+    local.get 3
+    if (result i64)  ;; label = @1
+      local.get 4
+      i64x2.extract_lane 1
+    else
+      local.get 4
+      i64x2.extract_lane 0
+    end)
+  (func (;27;) (type 4) (param i64 i64 i32 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i16x8.replace_lane 4
+    local.set 4
+    local.get 3
+    if (result i64)  ;; label = @1
+      local.get 4
+      i64x2.extract_lane 1
+    else
+      local.get 4
+      i64x2.extract_lane 0
+    end)
+  (func (;28;) (type 4) (param i64 i64 i32 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i16x8.replace_lane 7
+    local.set 4
+    local.get 3
+    if (result i64)  ;; label = @1
+      local.get 4
+      i64x2.extract_lane 1
+    else
+      local.get 4
+      i64x2.extract_lane 0
+    end)
+  (func (;29;) (type 3) (param i64 i64) (result i32)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32x4.extract_lane 0)
+  (func (;30;) (type 3) (param i64 i64) (result i32)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32x4.extract_lane 1)
+  (func (;31;) (type 3) (param i64 i64) (result i32)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32x4.extract_lane 3)
+  (func (;32;) (type 4) (param i64 i64 i32 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i32x4.replace_lane 0
+    local.set 4
+    local.get 3
+    if (result i64)  ;; label = @1
+      local.get 4
+      i64x2.extract_lane 1
+    else
+      local.get 4
+      i64x2.extract_lane 0
+    end)
+  (func (;33;) (type 4) (param i64 i64 i32 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i32x4.replace_lane 2
+    local.set 4
+    local.get 3
+    if (result i64)  ;; label = @1
+      local.get 4
+      i64x2.extract_lane 1
+    else
+      local.get 4
+      i64x2.extract_lane 0
+    end)
+  (func (;34;) (type 4) (param i64 i64 i32 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i32x4.replace_lane 3
+    local.set 4
+    local.get 3
+    if (result i64)  ;; label = @1
+      local.get 4
+      i64x2.extract_lane 1
+    else
+      local.get 4
+      i64x2.extract_lane 0
+    end)
+  (func (;35;) (type 5) (param i64 i64) (result i64)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i64x2.extract_lane 0)
+  (func (;36;) (type 5) (param i64 i64) (result i64)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i64x2.extract_lane 1)
+  (func (;37;) (type 6) (param i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.replace_lane 0
+    local.set 4
+    local.get 3
+    if (result i64)  ;; label = @1
+      local.get 4
+      i64x2.extract_lane 1
+    else
+      local.get 4
+      i64x2.extract_lane 0
+    end)
+  (func (;38;) (type 6) (param i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.replace_lane 1
+    local.set 4
+    local.get 3
+    if (result i64)  ;; label = @1
+      local.get 4
+      i64x2.extract_lane 1
+    else
+      local.get 4
+      i64x2.extract_lane 0
+    end)
+  (func (;39;) (type 3) (param i64 i64) (result i32)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    f32x4.extract_lane 0
+    i32.reinterpret_f32)
+  (func (;40;) (type 3) (param i64 i64) (result i32)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    f32x4.extract_lane 1
+    i32.reinterpret_f32)
+  (func (;41;) (type 3) (param i64 i64) (result i32)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    f32x4.extract_lane 3
+    i32.reinterpret_f32)
+  (func (;42;) (type 4) (param i64 i64 i32 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    f32.reinterpret_i32
+    f32x4.replace_lane 0
+    local.set 4
+    local.get 3
+    if (result i64)  ;; label = @1
+      local.get 4
+      i64x2.extract_lane 1
+    else
+      local.get 4
+      i64x2.extract_lane 0
+    end)
+  (func (;43;) (type 4) (param i64 i64 i32 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    f32.reinterpret_i32
+    f32x4.replace_lane 2
+    local.set 4
+    local.get 3
+    if (result i64)  ;; label = @1
+      local.get 4
+      i64x2.extract_lane 1
+    else
+      local.get 4
+      i64x2.extract_lane 0
+    end)
+  (func (;44;) (type 4) (param i64 i64 i32 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    f32.reinterpret_i32
+    f32x4.replace_lane 3
+    local.set 4
+    local.get 3
+    if (result i64)  ;; label = @1
+      local.get 4
+      i64x2.extract_lane 1
+    else
+      local.get 4
+      i64x2.extract_lane 0
+    end)
+  (func (;45;) (type 5) (param i64 i64) (result i64)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    f64x2.extract_lane 0
+    i64.reinterpret_f64)
+  (func (;46;) (type 5) (param i64 i64) (result i64)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    f64x2.extract_lane 1
+    i64.reinterpret_f64)
+  (func (;47;) (type 6) (param i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    f64.reinterpret_i64
+    f64x2.replace_lane 0
+    local.set 4
+    local.get 3
+    if (result i64)  ;; label = @1
+      local.get 4
+      i64x2.extract_lane 1
+    else
+      local.get 4
+      i64x2.extract_lane 0
+    end)
+  (func (;48;) (type 6) (param i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    f64.reinterpret_i64
+    f64x2.replace_lane 1
+    local.set 4
+    local.get 3
+    if (result i64)  ;; label = @1
+      local.get 4
+      i64x2.extract_lane 1
+    else
+      local.get 4
+      i64x2.extract_lane 0
+    end)
+  (func (;49;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i8x16.eq
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;50;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i8x16.ne
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;51;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i8x16.lt_s
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;52;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i8x16.lt_u
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;53;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i8x16.gt_s
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;54;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i8x16.gt_u
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;55;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i8x16.le_s
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;56;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i8x16.le_u
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;57;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i8x16.ge_s
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;58;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i8x16.ge_u
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;59;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i16x8.eq
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;60;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i16x8.ne
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;61;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i16x8.lt_s
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;62;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i16x8.lt_u
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;63;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i16x8.gt_s
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;64;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i16x8.gt_u
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;65;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i16x8.le_s
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;66;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i16x8.le_u
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;67;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i16x8.ge_s
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;68;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i16x8.ge_u
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;69;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i32x4.eq
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;70;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i32x4.ne
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;71;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i32x4.lt_s
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;72;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i32x4.lt_u
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;73;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i32x4.gt_s
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;74;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i32x4.gt_u
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;75;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i32x4.le_s
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;76;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i32x4.le_u
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;77;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i32x4.ge_s
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;78;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i32x4.ge_u
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;79;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    f32x4.eq
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;80;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    f32x4.ne
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;81;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    f32x4.lt
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;82;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    f32x4.gt
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;83;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    f32x4.le
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;84;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    f32x4.ge
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;85;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    f64x2.eq
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;86;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    f64x2.ne
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;87;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    f64x2.lt
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;88;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    f64x2.gt
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;89;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    f64x2.le
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;90;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    f64x2.ge
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;91;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    v128.not
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;92;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    v128.and
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;93;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    v128.andnot
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;94;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    v128.or
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;95;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    v128.xor
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;96;) (type 8) (param i64 i64 i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    local.get 4
+    i64x2.splat
+    local.get 5
+    i64x2.replace_lane 1
+    v128.bitselect
+    local.set 7
+    local.get 6
+    if (result i64)  ;; label = @1
+      local.get 7
+      i64x2.extract_lane 1
+    else
+      local.get 7
+      i64x2.extract_lane 0
+    end)
+  (func (;97;) (type 3) (param i64 i64) (result i32)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    v128.any_true)
+  (func (;98;) (type 3) (param i64 i64) (result i32)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    v128.any_true
+    if (result i32)  ;; label = @1
+      i32.const 10
+    else
+      i32.const 20
+    end)
+  (func (;99;) (type 3) (param i64 i64) (result i32)
+    block (result i32)  ;; label = @1
+      i32.const 30
+      local.get 0
+      i64x2.splat
+      local.get 1
+      i64x2.replace_lane 1
+      v128.any_true
+      br_if 0
+      drop
+      i32.const 40
+    end)
+  (func (;100;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    f32x4.demote_f64x2_zero
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;101;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    f64x2.promote_low_f32x4
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;102;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i8x16.abs
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;103;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i8x16.neg
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;104;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i8x16.popcnt
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;105;) (type 3) (param i64 i64) (result i32)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i8x16.all_true)
+  (func (;106;) (type 3) (param i64 i64) (result i32)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i8x16.all_true
+    if (result i32)  ;; label = @1
+      i32.const 10
+    else
+      i32.const 20
+    end)
+  (func (;107;) (type 3) (param i64 i64) (result i32)
+    block (result i32)  ;; label = @1
+      i32.const 30
+      local.get 0
+      i64x2.splat
+      local.get 1
+      i64x2.replace_lane 1
+      i8x16.all_true
+      br_if 0
+      drop
+      i32.const 40
+    end)
+  (func (;108;) (type 3) (param i64 i64) (result i32)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i8x16.bitmask)
+  (func (;109;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i8x16.narrow_i16x8_s
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;110;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i8x16.narrow_i16x8_u
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;111;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    f32x4.ceil
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;112;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    f32x4.floor
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;113;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    f32x4.trunc
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;114;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    f32x4.nearest
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;115;) (type 4) (param i64 i64 i32 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i8x16.shl
+    local.set 4
+    local.get 3
+    if (result i64)  ;; label = @1
+      local.get 4
+      i64x2.extract_lane 1
+    else
+      local.get 4
+      i64x2.extract_lane 0
+    end)
+  (func (;116;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32.const 0
+    i8x16.shl
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;117;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32.const 1
+    i8x16.shl
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;118;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32.const 7
+    i8x16.shl
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;119;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32.const 8
+    i8x16.shl
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;120;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32.const 11
+    i8x16.shl
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;121;) (type 4) (param i64 i64 i32 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i8x16.shr_s
+    local.set 4
+    local.get 3
+    if (result i64)  ;; label = @1
+      local.get 4
+      i64x2.extract_lane 1
+    else
+      local.get 4
+      i64x2.extract_lane 0
+    end)
+  (func (;122;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32.const 0
+    i8x16.shr_s
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;123;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32.const 1
+    i8x16.shr_s
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;124;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32.const 7
+    i8x16.shr_s
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;125;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32.const 8
+    i8x16.shr_s
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;126;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32.const 11
+    i8x16.shr_s
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;127;) (type 4) (param i64 i64 i32 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i8x16.shr_u
+    local.set 4
+    local.get 3
+    if (result i64)  ;; label = @1
+      local.get 4
+      i64x2.extract_lane 1
+    else
+      local.get 4
+      i64x2.extract_lane 0
+    end)
+  (func (;128;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32.const 0
+    i8x16.shr_u
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;129;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32.const 1
+    i8x16.shr_u
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;130;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32.const 7
+    i8x16.shr_u
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;131;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32.const 8
+    i8x16.shr_u
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;132;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32.const 11
+    i8x16.shr_u
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;133;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i8x16.add
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;134;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i8x16.add_sat_s
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;135;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i8x16.add_sat_u
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;136;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i8x16.sub
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;137;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i8x16.sub_sat_s
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;138;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i8x16.sub_sat_u
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;139;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    f64x2.ceil
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;140;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    f64x2.floor
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;141;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i8x16.min_s
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;142;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i8x16.min_u
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;143;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i8x16.max_s
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;144;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i8x16.max_u
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;145;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    f64x2.trunc
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;146;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i8x16.avgr_u
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;147;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i16x8.extadd_pairwise_i8x16_s
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;148;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i16x8.extadd_pairwise_i8x16_u
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;149;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32x4.extadd_pairwise_i16x8_s
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;150;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32x4.extadd_pairwise_i16x8_u
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;151;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i16x8.abs
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;152;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i16x8.neg
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;153;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i16x8.q15mulr_sat_s
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;154;) (type 3) (param i64 i64) (result i32)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i16x8.all_true)
+  (func (;155;) (type 3) (param i64 i64) (result i32)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i16x8.all_true
+    if (result i32)  ;; label = @1
+      i32.const 10
+    else
+      i32.const 20
+    end)
+  (func (;156;) (type 3) (param i64 i64) (result i32)
+    block (result i32)  ;; label = @1
+      i32.const 30
+      local.get 0
+      i64x2.splat
+      local.get 1
+      i64x2.replace_lane 1
+      i16x8.all_true
+      br_if 0
+      drop
+      i32.const 40
+    end)
+  (func (;157;) (type 3) (param i64 i64) (result i32)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i16x8.bitmask)
+  (func (;158;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i16x8.narrow_i32x4_s
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;159;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i16x8.narrow_i32x4_u
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;160;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i16x8.extend_low_i8x16_s
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;161;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i16x8.extend_high_i8x16_s
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;162;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i16x8.extend_low_i8x16_u
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;163;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i16x8.extend_high_i8x16_u
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;164;) (type 4) (param i64 i64 i32 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i16x8.shl
+    local.set 4
+    local.get 3
+    if (result i64)  ;; label = @1
+      local.get 4
+      i64x2.extract_lane 1
+    else
+      local.get 4
+      i64x2.extract_lane 0
+    end)
+  (func (;165;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32.const 0
+    i16x8.shl
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;166;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32.const 1
+    i16x8.shl
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;167;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32.const 15
+    i16x8.shl
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;168;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32.const 16
+    i16x8.shl
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;169;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32.const 19
+    i16x8.shl
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;170;) (type 4) (param i64 i64 i32 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i16x8.shr_s
+    local.set 4
+    local.get 3
+    if (result i64)  ;; label = @1
+      local.get 4
+      i64x2.extract_lane 1
+    else
+      local.get 4
+      i64x2.extract_lane 0
+    end)
+  (func (;171;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32.const 0
+    i16x8.shr_s
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;172;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32.const 1
+    i16x8.shr_s
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;173;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32.const 15
+    i16x8.shr_s
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;174;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32.const 16
+    i16x8.shr_s
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;175;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32.const 19
+    i16x8.shr_s
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;176;) (type 4) (param i64 i64 i32 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i16x8.shr_u
+    local.set 4
+    local.get 3
+    if (result i64)  ;; label = @1
+      local.get 4
+      i64x2.extract_lane 1
+    else
+      local.get 4
+      i64x2.extract_lane 0
+    end)
+  (func (;177;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32.const 0
+    i16x8.shr_u
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;178;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32.const 1
+    i16x8.shr_u
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;179;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32.const 15
+    i16x8.shr_u
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;180;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32.const 16
+    i16x8.shr_u
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;181;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32.const 19
+    i16x8.shr_u
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;182;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i16x8.add
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;183;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i16x8.add_sat_s
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;184;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i16x8.add_sat_u
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;185;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i16x8.sub
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;186;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i16x8.sub_sat_s
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;187;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i16x8.sub_sat_u
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;188;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    f64x2.nearest
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;189;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i16x8.mul
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;190;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i16x8.min_s
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;191;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i16x8.min_u
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;192;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i16x8.max_s
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;193;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i16x8.max_u
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;194;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i16x8.avgr_u
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;195;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i16x8.extmul_low_i8x16_s
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;196;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i16x8.extmul_high_i8x16_s
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;197;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i16x8.extmul_low_i8x16_u
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;198;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i16x8.extmul_high_i8x16_u
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;199;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32x4.abs
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;200;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32x4.neg
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;201;) (type 3) (param i64 i64) (result i32)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32x4.all_true)
+  (func (;202;) (type 3) (param i64 i64) (result i32)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32x4.all_true
+    if (result i32)  ;; label = @1
+      i32.const 10
+    else
+      i32.const 20
+    end)
+  (func (;203;) (type 3) (param i64 i64) (result i32)
+    block (result i32)  ;; label = @1
+      i32.const 30
+      local.get 0
+      i64x2.splat
+      local.get 1
+      i64x2.replace_lane 1
+      i32x4.all_true
+      br_if 0
+      drop
+      i32.const 40
+    end)
+  (func (;204;) (type 3) (param i64 i64) (result i32)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32x4.bitmask)
+  (func (;205;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32x4.extend_low_i16x8_s
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;206;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32x4.extend_high_i16x8_s
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;207;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32x4.extend_low_i16x8_u
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;208;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32x4.extend_high_i16x8_u
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;209;) (type 4) (param i64 i64 i32 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i32x4.shl
+    local.set 4
+    local.get 3
+    if (result i64)  ;; label = @1
+      local.get 4
+      i64x2.extract_lane 1
+    else
+      local.get 4
+      i64x2.extract_lane 0
+    end)
+  (func (;210;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32.const 0
+    i32x4.shl
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;211;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32.const 1
+    i32x4.shl
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;212;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32.const 31
+    i32x4.shl
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;213;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32.const 32
+    i32x4.shl
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;214;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32.const 35
+    i32x4.shl
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;215;) (type 4) (param i64 i64 i32 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i32x4.shr_s
+    local.set 4
+    local.get 3
+    if (result i64)  ;; label = @1
+      local.get 4
+      i64x2.extract_lane 1
+    else
+      local.get 4
+      i64x2.extract_lane 0
+    end)
+  (func (;216;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32.const 0
+    i32x4.shr_s
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;217;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32.const 1
+    i32x4.shr_s
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;218;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32.const 31
+    i32x4.shr_s
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;219;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32.const 32
+    i32x4.shr_s
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;220;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32.const 35
+    i32x4.shr_s
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;221;) (type 4) (param i64 i64 i32 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i32x4.shr_u
+    local.set 4
+    local.get 3
+    if (result i64)  ;; label = @1
+      local.get 4
+      i64x2.extract_lane 1
+    else
+      local.get 4
+      i64x2.extract_lane 0
+    end)
+  (func (;222;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32.const 0
+    i32x4.shr_u
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;223;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32.const 1
+    i32x4.shr_u
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;224;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32.const 31
+    i32x4.shr_u
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;225;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32.const 32
+    i32x4.shr_u
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;226;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32.const 35
+    i32x4.shr_u
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;227;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i32x4.add
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;228;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i32x4.sub
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;229;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i32x4.mul
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;230;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i32x4.min_s
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;231;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i32x4.min_u
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;232;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i32x4.max_s
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;233;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i32x4.max_u
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;234;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i32x4.dot_i16x8_s
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;235;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i32x4.extmul_low_i16x8_s
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;236;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i32x4.extmul_high_i16x8_s
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;237;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i32x4.extmul_low_i16x8_u
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;238;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i32x4.extmul_high_i16x8_u
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;239;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i64x2.abs
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;240;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i64x2.neg
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;241;) (type 3) (param i64 i64) (result i32)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i64x2.all_true)
+  (func (;242;) (type 3) (param i64 i64) (result i32)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i64x2.all_true
+    if (result i32)  ;; label = @1
+      i32.const 10
+    else
+      i32.const 20
+    end)
+  (func (;243;) (type 3) (param i64 i64) (result i32)
+    block (result i32)  ;; label = @1
+      i32.const 30
+      local.get 0
+      i64x2.splat
+      local.get 1
+      i64x2.replace_lane 1
+      i64x2.all_true
+      br_if 0
+      drop
+      i32.const 40
+    end)
+  (func (;244;) (type 3) (param i64 i64) (result i32)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i64x2.bitmask)
+  (func (;245;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i64x2.extend_low_i32x4_s
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;246;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i64x2.extend_high_i32x4_s
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;247;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i64x2.extend_low_i32x4_u
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;248;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i64x2.extend_high_i32x4_u
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;249;) (type 4) (param i64 i64 i32 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.shl
+    local.set 4
+    local.get 3
+    if (result i64)  ;; label = @1
+      local.get 4
+      i64x2.extract_lane 1
+    else
+      local.get 4
+      i64x2.extract_lane 0
+    end)
+  (func (;250;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32.const 0
+    i64x2.shl
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;251;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32.const 1
+    i64x2.shl
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;252;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32.const 63
+    i64x2.shl
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;253;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32.const 64
+    i64x2.shl
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;254;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32.const 67
+    i64x2.shl
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;255;) (type 4) (param i64 i64 i32 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.shr_s
+    local.set 4
+    local.get 3
+    if (result i64)  ;; label = @1
+      local.get 4
+      i64x2.extract_lane 1
+    else
+      local.get 4
+      i64x2.extract_lane 0
+    end)
+  (func (;256;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32.const 0
+    i64x2.shr_s
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;257;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32.const 1
+    i64x2.shr_s
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;258;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32.const 63
+    i64x2.shr_s
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;259;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32.const 64
+    i64x2.shr_s
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;260;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32.const 67
+    i64x2.shr_s
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;261;) (type 4) (param i64 i64 i32 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.shr_u
+    local.set 4
+    local.get 3
+    if (result i64)  ;; label = @1
+      local.get 4
+      i64x2.extract_lane 1
+    else
+      local.get 4
+      i64x2.extract_lane 0
+    end)
+  (func (;262;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32.const 0
+    i64x2.shr_u
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;263;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32.const 1
+    i64x2.shr_u
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;264;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32.const 63
+    i64x2.shr_u
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;265;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32.const 64
+    i64x2.shr_u
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;266;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32.const 67
+    i64x2.shr_u
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;267;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i64x2.add
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;268;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i64x2.sub
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;269;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i64x2.mul
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;270;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i64x2.eq
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;271;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i64x2.ne
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;272;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i64x2.lt_s
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;273;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i64x2.gt_s
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;274;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i64x2.le_s
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;275;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i64x2.ge_s
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;276;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i64x2.extmul_low_i32x4_s
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;277;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i64x2.extmul_high_i32x4_s
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;278;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i64x2.extmul_low_i32x4_u
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;279;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i64x2.extmul_high_i32x4_u
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;280;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    f32x4.abs
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;281;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    f32x4.neg
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;282;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    f32x4.sqrt
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;283;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    f32x4.add
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;284;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    f32x4.sub
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;285;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    f32x4.mul
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;286;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    f32x4.div
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;287;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    f32x4.min
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;288;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    f32x4.max
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;289;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    f32x4.pmin
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;290;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    f32x4.pmax
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;291;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    f64x2.abs
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;292;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    f64x2.neg
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;293;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    f64x2.sqrt
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;294;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    f64x2.add
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;295;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    f64x2.sub
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;296;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    f64x2.mul
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;297;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    f64x2.div
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;298;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    f64x2.min
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;299;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    f64x2.max
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;300;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    f64x2.pmin
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;301;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    f64x2.pmax
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;302;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32x4.trunc_sat_f32x4_s
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;303;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32x4.trunc_sat_f32x4_u
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;304;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    f32x4.convert_i32x4_s
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;305;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    f32x4.convert_i32x4_u
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;306;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32x4.trunc_sat_f64x2_s_zero
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;307;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    i32x4.trunc_sat_f64x2_u_zero
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;308;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    f64x2.convert_low_i32x4_s
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;309;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    f64x2.convert_low_i32x4_u
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;310;) (type 9) (param i32) (result i64)
+    (local v128)
+    v128.const i64x2 0x0000000000000000 0x0000000000000000
+    local.set 1
+    local.get 0
+    if (result i64)  ;; label = @1
+      local.get 1
+      i64x2.extract_lane 1
+    else
+      local.get 1
+      i64x2.extract_lane 0
+    end)
+  (func (;311;) (type 9) (param i32) (result i64)
+    (local v128)
+    v128.const i64x2 0x0102030405060708 0x0102030405060708
+    local.set 1
+    local.get 0
+    if (result i64)  ;; label = @1
+      local.get 1
+      i64x2.extract_lane 1
+    else
+      local.get 1
+      i64x2.extract_lane 0
+    end)
+  (func (;312;) (type 9) (param i32) (result i64)
+    (local v128)
+    v128.const i64x2 0xffffffffffffffff 0x0000000000000000
+    local.set 1
+    local.get 0
+    if (result i64)  ;; label = @1
+      local.get 1
+      i64x2.extract_lane 1
+    else
+      local.get 1
+      i64x2.extract_lane 0
+    end)
+  (func (;313;) (type 9) (param i32) (result i64)
+    (local v128)
+    v128.const i64x2 0x123456789abcdef0 0x0fedcba987654321
+    local.set 1
+    local.get 0
+    if (result i64)  ;; label = @1
+      local.get 1
+      i64x2.extract_lane 1
+    else
+      local.get 1
+      i64x2.extract_lane 0
+    end)
+  (func (;314;) (type 9) (param i32) (result i64)
+    (local v128)
+    v128.const i64x2 0x0000000000000000 0x8000000000000000
+    local.set 1
+    local.get 0
+    if (result i64)  ;; label = @1
+      local.get 1
+      i64x2.extract_lane 1
+    else
+      local.get 1
+      i64x2.extract_lane 0
+    end)
+  (func (;315;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i8x16.shuffle 31 29 27 25 23 21 19 17 15 13 11 9 7 5 3 1
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;316;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i8x16.shuffle 0 16 1 17 2 18 3 19 4 20 5 21 6 22 7 23
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;317;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i8x16.shuffle 0 1 2 3 4 5 6 7 8 9 10 11 12 13 14 15
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;318;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i8x16.shuffle 16 17 18 19 20 21 22 23 24 25 26 27 28 29 30 31
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;319;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    i8x16.shuffle 5 5 5 5 5 5 5 5 5 5 5 5 5 5 5 5
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;320;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.tee 3
+    local.get 3
+    i32x4.mul
+    local.get 3
+    i32x4.sub
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;321;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.set 3
+    local.get 3
+    i32.const 0
+    i32x4.splat
+    i32x4.add
+    local.get 3
+    i32.const 1
+    i32x4.splat
+    i32x4.add
+    local.get 3
+    i32.const 2
+    i32x4.splat
+    i32x4.add
+    local.get 3
+    i32.const 3
+    i32x4.splat
+    i32x4.add
+    local.get 3
+    i32.const 4
+    i32x4.splat
+    i32x4.add
+    local.get 3
+    i32.const 5
+    i32x4.splat
+    i32x4.add
+    local.get 3
+    i32.const 6
+    i32x4.splat
+    i32x4.add
+    local.get 3
+    i32.const 7
+    i32x4.splat
+    i32x4.add
+    local.get 3
+    i32.const 8
+    i32x4.splat
+    i32x4.add
+    local.get 3
+    i32.const 9
+    i32x4.splat
+    i32x4.add
+    local.get 3
+    i32.const 10
+    i32x4.splat
+    i32x4.add
+    local.get 3
+    i32.const 11
+    i32x4.splat
+    i32x4.add
+    i32x4.mul
+    i32x4.mul
+    i32x4.mul
+    i32x4.mul
+    i32x4.mul
+    i32x4.mul
+    i32x4.mul
+    i32x4.mul
+    i32x4.mul
+    i32x4.mul
+    i32x4.mul
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;322;) (type 1) (param i32 i32) (result i64)
+    (local v128)
+    local.get 0
+    v128.load
+    local.set 2
+    local.get 1
+    if (result i64)  ;; label = @1
+      local.get 2
+      i64x2.extract_lane 1
+    else
+      local.get 2
+      i64x2.extract_lane 0
+    end)
+  (func (;323;) (type 1) (param i32 i32) (result i64)
+    (local v128)
+    local.get 0
+    v128.load offset=3
+    local.set 2
+    local.get 1
+    if (result i64)  ;; label = @1
+      local.get 2
+      i64x2.extract_lane 1
+    else
+      local.get 2
+      i64x2.extract_lane 0
+    end)
+  (func (;324;) (type 1) (param i32 i32) (result i64)
+    (local v128)
+    local.get 0
+    v128.load offset=4096
+    local.set 2
+    local.get 1
+    if (result i64)  ;; label = @1
+      local.get 2
+      i64x2.extract_lane 1
+    else
+      local.get 2
+      i64x2.extract_lane 0
+    end)
+  (func (;325;) (type 9) (param i32) (result i64)
+    (local v128)
+    i32.const 17
+    v128.load offset=2
+    local.set 1
+    local.get 0
+    if (result i64)  ;; label = @1
+      local.get 1
+      i64x2.extract_lane 1
+    else
+      local.get 1
+      i64x2.extract_lane 0
+    end)
+  (func (;326;) (type 1) (param i32 i32) (result i64)
+    (local v128)
+    local.get 0
+    v128.load8x8_s
+    local.set 2
+    local.get 1
+    if (result i64)  ;; label = @1
+      local.get 2
+      i64x2.extract_lane 1
+    else
+      local.get 2
+      i64x2.extract_lane 0
+    end)
+  (func (;327;) (type 1) (param i32 i32) (result i64)
+    (local v128)
+    local.get 0
+    v128.load8x8_s offset=3
+    local.set 2
+    local.get 1
+    if (result i64)  ;; label = @1
+      local.get 2
+      i64x2.extract_lane 1
+    else
+      local.get 2
+      i64x2.extract_lane 0
+    end)
+  (func (;328;) (type 1) (param i32 i32) (result i64)
+    (local v128)
+    local.get 0
+    v128.load8x8_s offset=4096
+    local.set 2
+    local.get 1
+    if (result i64)  ;; label = @1
+      local.get 2
+      i64x2.extract_lane 1
+    else
+      local.get 2
+      i64x2.extract_lane 0
+    end)
+  (func (;329;) (type 9) (param i32) (result i64)
+    (local v128)
+    i32.const 17
+    v128.load8x8_s offset=2
+    local.set 1
+    local.get 0
+    if (result i64)  ;; label = @1
+      local.get 1
+      i64x2.extract_lane 1
+    else
+      local.get 1
+      i64x2.extract_lane 0
+    end)
+  (func (;330;) (type 1) (param i32 i32) (result i64)
+    (local v128)
+    local.get 0
+    v128.load8x8_u
+    local.set 2
+    local.get 1
+    if (result i64)  ;; label = @1
+      local.get 2
+      i64x2.extract_lane 1
+    else
+      local.get 2
+      i64x2.extract_lane 0
+    end)
+  (func (;331;) (type 1) (param i32 i32) (result i64)
+    (local v128)
+    local.get 0
+    v128.load8x8_u offset=3
+    local.set 2
+    local.get 1
+    if (result i64)  ;; label = @1
+      local.get 2
+      i64x2.extract_lane 1
+    else
+      local.get 2
+      i64x2.extract_lane 0
+    end)
+  (func (;332;) (type 1) (param i32 i32) (result i64)
+    (local v128)
+    local.get 0
+    v128.load8x8_u offset=4096
+    local.set 2
+    local.get 1
+    if (result i64)  ;; label = @1
+      local.get 2
+      i64x2.extract_lane 1
+    else
+      local.get 2
+      i64x2.extract_lane 0
+    end)
+  (func (;333;) (type 9) (param i32) (result i64)
+    (local v128)
+    i32.const 17
+    v128.load8x8_u offset=2
+    local.set 1
+    local.get 0
+    if (result i64)  ;; label = @1
+      local.get 1
+      i64x2.extract_lane 1
+    else
+      local.get 1
+      i64x2.extract_lane 0
+    end)
+  (func (;334;) (type 1) (param i32 i32) (result i64)
+    (local v128)
+    local.get 0
+    v128.load16x4_s
+    local.set 2
+    local.get 1
+    if (result i64)  ;; label = @1
+      local.get 2
+      i64x2.extract_lane 1
+    else
+      local.get 2
+      i64x2.extract_lane 0
+    end)
+  (func (;335;) (type 1) (param i32 i32) (result i64)
+    (local v128)
+    local.get 0
+    v128.load16x4_s offset=3
+    local.set 2
+    local.get 1
+    if (result i64)  ;; label = @1
+      local.get 2
+      i64x2.extract_lane 1
+    else
+      local.get 2
+      i64x2.extract_lane 0
+    end)
+  (func (;336;) (type 1) (param i32 i32) (result i64)
+    (local v128)
+    local.get 0
+    v128.load16x4_s offset=4096
+    local.set 2
+    local.get 1
+    if (result i64)  ;; label = @1
+      local.get 2
+      i64x2.extract_lane 1
+    else
+      local.get 2
+      i64x2.extract_lane 0
+    end)
+  (func (;337;) (type 9) (param i32) (result i64)
+    (local v128)
+    i32.const 17
+    v128.load16x4_s offset=2
+    local.set 1
+    local.get 0
+    if (result i64)  ;; label = @1
+      local.get 1
+      i64x2.extract_lane 1
+    else
+      local.get 1
+      i64x2.extract_lane 0
+    end)
+  (func (;338;) (type 1) (param i32 i32) (result i64)
+    (local v128)
+    local.get 0
+    v128.load16x4_u
+    local.set 2
+    local.get 1
+    if (result i64)  ;; label = @1
+      local.get 2
+      i64x2.extract_lane 1
+    else
+      local.get 2
+      i64x2.extract_lane 0
+    end)
+  (func (;339;) (type 1) (param i32 i32) (result i64)
+    (local v128)
+    local.get 0
+    v128.load16x4_u offset=3
+    local.set 2
+    local.get 1
+    if (result i64)  ;; label = @1
+      local.get 2
+      i64x2.extract_lane 1
+    else
+      local.get 2
+      i64x2.extract_lane 0
+    end)
+  (func (;340;) (type 1) (param i32 i32) (result i64)
+    (local v128)
+    local.get 0
+    v128.load16x4_u offset=4096
+    local.set 2
+    local.get 1
+    if (result i64)  ;; label = @1
+      local.get 2
+      i64x2.extract_lane 1
+    else
+      local.get 2
+      i64x2.extract_lane 0
+    end)
+  (func (;341;) (type 9) (param i32) (result i64)
+    (local v128)
+    i32.const 17
+    v128.load16x4_u offset=2
+    local.set 1
+    local.get 0
+    if (result i64)  ;; label = @1
+      local.get 1
+      i64x2.extract_lane 1
+    else
+      local.get 1
+      i64x2.extract_lane 0
+    end)
+  (func (;342;) (type 1) (param i32 i32) (result i64)
+    (local v128)
+    local.get 0
+    v128.load32x2_s
+    local.set 2
+    local.get 1
+    if (result i64)  ;; label = @1
+      local.get 2
+      i64x2.extract_lane 1
+    else
+      local.get 2
+      i64x2.extract_lane 0
+    end)
+  (func (;343;) (type 1) (param i32 i32) (result i64)
+    (local v128)
+    local.get 0
+    v128.load32x2_s offset=3
+    local.set 2
+    local.get 1
+    if (result i64)  ;; label = @1
+      local.get 2
+      i64x2.extract_lane 1
+    else
+      local.get 2
+      i64x2.extract_lane 0
+    end)
+  (func (;344;) (type 1) (param i32 i32) (result i64)
+    (local v128)
+    local.get 0
+    v128.load32x2_s offset=4096
+    local.set 2
+    local.get 1
+    if (result i64)  ;; label = @1
+      local.get 2
+      i64x2.extract_lane 1
+    else
+      local.get 2
+      i64x2.extract_lane 0
+    end)
+  (func (;345;) (type 9) (param i32) (result i64)
+    (local v128)
+    i32.const 17
+    v128.load32x2_s offset=2
+    local.set 1
+    local.get 0
+    if (result i64)  ;; label = @1
+      local.get 1
+      i64x2.extract_lane 1
+    else
+      local.get 1
+      i64x2.extract_lane 0
+    end)
+  (func (;346;) (type 1) (param i32 i32) (result i64)
+    (local v128)
+    local.get 0
+    v128.load32x2_u
+    local.set 2
+    local.get 1
+    if (result i64)  ;; label = @1
+      local.get 2
+      i64x2.extract_lane 1
+    else
+      local.get 2
+      i64x2.extract_lane 0
+    end)
+  (func (;347;) (type 1) (param i32 i32) (result i64)
+    (local v128)
+    local.get 0
+    v128.load32x2_u offset=3
+    local.set 2
+    local.get 1
+    if (result i64)  ;; label = @1
+      local.get 2
+      i64x2.extract_lane 1
+    else
+      local.get 2
+      i64x2.extract_lane 0
+    end)
+  (func (;348;) (type 1) (param i32 i32) (result i64)
+    (local v128)
+    local.get 0
+    v128.load32x2_u offset=4096
+    local.set 2
+    local.get 1
+    if (result i64)  ;; label = @1
+      local.get 2
+      i64x2.extract_lane 1
+    else
+      local.get 2
+      i64x2.extract_lane 0
+    end)
+  (func (;349;) (type 9) (param i32) (result i64)
+    (local v128)
+    i32.const 17
+    v128.load32x2_u offset=2
+    local.set 1
+    local.get 0
+    if (result i64)  ;; label = @1
+      local.get 1
+      i64x2.extract_lane 1
+    else
+      local.get 1
+      i64x2.extract_lane 0
+    end)
+  (func (;350;) (type 1) (param i32 i32) (result i64)
+    (local v128)
+    local.get 0
+    v128.load8_splat
+    local.set 2
+    local.get 1
+    if (result i64)  ;; label = @1
+      local.get 2
+      i64x2.extract_lane 1
+    else
+      local.get 2
+      i64x2.extract_lane 0
+    end)
+  (func (;351;) (type 1) (param i32 i32) (result i64)
+    (local v128)
+    local.get 0
+    v128.load8_splat offset=3
+    local.set 2
+    local.get 1
+    if (result i64)  ;; label = @1
+      local.get 2
+      i64x2.extract_lane 1
+    else
+      local.get 2
+      i64x2.extract_lane 0
+    end)
+  (func (;352;) (type 1) (param i32 i32) (result i64)
+    (local v128)
+    local.get 0
+    v128.load8_splat offset=4096
+    local.set 2
+    local.get 1
+    if (result i64)  ;; label = @1
+      local.get 2
+      i64x2.extract_lane 1
+    else
+      local.get 2
+      i64x2.extract_lane 0
+    end)
+  (func (;353;) (type 9) (param i32) (result i64)
+    (local v128)
+    i32.const 17
+    v128.load8_splat offset=2
+    local.set 1
+    local.get 0
+    if (result i64)  ;; label = @1
+      local.get 1
+      i64x2.extract_lane 1
+    else
+      local.get 1
+      i64x2.extract_lane 0
+    end)
+  (func (;354;) (type 1) (param i32 i32) (result i64)
+    (local v128)
+    local.get 0
+    v128.load16_splat
+    local.set 2
+    local.get 1
+    if (result i64)  ;; label = @1
+      local.get 2
+      i64x2.extract_lane 1
+    else
+      local.get 2
+      i64x2.extract_lane 0
+    end)
+  (func (;355;) (type 1) (param i32 i32) (result i64)
+    (local v128)
+    local.get 0
+    v128.load16_splat offset=3
+    local.set 2
+    local.get 1
+    if (result i64)  ;; label = @1
+      local.get 2
+      i64x2.extract_lane 1
+    else
+      local.get 2
+      i64x2.extract_lane 0
+    end)
+  (func (;356;) (type 1) (param i32 i32) (result i64)
+    (local v128)
+    local.get 0
+    v128.load16_splat offset=4096
+    local.set 2
+    local.get 1
+    if (result i64)  ;; label = @1
+      local.get 2
+      i64x2.extract_lane 1
+    else
+      local.get 2
+      i64x2.extract_lane 0
+    end)
+  (func (;357;) (type 9) (param i32) (result i64)
+    (local v128)
+    i32.const 17
+    v128.load16_splat offset=2
+    local.set 1
+    local.get 0
+    if (result i64)  ;; label = @1
+      local.get 1
+      i64x2.extract_lane 1
+    else
+      local.get 1
+      i64x2.extract_lane 0
+    end)
+  (func (;358;) (type 1) (param i32 i32) (result i64)
+    (local v128)
+    local.get 0
+    v128.load32_splat
+    local.set 2
+    local.get 1
+    if (result i64)  ;; label = @1
+      local.get 2
+      i64x2.extract_lane 1
+    else
+      local.get 2
+      i64x2.extract_lane 0
+    end)
+  (func (;359;) (type 1) (param i32 i32) (result i64)
+    (local v128)
+    local.get 0
+    v128.load32_splat offset=3
+    local.set 2
+    local.get 1
+    if (result i64)  ;; label = @1
+      local.get 2
+      i64x2.extract_lane 1
+    else
+      local.get 2
+      i64x2.extract_lane 0
+    end)
+  (func (;360;) (type 1) (param i32 i32) (result i64)
+    (local v128)
+    local.get 0
+    v128.load32_splat offset=4096
+    local.set 2
+    local.get 1
+    if (result i64)  ;; label = @1
+      local.get 2
+      i64x2.extract_lane 1
+    else
+      local.get 2
+      i64x2.extract_lane 0
+    end)
+  (func (;361;) (type 9) (param i32) (result i64)
+    (local v128)
+    i32.const 17
+    v128.load32_splat offset=2
+    local.set 1
+    local.get 0
+    if (result i64)  ;; label = @1
+      local.get 1
+      i64x2.extract_lane 1
+    else
+      local.get 1
+      i64x2.extract_lane 0
+    end)
+  (func (;362;) (type 1) (param i32 i32) (result i64)
+    (local v128)
+    local.get 0
+    v128.load64_splat
+    local.set 2
+    local.get 1
+    if (result i64)  ;; label = @1
+      local.get 2
+      i64x2.extract_lane 1
+    else
+      local.get 2
+      i64x2.extract_lane 0
+    end)
+  (func (;363;) (type 1) (param i32 i32) (result i64)
+    (local v128)
+    local.get 0
+    v128.load64_splat offset=3
+    local.set 2
+    local.get 1
+    if (result i64)  ;; label = @1
+      local.get 2
+      i64x2.extract_lane 1
+    else
+      local.get 2
+      i64x2.extract_lane 0
+    end)
+  (func (;364;) (type 1) (param i32 i32) (result i64)
+    (local v128)
+    local.get 0
+    v128.load64_splat offset=4096
+    local.set 2
+    local.get 1
+    if (result i64)  ;; label = @1
+      local.get 2
+      i64x2.extract_lane 1
+    else
+      local.get 2
+      i64x2.extract_lane 0
+    end)
+  (func (;365;) (type 9) (param i32) (result i64)
+    (local v128)
+    i32.const 17
+    v128.load64_splat offset=2
+    local.set 1
+    local.get 0
+    if (result i64)  ;; label = @1
+      local.get 1
+      i64x2.extract_lane 1
+    else
+      local.get 1
+      i64x2.extract_lane 0
+    end)
+  (func (;366;) (type 1) (param i32 i32) (result i64)
+    (local v128)
+    local.get 0
+    v128.load32_zero
+    local.set 2
+    local.get 1
+    if (result i64)  ;; label = @1
+      local.get 2
+      i64x2.extract_lane 1
+    else
+      local.get 2
+      i64x2.extract_lane 0
+    end)
+  (func (;367;) (type 1) (param i32 i32) (result i64)
+    (local v128)
+    local.get 0
+    v128.load32_zero offset=3
+    local.set 2
+    local.get 1
+    if (result i64)  ;; label = @1
+      local.get 2
+      i64x2.extract_lane 1
+    else
+      local.get 2
+      i64x2.extract_lane 0
+    end)
+  (func (;368;) (type 1) (param i32 i32) (result i64)
+    (local v128)
+    local.get 0
+    v128.load32_zero offset=4096
+    local.set 2
+    local.get 1
+    if (result i64)  ;; label = @1
+      local.get 2
+      i64x2.extract_lane 1
+    else
+      local.get 2
+      i64x2.extract_lane 0
+    end)
+  (func (;369;) (type 9) (param i32) (result i64)
+    (local v128)
+    i32.const 17
+    v128.load32_zero offset=2
+    local.set 1
+    local.get 0
+    if (result i64)  ;; label = @1
+      local.get 1
+      i64x2.extract_lane 1
+    else
+      local.get 1
+      i64x2.extract_lane 0
+    end)
+  (func (;370;) (type 1) (param i32 i32) (result i64)
+    (local v128)
+    local.get 0
+    v128.load64_zero
+    local.set 2
+    local.get 1
+    if (result i64)  ;; label = @1
+      local.get 2
+      i64x2.extract_lane 1
+    else
+      local.get 2
+      i64x2.extract_lane 0
+    end)
+  (func (;371;) (type 1) (param i32 i32) (result i64)
+    (local v128)
+    local.get 0
+    v128.load64_zero offset=3
+    local.set 2
+    local.get 1
+    if (result i64)  ;; label = @1
+      local.get 2
+      i64x2.extract_lane 1
+    else
+      local.get 2
+      i64x2.extract_lane 0
+    end)
+  (func (;372;) (type 1) (param i32 i32) (result i64)
+    (local v128)
+    local.get 0
+    v128.load64_zero offset=4096
+    local.set 2
+    local.get 1
+    if (result i64)  ;; label = @1
+      local.get 2
+      i64x2.extract_lane 1
+    else
+      local.get 2
+      i64x2.extract_lane 0
+    end)
+  (func (;373;) (type 9) (param i32) (result i64)
+    (local v128)
+    i32.const 17
+    v128.load64_zero offset=2
+    local.set 1
+    local.get 0
+    if (result i64)  ;; label = @1
+      local.get 1
+      i64x2.extract_lane 1
+    else
+      local.get 1
+      i64x2.extract_lane 0
+    end)
+  (func (;374;) (type 10) (param i32 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    local.get 1
+    i64x2.splat
+    local.get 2
+    i64x2.replace_lane 1
+    v128.load8_lane offset=1 0
+    local.set 4
+    local.get 3
+    if (result i64)  ;; label = @1
+      local.get 4
+      i64x2.extract_lane 1
+    else
+      local.get 4
+      i64x2.extract_lane 0
+    end)
+  (func (;375;) (type 11) (param i32 i64 i64) (result i64)
+    local.get 0
+    i64.const 0
+    i64.store
+    local.get 0
+    i64.const 0
+    i64.store offset=8
+    local.get 0
+    local.get 1
+    i64x2.splat
+    local.get 2
+    i64x2.replace_lane 1
+    v128.store8_lane 0
+    local.get 0
+    i64.load
+    local.get 0
+    i64.load offset=8
+    i64.xor)
+  (func (;376;) (type 10) (param i32 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    local.get 1
+    i64x2.splat
+    local.get 2
+    i64x2.replace_lane 1
+    v128.load8_lane offset=1 15
+    local.set 4
+    local.get 3
+    if (result i64)  ;; label = @1
+      local.get 4
+      i64x2.extract_lane 1
+    else
+      local.get 4
+      i64x2.extract_lane 0
+    end)
+  (func (;377;) (type 11) (param i32 i64 i64) (result i64)
+    local.get 0
+    i64.const 0
+    i64.store
+    local.get 0
+    i64.const 0
+    i64.store offset=8
+    local.get 0
+    local.get 1
+    i64x2.splat
+    local.get 2
+    i64x2.replace_lane 1
+    v128.store8_lane 15
+    local.get 0
+    i64.load
+    local.get 0
+    i64.load offset=8
+    i64.xor)
+  (func (;378;) (type 10) (param i32 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    local.get 1
+    i64x2.splat
+    local.get 2
+    i64x2.replace_lane 1
+    v128.load16_lane offset=1 0
+    local.set 4
+    local.get 3
+    if (result i64)  ;; label = @1
+      local.get 4
+      i64x2.extract_lane 1
+    else
+      local.get 4
+      i64x2.extract_lane 0
+    end)
+  (func (;379;) (type 11) (param i32 i64 i64) (result i64)
+    local.get 0
+    i64.const 0
+    i64.store
+    local.get 0
+    i64.const 0
+    i64.store offset=8
+    local.get 0
+    local.get 1
+    i64x2.splat
+    local.get 2
+    i64x2.replace_lane 1
+    v128.store16_lane 0
+    local.get 0
+    i64.load
+    local.get 0
+    i64.load offset=8
+    i64.xor)
+  (func (;380;) (type 10) (param i32 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    local.get 1
+    i64x2.splat
+    local.get 2
+    i64x2.replace_lane 1
+    v128.load16_lane offset=1 7
+    local.set 4
+    local.get 3
+    if (result i64)  ;; label = @1
+      local.get 4
+      i64x2.extract_lane 1
+    else
+      local.get 4
+      i64x2.extract_lane 0
+    end)
+  (func (;381;) (type 11) (param i32 i64 i64) (result i64)
+    local.get 0
+    i64.const 0
+    i64.store
+    local.get 0
+    i64.const 0
+    i64.store offset=8
+    local.get 0
+    local.get 1
+    i64x2.splat
+    local.get 2
+    i64x2.replace_lane 1
+    v128.store16_lane 7
+    local.get 0
+    i64.load
+    local.get 0
+    i64.load offset=8
+    i64.xor)
+  (func (;382;) (type 10) (param i32 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    local.get 1
+    i64x2.splat
+    local.get 2
+    i64x2.replace_lane 1
+    v128.load32_lane offset=1 0
+    local.set 4
+    local.get 3
+    if (result i64)  ;; label = @1
+      local.get 4
+      i64x2.extract_lane 1
+    else
+      local.get 4
+      i64x2.extract_lane 0
+    end)
+  (func (;383;) (type 11) (param i32 i64 i64) (result i64)
+    local.get 0
+    i64.const 0
+    i64.store
+    local.get 0
+    i64.const 0
+    i64.store offset=8
+    local.get 0
+    local.get 1
+    i64x2.splat
+    local.get 2
+    i64x2.replace_lane 1
+    v128.store32_lane 0
+    local.get 0
+    i64.load
+    local.get 0
+    i64.load offset=8
+    i64.xor)
+  (func (;384;) (type 10) (param i32 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    local.get 1
+    i64x2.splat
+    local.get 2
+    i64x2.replace_lane 1
+    v128.load32_lane offset=1 3
+    local.set 4
+    local.get 3
+    if (result i64)  ;; label = @1
+      local.get 4
+      i64x2.extract_lane 1
+    else
+      local.get 4
+      i64x2.extract_lane 0
+    end)
+  (func (;385;) (type 11) (param i32 i64 i64) (result i64)
+    local.get 0
+    i64.const 0
+    i64.store
+    local.get 0
+    i64.const 0
+    i64.store offset=8
+    local.get 0
+    local.get 1
+    i64x2.splat
+    local.get 2
+    i64x2.replace_lane 1
+    v128.store32_lane 3
+    local.get 0
+    i64.load
+    local.get 0
+    i64.load offset=8
+    i64.xor)
+  (func (;386;) (type 10) (param i32 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    local.get 1
+    i64x2.splat
+    local.get 2
+    i64x2.replace_lane 1
+    v128.load64_lane offset=1 0
+    local.set 4
+    local.get 3
+    if (result i64)  ;; label = @1
+      local.get 4
+      i64x2.extract_lane 1
+    else
+      local.get 4
+      i64x2.extract_lane 0
+    end)
+  (func (;387;) (type 11) (param i32 i64 i64) (result i64)
+    local.get 0
+    i64.const 0
+    i64.store
+    local.get 0
+    i64.const 0
+    i64.store offset=8
+    local.get 0
+    local.get 1
+    i64x2.splat
+    local.get 2
+    i64x2.replace_lane 1
+    v128.store64_lane 0
+    local.get 0
+    i64.load
+    local.get 0
+    i64.load offset=8
+    i64.xor)
+  (func (;388;) (type 10) (param i32 i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    local.get 1
+    i64x2.splat
+    local.get 2
+    i64x2.replace_lane 1
+    v128.load64_lane offset=1 1
+    local.set 4
+    local.get 3
+    if (result i64)  ;; label = @1
+      local.get 4
+      i64x2.extract_lane 1
+    else
+      local.get 4
+      i64x2.extract_lane 0
+    end)
+  (func (;389;) (type 11) (param i32 i64 i64) (result i64)
+    local.get 0
+    i64.const 0
+    i64.store
+    local.get 0
+    i64.const 0
+    i64.store offset=8
+    local.get 0
+    local.get 1
+    i64x2.splat
+    local.get 2
+    i64x2.replace_lane 1
+    v128.store64_lane 1
+    local.get 0
+    i64.load
+    local.get 0
+    i64.load offset=8
+    i64.xor)
+  (func (;390;) (type 10) (param i32 i64 i64 i32) (result i64)
+    local.get 0
+    local.get 1
+    i64x2.splat
+    local.get 2
+    i64x2.replace_lane 1
+    v128.store offset=5
+    local.get 0
+    local.get 3
+    i32.const 3
+    i32.shl
+    i32.add
+    i64.load offset=5)
+  (func (;391;) (type 12) (param i32 i32 i32) (result i64)
+    block  ;; label = @1
+      loop  ;; label = @2
+        local.get 2
+        i32.eqz
+        br_if 1
+        local.get 1
+        local.get 0
+        v128.load
+        v128.store
+        local.get 0
+        i32.const 16
+        i32.add
+        local.set 0
+        local.get 1
+        i32.const 16
+        i32.add
+        local.set 1
+        local.get 2
+        i32.const 1
+        i32.sub
+        local.set 2
+        br 0
+      end
+    end
+    local.get 1
+    i32.const 16
+    i32.sub
+    i64.load
+    local.get 1
+    i32.const 8
+    i32.sub
+    i64.load
+    i64.xor)
+  (func (;392;) (type 13) (param v128 v128) (result v128)
+    local.get 0
+    local.get 1
+    i16x8.add)
+  (func (;393;) (type 14) (param f64 v128 i32 v128 f32) (result v128)
+    local.get 1
+    local.get 3
+    i32x4.sub
+    local.get 0
+    f64x2.splat
+    local.get 4
+    f32x4.splat
+    f64x2.promote_low_f32x4
+    f64x2.add
+    i64x2.add
+    local.get 2
+    i32x4.splat
+    i32x4.add)
+  (func (;394;) (type 0) (param i64 i64 i64 i64 i32) (result i64)
+    (local v128 v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.set 5
+    local.get 2
+    i64x2.splat
+    local.get 3
+    i64x2.replace_lane 1
+    local.set 6
+    local.get 5
+    local.get 6
+    call 392
+    local.get 5
+    i8x16.sub
+    local.get 6
+    call 392
+    local.get 5
+    i64x2.add
+    local.set 5
+    local.get 4
+    if (result i64)  ;; label = @1
+      local.get 5
+      i64x2.extract_lane 1
+    else
+      local.get 5
+      i64x2.extract_lane 0
+    end)
+  (func (;395;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.set 3
+    f64.const 0x1.8p+0 (;=1.5;)
+    local.get 3
+    i32.const 9
+    i64.const 7
+    i64x2.splat
+    f32.const 0x1.4p+1 (;=2.5;)
+    call 393
+    local.get 3
+    call 392
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;396;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128 v128 v128 v128 v128 v128 v128 v128 v128 v128 v128 v128 v128 v128 v128 v128 v128 v128 v128 v128 v128 v128 v128 v128 v128 v128 v128 v128 v128 v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.set 3
+    local.get 3
+    i32.const 1
+    i32x4.splat
+    i32x4.add
+    local.set 4
+    local.get 4
+    i32.const 2
+    i32x4.splat
+    i32x4.add
+    local.set 5
+    local.get 5
+    i32.const 3
+    i32x4.splat
+    i32x4.add
+    local.set 6
+    local.get 6
+    i32.const 4
+    i32x4.splat
+    i32x4.add
+    local.set 7
+    local.get 7
+    i32.const 5
+    i32x4.splat
+    i32x4.add
+    local.set 8
+    local.get 8
+    i32.const 6
+    i32x4.splat
+    i32x4.add
+    local.set 9
+    local.get 9
+    i32.const 7
+    i32x4.splat
+    i32x4.add
+    local.set 10
+    local.get 10
+    i32.const 8
+    i32x4.splat
+    i32x4.add
+    local.set 11
+    local.get 11
+    i32.const 9
+    i32x4.splat
+    i32x4.add
+    local.set 12
+    local.get 12
+    i32.const 10
+    i32x4.splat
+    i32x4.add
+    local.set 13
+    local.get 13
+    i32.const 11
+    i32x4.splat
+    i32x4.add
+    local.set 14
+    local.get 14
+    i32.const 12
+    i32x4.splat
+    i32x4.add
+    local.set 15
+    local.get 15
+    i32.const 13
+    i32x4.splat
+    i32x4.add
+    local.set 16
+    local.get 16
+    i32.const 14
+    i32x4.splat
+    i32x4.add
+    local.set 17
+    local.get 17
+    i32.const 15
+    i32x4.splat
+    i32x4.add
+    local.set 18
+    local.get 18
+    i32.const 16
+    i32x4.splat
+    i32x4.add
+    local.set 19
+    local.get 19
+    i32.const 17
+    i32x4.splat
+    i32x4.add
+    local.set 20
+    local.get 20
+    i32.const 18
+    i32x4.splat
+    i32x4.add
+    local.set 21
+    local.get 21
+    i32.const 19
+    i32x4.splat
+    i32x4.add
+    local.set 22
+    local.get 22
+    i32.const 20
+    i32x4.splat
+    i32x4.add
+    local.set 23
+    local.get 23
+    i32.const 21
+    i32x4.splat
+    i32x4.add
+    local.set 24
+    local.get 24
+    i32.const 22
+    i32x4.splat
+    i32x4.add
+    local.set 25
+    local.get 25
+    i32.const 23
+    i32x4.splat
+    i32x4.add
+    local.set 26
+    local.get 26
+    i32.const 24
+    i32x4.splat
+    i32x4.add
+    local.set 27
+    local.get 27
+    i32.const 25
+    i32x4.splat
+    i32x4.add
+    local.set 28
+    local.get 28
+    i32.const 26
+    i32x4.splat
+    i32x4.add
+    local.set 29
+    local.get 29
+    i32.const 27
+    i32x4.splat
+    i32x4.add
+    local.set 30
+    local.get 30
+    i32.const 28
+    i32x4.splat
+    i32x4.add
+    local.set 31
+    local.get 31
+    i32.const 29
+    i32x4.splat
+    i32x4.add
+    local.set 32
+    local.get 3
+    local.get 4
+    i32x4.add
+    local.get 5
+    i32x4.add
+    local.get 6
+    i32x4.add
+    local.get 7
+    i32x4.add
+    local.get 8
+    i32x4.add
+    local.get 9
+    i32x4.add
+    local.get 10
+    i32x4.add
+    local.get 11
+    i32x4.add
+    local.get 12
+    i32x4.add
+    local.get 13
+    i32x4.add
+    local.get 14
+    i32x4.add
+    local.get 15
+    i32x4.add
+    local.get 16
+    i32x4.add
+    local.get 17
+    i32x4.add
+    local.get 18
+    i32x4.add
+    local.get 19
+    i32x4.add
+    local.get 20
+    i32x4.add
+    local.get 21
+    i32x4.add
+    local.get 22
+    i32x4.add
+    local.get 23
+    i32x4.add
+    local.get 24
+    i32x4.add
+    local.get 25
+    i32x4.add
+    local.get 26
+    i32x4.add
+    local.get 27
+    i32x4.add
+    local.get 28
+    i32x4.add
+    local.get 29
+    i32x4.add
+    local.get 30
+    i32x4.add
+    local.get 31
+    i32x4.add
+    local.get 32
+    i32x4.add
+    local.get 3
+    i32x4.sub
+    local.get 7
+    i32x4.sub
+    local.get 11
+    i32x4.sub
+    local.get 15
+    i32x4.sub
+    local.get 19
+    i32x4.sub
+    local.get 23
+    i32x4.sub
+    local.get 27
+    i32x4.sub
+    local.get 31
+    i32x4.sub
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;397;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128 v128 v128 v128 v128 v128 v128 v128 v128 v128 v128 v128 v128 v128 v128 v128 v128 v128 v128 v128 v128 v128 v128 v128 v128 v128 v128 v128 v128 v128)
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1
+    local.set 3
+    local.get 3
+    i32.const 1
+    i32x4.splat
+    i32x4.add
+    local.set 4
+    local.get 4
+    i32.const 2
+    i32x4.splat
+    i32x4.add
+    local.set 5
+    local.get 5
+    i32.const 3
+    i32x4.splat
+    i32x4.add
+    local.set 6
+    local.get 6
+    i32.const 4
+    i32x4.splat
+    i32x4.add
+    local.set 7
+    local.get 7
+    i32.const 5
+    i32x4.splat
+    i32x4.add
+    local.set 8
+    local.get 8
+    i32.const 6
+    i32x4.splat
+    i32x4.add
+    local.set 9
+    local.get 9
+    i32.const 7
+    i32x4.splat
+    i32x4.add
+    local.set 10
+    local.get 10
+    i32.const 8
+    i32x4.splat
+    i32x4.add
+    local.set 11
+    local.get 11
+    i32.const 9
+    i32x4.splat
+    i32x4.add
+    local.set 12
+    local.get 12
+    i32.const 10
+    i32x4.splat
+    i32x4.add
+    local.set 13
+    local.get 13
+    i32.const 11
+    i32x4.splat
+    i32x4.add
+    local.set 14
+    local.get 14
+    i32.const 12
+    i32x4.splat
+    i32x4.add
+    local.set 15
+    local.get 15
+    i32.const 13
+    i32x4.splat
+    i32x4.add
+    local.set 16
+    local.get 16
+    i32.const 14
+    i32x4.splat
+    i32x4.add
+    local.set 17
+    local.get 17
+    i32.const 15
+    i32x4.splat
+    i32x4.add
+    local.set 18
+    local.get 18
+    i32.const 16
+    i32x4.splat
+    i32x4.add
+    local.set 19
+    local.get 19
+    i32.const 17
+    i32x4.splat
+    i32x4.add
+    local.set 20
+    local.get 20
+    i32.const 18
+    i32x4.splat
+    i32x4.add
+    local.set 21
+    local.get 21
+    i32.const 19
+    i32x4.splat
+    i32x4.add
+    local.set 22
+    local.get 22
+    i32.const 20
+    i32x4.splat
+    i32x4.add
+    local.set 23
+    local.get 23
+    i32.const 21
+    i32x4.splat
+    i32x4.add
+    local.set 24
+    local.get 24
+    i32.const 22
+    i32x4.splat
+    i32x4.add
+    local.set 25
+    local.get 25
+    i32.const 23
+    i32x4.splat
+    i32x4.add
+    local.set 26
+    local.get 26
+    i32.const 24
+    i32x4.splat
+    i32x4.add
+    local.set 27
+    local.get 27
+    i32.const 25
+    i32x4.splat
+    i32x4.add
+    local.set 28
+    local.get 28
+    i32.const 26
+    i32x4.splat
+    i32x4.add
+    local.set 29
+    local.get 29
+    i32.const 27
+    i32x4.splat
+    i32x4.add
+    local.set 30
+    local.get 30
+    i32.const 28
+    i32x4.splat
+    i32x4.add
+    local.set 31
+    local.get 31
+    i32.const 29
+    i32x4.splat
+    i32x4.add
+    local.set 32
+    local.get 3
+    local.get 4
+    local.get 5
+    call 392
+    i32x4.add
+    local.get 5
+    i32x4.add
+    local.get 6
+    i32x4.add
+    local.get 7
+    i32x4.add
+    local.get 8
+    i32x4.add
+    local.get 9
+    i32x4.add
+    local.get 10
+    i32x4.add
+    local.get 11
+    i32x4.add
+    local.get 12
+    i32x4.add
+    local.get 13
+    i32x4.add
+    local.get 14
+    i32x4.add
+    local.get 15
+    i32x4.add
+    local.get 16
+    i32x4.add
+    local.get 17
+    i32x4.add
+    local.get 18
+    i32x4.add
+    local.get 19
+    i32x4.add
+    local.get 20
+    i32x4.add
+    local.get 21
+    i32x4.add
+    local.get 22
+    i32x4.add
+    local.get 23
+    i32x4.add
+    local.get 24
+    i32x4.add
+    local.get 25
+    i32x4.add
+    local.get 26
+    i32x4.add
+    local.get 27
+    i32x4.add
+    local.get 28
+    i32x4.add
+    local.get 29
+    i32x4.add
+    local.get 30
+    i32x4.add
+    local.get 31
+    i32x4.add
+    local.get 32
+    i32x4.add
+    local.get 3
+    i32x4.sub
+    local.get 7
+    i32x4.sub
+    local.get 11
+    i32x4.sub
+    local.get 15
+    i32x4.sub
+    local.get 19
+    i32x4.sub
+    local.get 23
+    i32x4.sub
+    local.get 27
+    i32x4.sub
+    local.get 31
+    i32x4.sub
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;398;) (type 9) (param i32) (result i64)
+    (local v128)
+    local.get 0
+    if (result i64)  ;; label = @1
+      local.get 1
+      i64x2.extract_lane 1
+    else
+      local.get 1
+      i64x2.extract_lane 0
+    end)
+  (func (;399;) (type 4) (param i64 i64 i32 i32) (result i64)
+    (local v128)
+    local.get 3
+    if (result v128)  ;; label = @1
+      local.get 0
+      i64x2.splat
+      local.get 1
+      i64x2.replace_lane 1
+    else
+      local.get 0
+      i64x2.splat
+      local.get 1
+      i64x2.replace_lane 1
+      i8x16.neg
+    end
+    local.set 4
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 4
+      i64x2.extract_lane 1
+    else
+      local.get 4
+      i64x2.extract_lane 0
+    end)
+  (func (;400;) (type 4) (param i64 i64 i32 i32) (result i64)
+    (local v128)
+    block (result v128)  ;; label = @1
+      local.get 0
+      i64x2.splat
+      local.get 1
+      i64x2.replace_lane 1
+      local.get 3
+      br_if 0
+      i16x8.abs
+    end
+    local.set 4
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 4
+      i64x2.extract_lane 1
+    else
+      local.get 4
+      i64x2.extract_lane 0
+    end)
+  (func (;401;) (type 1) (param i32 i32) (result i64)
+    (local v128)
+    block  ;; label = @1
+      loop  ;; label = @2
+        local.get 0
+        i32.eqz
+        br_if 1
+        local.get 2
+        local.get 0
+        i32x4.splat
+        i32x4.add
+        local.get 0
+        i32x4.splat
+        i32.const 1
+        i32x4.shl
+        i32x4.mul
+        local.set 2
+        local.get 0
+        i32.const 1
+        i32.sub
+        local.set 0
+        br 0
+      end
+    end
+    local.get 1
+    if (result i64)  ;; label = @1
+      local.get 2
+      i64x2.extract_lane 1
+    else
+      local.get 2
+      i64x2.extract_lane 0
+    end)
+  (func (;402;) (type 15) (param i64 i64 i32) (result v128)
+    local.get 2
+    if  ;; label = @1
+      local.get 0
+      i64x2.splat
+      local.get 1
+      i64x2.replace_lane 1
+      i32x4.neg
+      return
+    end
+    local.get 0
+    i64x2.splat
+    local.get 1
+    i64x2.replace_lane 1)
+  (func (;403;) (type 7) (param i64 i64 i32) (result i64)
+    (local v128)
+    local.get 0
+    local.get 1
+    local.get 2
+    call 402
+    local.set 3
+    local.get 2
+    if (result i64)  ;; label = @1
+      local.get 3
+      i64x2.extract_lane 1
+    else
+      local.get 3
+      i64x2.extract_lane 0
+    end)
+  (func (;404;) (type 16) (result i32)
+    (local i32)
+    block  ;; label = @1
+      loop  ;; label = @2
+        local.get 0
+        i32.const 32768
+        i32.ge_u
+        br_if 1
+        local.get 0
+        local.get 0
+        i32.const -1640531535
+        i32.mul
+        i32.const 7
+        i32.shr_u
+        i32.store offset=16384
+        local.get 0
+        i32.const 4
+        i32.add
+        local.set 0
+        br 0
+      end
+    end
+    local.get 0)
+  (func (;405;) (type 17) (param i32) (result i32)
+    (local i32 i32)
+    block  ;; label = @1
+      loop  ;; label = @2
+        local.get 1
+        local.get 0
+        i32.const 2
+        i32.shl
+        i32.ge_u
+        br_if 1
+        local.get 2
+        local.get 1
+        i32.load offset=16384
+        local.get 1
+        i32.load offset=32768
+        i32.mul
+        i32.add
+        local.set 2
+        local.get 1
+        i32.const 4
+        i32.add
+        local.set 1
+        br 0
+      end
+    end
+    local.get 2)
+  (func (;406;) (type 17) (param i32) (result i32)
+    (local i32 v128)
+    block  ;; label = @1
+      loop  ;; label = @2
+        local.get 1
+        local.get 0
+        i32.const 2
+        i32.shl
+        i32.ge_u
+        br_if 1
+        local.get 2
+        local.get 1
+        v128.load offset=16384
+        local.get 1
+        v128.load offset=32768
+        i32x4.mul
+        i32x4.add
+        local.set 2
+        local.get 1
+        i32.const 16
+        i32.add
+        local.set 1
+        br 0
+      end
+    end
+    local.get 2
+    i32x4.extract_lane 0
+    local.get 2
+    i32x4.extract_lane 1
+    i32.add
+    local.get 2
+    i32x4.extract_lane 2
+    i32.add
+    local.get 2
+    i32x4.extract_lane 3
+    i32.add)
+  (func (;407;) (type 9) (param i32) (result i64)
+    (local i32)
+    block  ;; label = @1
+      loop  ;; label = @2
+        local.get 1
+        local.get 0
+        i32.ge_u
+        br_if 1
+        local.get 1
+        local.get 1
+        i64.load offset=16384
+        i64.store offset=49152
+        local.get 1
+        i32.const 8
+        i32.add
+        local.set 1
+        br 0
+      end
+    end
+    local.get 0
+    i64.load offset=49144)
+  (func (;408;) (type 9) (param i32) (result i64)
+    (local i32)
+    block  ;; label = @1
+      loop  ;; label = @2
+        local.get 1
+        local.get 0
+        i32.ge_u
+        br_if 1
+        local.get 1
+        local.get 1
+        v128.load offset=16384
+        v128.store offset=49152
+        local.get 1
+        i32.const 16
+        i32.add
+        local.set 1
+        br 0
+      end
+    end
+    local.get 0
+    i64.load offset=49144)
+  (func (;409;) (type 18) (param i32 i32) (result i32)
+    (local i32 i32)
+    block  ;; label = @1
+      loop  ;; label = @2
+        local.get 2
+        local.get 0
+        i32.ge_u
+        br_if 1
+        local.get 3
+        local.get 2
+        i32.load8_u offset=16384
+        local.get 1
+        i32.eq
+        i32.add
+        local.set 3
+        local.get 2
+        i32.const 1
+        i32.add
+        local.set 2
+        br 0
+      end
+    end
+    local.get 3)
+  (func (;410;) (type 18) (param i32 i32) (result i32)
+    (local i32 v128 v128)
+    local.get 1
+    i8x16.splat
+    local.set 4
+    block  ;; label = @1
+      loop  ;; label = @2
+        local.get 2
+        local.get 0
+        i32.ge_u
+        br_if 1
+        local.get 3
+        local.get 2
+        v128.load offset=16384
+        local.get 4
+        i8x16.eq
+        i16x8.extadd_pairwise_i8x16_s
+        i16x8.sub
+        local.set 3
+        local.get 2
+        i32.const 16
+        i32.add
+        local.set 2
+        br 0
+      end
+    end
+    local.get 3
+    i32x4.extadd_pairwise_i16x8_u
+    local.set 3
+    local.get 3
+    i32x4.extract_lane 0
+    local.get 3
+    i32x4.extract_lane 1
+    i32.add
+    local.get 3
+    i32x4.extract_lane 2
+    i32.add
+    local.get 3
+    i32x4.extract_lane 3
+    i32.add)
+  (memory (;0;) 1)
+  (export "i8x16.swizzle" (func 0))
+  (export "i8x16.splat" (func 1))
+  (export "i16x8.splat" (func 2))
+  (export "i32x4.splat" (func 3))
+  (export "i64x2.splat" (func 4))
+  (export "f32x4.splat" (func 5))
+  (export "f64x2.splat" (func 6))
+  (export "i8x16.extract_lane_s-0" (func 7))
+  (export "i8x16.extract_lane_s-1" (func 8))
+  (export "i8x16.extract_lane_s-9" (func 9))
+  (export "i8x16.extract_lane_s-15" (func 10))
+  (export "i8x16.extract_lane_u-0" (func 11))
+  (export "i8x16.extract_lane_u-1" (func 12))
+  (export "i8x16.extract_lane_u-9" (func 13))
+  (export "i8x16.extract_lane_u-15" (func 14))
+  (export "i8x16.replace_lane-0" (func 15))
+  (export "i8x16.replace_lane-8" (func 16))
+  (export "i8x16.replace_lane-15" (func 17))
+  (export "i16x8.extract_lane_s-0" (func 18))
+  (export "i16x8.extract_lane_s-1" (func 19))
+  (export "i16x8.extract_lane_s-5" (func 20))
+  (export "i16x8.extract_lane_s-7" (func 21))
+  (export "i16x8.extract_lane_u-0" (func 22))
+  (export "i16x8.extract_lane_u-1" (func 23))
+  (export "i16x8.extract_lane_u-5" (func 24))
+  (export "i16x8.extract_lane_u-7" (func 25))
+  (export "i16x8.replace_lane-0" (func 26))
+  (export "i16x8.replace_lane-4" (func 27))
+  (export "i16x8.replace_lane-7" (func 28))
+  (export "i32x4.extract_lane-0" (func 29))
+  (export "i32x4.extract_lane-1" (func 30))
+  (export "i32x4.extract_lane-3" (func 31))
+  (export "i32x4.replace_lane-0" (func 32))
+  (export "i32x4.replace_lane-2" (func 33))
+  (export "i32x4.replace_lane-3" (func 34))
+  (export "i64x2.extract_lane-0" (func 35))
+  (export "i64x2.extract_lane-1" (func 36))
+  (export "i64x2.replace_lane-0" (func 37))
+  (export "i64x2.replace_lane-1" (func 38))
+  (export "f32x4.extract_lane-0" (func 39))
+  (export "f32x4.extract_lane-1" (func 40))
+  (export "f32x4.extract_lane-3" (func 41))
+  (export "f32x4.replace_lane-0" (func 42))
+  (export "f32x4.replace_lane-2" (func 43))
+  (export "f32x4.replace_lane-3" (func 44))
+  (export "f64x2.extract_lane-0" (func 45))
+  (export "f64x2.extract_lane-1" (func 46))
+  (export "f64x2.replace_lane-0" (func 47))
+  (export "f64x2.replace_lane-1" (func 48))
+  (export "i8x16.eq" (func 49))
+  (export "i8x16.ne" (func 50))
+  (export "i8x16.lt_s" (func 51))
+  (export "i8x16.lt_u" (func 52))
+  (export "i8x16.gt_s" (func 53))
+  (export "i8x16.gt_u" (func 54))
+  (export "i8x16.le_s" (func 55))
+  (export "i8x16.le_u" (func 56))
+  (export "i8x16.ge_s" (func 57))
+  (export "i8x16.ge_u" (func 58))
+  (export "i16x8.eq" (func 59))
+  (export "i16x8.ne" (func 60))
+  (export "i16x8.lt_s" (func 61))
+  (export "i16x8.lt_u" (func 62))
+  (export "i16x8.gt_s" (func 63))
+  (export "i16x8.gt_u" (func 64))
+  (export "i16x8.le_s" (func 65))
+  (export "i16x8.le_u" (func 66))
+  (export "i16x8.ge_s" (func 67))
+  (export "i16x8.ge_u" (func 68))
+  (export "i32x4.eq" (func 69))
+  (export "i32x4.ne" (func 70))
+  (export "i32x4.lt_s" (func 71))
+  (export "i32x4.lt_u" (func 72))
+  (export "i32x4.gt_s" (func 73))
+  (export "i32x4.gt_u" (func 74))
+  (export "i32x4.le_s" (func 75))
+  (export "i32x4.le_u" (func 76))
+  (export "i32x4.ge_s" (func 77))
+  (export "i32x4.ge_u" (func 78))
+  (export "f32x4.eq" (func 79))
+  (export "f32x4.ne" (func 80))
+  (export "f32x4.lt" (func 81))
+  (export "f32x4.gt" (func 82))
+  (export "f32x4.le" (func 83))
+  (export "f32x4.ge" (func 84))
+  (export "f64x2.eq" (func 85))
+  (export "f64x2.ne" (func 86))
+  (export "f64x2.lt" (func 87))
+  (export "f64x2.gt" (func 88))
+  (export "f64x2.le" (func 89))
+  (export "f64x2.ge" (func 90))
+  (export "v128.not" (func 91))
+  (export "v128.and" (func 92))
+  (export "v128.andnot" (func 93))
+  (export "v128.or" (func 94))
+  (export "v128.xor" (func 95))
+  (export "v128.bitselect" (func 96))
+  (export "v128.any_true" (func 97))
+  (export "v128.any_true-if" (func 98))
+  (export "v128.any_true-br_if" (func 99))
+  (export "f32x4.demote_f64x2_zero" (func 100))
+  (export "f64x2.promote_low_f32x4" (func 101))
+  (export "i8x16.abs" (func 102))
+  (export "i8x16.neg" (func 103))
+  (export "i8x16.popcnt" (func 104))
+  (export "i8x16.all_true" (func 105))
+  (export "i8x16.all_true-if" (func 106))
+  (export "i8x16.all_true-br_if" (func 107))
+  (export "i8x16.bitmask" (func 108))
+  (export "i8x16.narrow_i16x8_s" (func 109))
+  (export "i8x16.narrow_i16x8_u" (func 110))
+  (export "f32x4.ceil" (func 111))
+  (export "f32x4.floor" (func 112))
+  (export "f32x4.trunc" (func 113))
+  (export "f32x4.nearest" (func 114))
+  (export "i8x16.shl" (func 115))
+  (export "i8x16.shl-0" (func 116))
+  (export "i8x16.shl-1" (func 117))
+  (export "i8x16.shl-7" (func 118))
+  (export "i8x16.shl-8" (func 119))
+  (export "i8x16.shl-11" (func 120))
+  (export "i8x16.shr_s" (func 121))
+  (export "i8x16.shr_s-0" (func 122))
+  (export "i8x16.shr_s-1" (func 123))
+  (export "i8x16.shr_s-7" (func 124))
+  (export "i8x16.shr_s-8" (func 125))
+  (export "i8x16.shr_s-11" (func 126))
+  (export "i8x16.shr_u" (func 127))
+  (export "i8x16.shr_u-0" (func 128))
+  (export "i8x16.shr_u-1" (func 129))
+  (export "i8x16.shr_u-7" (func 130))
+  (export "i8x16.shr_u-8" (func 131))
+  (export "i8x16.shr_u-11" (func 132))
+  (export "i8x16.add" (func 133))
+  (export "i8x16.add_sat_s" (func 134))
+  (export "i8x16.add_sat_u" (func 135))
+  (export "i8x16.sub" (func 136))
+  (export "i8x16.sub_sat_s" (func 137))
+  (export "i8x16.sub_sat_u" (func 138))
+  (export "f64x2.ceil" (func 139))
+  (export "f64x2.floor" (func 140))
+  (export "i8x16.min_s" (func 141))
+  (export "i8x16.min_u" (func 142))
+  (export "i8x16.max_s" (func 143))
+  (export "i8x16.max_u" (func 144))
+  (export "f64x2.trunc" (func 145))
+  (export "i8x16.avgr_u" (func 146))
+  (export "i16x8.extadd_pairwise_i8x16_s" (func 147))
+  (export "i16x8.extadd_pairwise_i8x16_u" (func 148))
+  (export "i32x4.extadd_pairwise_i16x8_s" (func 149))
+  (export "i32x4.extadd_pairwise_i16x8_u" (func 150))
+  (export "i16x8.abs" (func 151))
+  (export "i16x8.neg" (func 152))
+  (export "i16x8.q15mulr_sat_s" (func 153))
+  (export "i16x8.all_true" (func 154))
+  (export "i16x8.all_true-if" (func 155))
+  (export "i16x8.all_true-br_if" (func 156))
+  (export "i16x8.bitmask" (func 157))
+  (export "i16x8.narrow_i32x4_s" (func 158))
+  (export "i16x8.narrow_i32x4_u" (func 159))
+  (export "i16x8.extend_low_i8x16_s" (func 160))
+  (export "i16x8.extend_high_i8x16_s" (func 161))
+  (export "i16x8.extend_low_i8x16_u" (func 162))
+  (export "i16x8.extend_high_i8x16_u" (func 163))
+  (export "i16x8.shl" (func 164))
+  (export "i16x8.shl-0" (func 165))
+  (export "i16x8.shl-1" (func 166))
+  (export "i16x8.shl-15" (func 167))
+  (export "i16x8.shl-16" (func 168))
+  (export "i16x8.shl-19" (func 169))
+  (export "i16x8.shr_s" (func 170))
+  (export "i16x8.shr_s-0" (func 171))
+  (export "i16x8.shr_s-1" (func 172))
+  (export "i16x8.shr_s-15" (func 173))
+  (export "i16x8.shr_s-16" (func 174))
+  (export "i16x8.shr_s-19" (func 175))
+  (export "i16x8.shr_u" (func 176))
+  (export "i16x8.shr_u-0" (func 177))
+  (export "i16x8.shr_u-1" (func 178))
+  (export "i16x8.shr_u-15" (func 179))
+  (export "i16x8.shr_u-16" (func 180))
+  (export "i16x8.shr_u-19" (func 181))
+  (export "i16x8.add" (func 182))
+  (export "i16x8.add_sat_s" (func 183))
+  (export "i16x8.add_sat_u" (func 184))
+  (export "i16x8.sub" (func 185))
+  (export "i16x8.sub_sat_s" (func 186))
+  (export "i16x8.sub_sat_u" (func 187))
+  (export "f64x2.nearest" (func 188))
+  (export "i16x8.mul" (func 189))
+  (export "i16x8.min_s" (func 190))
+  (export "i16x8.min_u" (func 191))
+  (export "i16x8.max_s" (func 192))
+  (export "i16x8.max_u" (func 193))
+  (export "i16x8.avgr_u" (func 194))
+  (export "i16x8.extmul_low_i8x16_s" (func 195))
+  (export "i16x8.extmul_high_i8x16_s" (func 196))
+  (export "i16x8.extmul_low_i8x16_u" (func 197))
+  (export "i16x8.extmul_high_i8x16_u" (func 198))
+  (export "i32x4.abs" (func 199))
+  (export "i32x4.neg" (func 200))
+  (export "i32x4.all_true" (func 201))
+  (export "i32x4.all_true-if" (func 202))
+  (export "i32x4.all_true-br_if" (func 203))
+  (export "i32x4.bitmask" (func 204))
+  (export "i32x4.extend_low_i16x8_s" (func 205))
+  (export "i32x4.extend_high_i16x8_s" (func 206))
+  (export "i32x4.extend_low_i16x8_u" (func 207))
+  (export "i32x4.extend_high_i16x8_u" (func 208))
+  (export "i32x4.shl" (func 209))
+  (export "i32x4.shl-0" (func 210))
+  (export "i32x4.shl-1" (func 211))
+  (export "i32x4.shl-31" (func 212))
+  (export "i32x4.shl-32" (func 213))
+  (export "i32x4.shl-35" (func 214))
+  (export "i32x4.shr_s" (func 215))
+  (export "i32x4.shr_s-0" (func 216))
+  (export "i32x4.shr_s-1" (func 217))
+  (export "i32x4.shr_s-31" (func 218))
+  (export "i32x4.shr_s-32" (func 219))
+  (export "i32x4.shr_s-35" (func 220))
+  (export "i32x4.shr_u" (func 221))
+  (export "i32x4.shr_u-0" (func 222))
+  (export "i32x4.shr_u-1" (func 223))
+  (export "i32x4.shr_u-31" (func 224))
+  (export "i32x4.shr_u-32" (func 225))
+  (export "i32x4.shr_u-35" (func 226))
+  (export "i32x4.add" (func 227))
+  (export "i32x4.sub" (func 228))
+  (export "i32x4.mul" (func 229))
+  (export "i32x4.min_s" (func 230))
+  (export "i32x4.min_u" (func 231))
+  (export "i32x4.max_s" (func 232))
+  (export "i32x4.max_u" (func 233))
+  (export "i32x4.dot_i16x8_s" (func 234))
+  (export "i32x4.extmul_low_i16x8_s" (func 235))
+  (export "i32x4.extmul_high_i16x8_s" (func 236))
+  (export "i32x4.extmul_low_i16x8_u" (func 237))
+  (export "i32x4.extmul_high_i16x8_u" (func 238))
+  (export "i64x2.abs" (func 239))
+  (export "i64x2.neg" (func 240))
+  (export "i64x2.all_true" (func 241))
+  (export "i64x2.all_true-if" (func 242))
+  (export "i64x2.all_true-br_if" (func 243))
+  (export "i64x2.bitmask" (func 244))
+  (export "i64x2.extend_low_i32x4_s" (func 245))
+  (export "i64x2.extend_high_i32x4_s" (func 246))
+  (export "i64x2.extend_low_i32x4_u" (func 247))
+  (export "i64x2.extend_high_i32x4_u" (func 248))
+  (export "i64x2.shl" (func 249))
+  (export "i64x2.shl-0" (func 250))
+  (export "i64x2.shl-1" (func 251))
+  (export "i64x2.shl-63" (func 252))
+  (export "i64x2.shl-64" (func 253))
+  (export "i64x2.shl-67" (func 254))
+  (export "i64x2.shr_s" (func 255))
+  (export "i64x2.shr_s-0" (func 256))
+  (export "i64x2.shr_s-1" (func 257))
+  (export "i64x2.shr_s-63" (func 258))
+  (export "i64x2.shr_s-64" (func 259))
+  (export "i64x2.shr_s-67" (func 260))
+  (export "i64x2.shr_u" (func 261))
+  (export "i64x2.shr_u-0" (func 262))
+  (export "i64x2.shr_u-1" (func 263))
+  (export "i64x2.shr_u-63" (func 264))
+  (export "i64x2.shr_u-64" (func 265))
+  (export "i64x2.shr_u-67" (func 266))
+  (export "i64x2.add" (func 267))
+  (export "i64x2.sub" (func 268))
+  (export "i64x2.mul" (func 269))
+  (export "i64x2.eq" (func 270))
+  (export "i64x2.ne" (func 271))
+  (export "i64x2.lt_s" (func 272))
+  (export "i64x2.gt_s" (func 273))
+  (export "i64x2.le_s" (func 274))
+  (export "i64x2.ge_s" (func 275))
+  (export "i64x2.extmul_low_i32x4_s" (func 276))
+  (export "i64x2.extmul_high_i32x4_s" (func 277))
+  (export "i64x2.extmul_low_i32x4_u" (func 278))
+  (export "i64x2.extmul_high_i32x4_u" (func 279))
+  (export "f32x4.abs" (func 280))
+  (export "f32x4.neg" (func 281))
+  (export "f32x4.sqrt" (func 282))
+  (export "f32x4.add" (func 283))
+  (export "f32x4.sub" (func 284))
+  (export "f32x4.mul" (func 285))
+  (export "f32x4.div" (func 286))
+  (export "f32x4.min" (func 287))
+  (export "f32x4.max" (func 288))
+  (export "f32x4.pmin" (func 289))
+  (export "f32x4.pmax" (func 290))
+  (export "f64x2.abs" (func 291))
+  (export "f64x2.neg" (func 292))
+  (export "f64x2.sqrt" (func 293))
+  (export "f64x2.add" (func 294))
+  (export "f64x2.sub" (func 295))
+  (export "f64x2.mul" (func 296))
+  (export "f64x2.div" (func 297))
+  (export "f64x2.min" (func 298))
+  (export "f64x2.max" (func 299))
+  (export "f64x2.pmin" (func 300))
+  (export "f64x2.pmax" (func 301))
+  (export "i32x4.trunc_sat_f32x4_s" (func 302))
+  (export "i32x4.trunc_sat_f32x4_u" (func 303))
+  (export "f32x4.convert_i32x4_s" (func 304))
+  (export "f32x4.convert_i32x4_u" (func 305))
+  (export "i32x4.trunc_sat_f64x2_s_zero" (func 306))
+  (export "i32x4.trunc_sat_f64x2_u_zero" (func 307))
+  (export "f64x2.convert_low_i32x4_s" (func 308))
+  (export "f64x2.convert_low_i32x4_u" (func 309))
+  (export "const-0-0" (func 310))
+  (export "const-102030405060708-102030405060708" (func 311))
+  (export "const-ffffffffffffffff-0" (func 312))
+  (export "const-123456789abcdef0-fedcba987654321" (func 313))
+  (export "const-0-8000000000000000" (func 314))
+  (export "shuffle-reverse" (func 315))
+  (export "shuffle-interleave" (func 316))
+  (export "shuffle-first" (func 317))
+  (export "shuffle-second" (func 318))
+  (export "shuffle-dup" (func 319))
+  (export "same-operand" (func 320))
+  (export "deep-stack" (func 321))
+  (export "v128.load-0" (func 322))
+  (export "v128.load-3" (func 323))
+  (export "v128.load-4096" (func 324))
+  (export "v128.load-const" (func 325))
+  (export "v128.load8x8_s-0" (func 326))
+  (export "v128.load8x8_s-3" (func 327))
+  (export "v128.load8x8_s-4096" (func 328))
+  (export "v128.load8x8_s-const" (func 329))
+  (export "v128.load8x8_u-0" (func 330))
+  (export "v128.load8x8_u-3" (func 331))
+  (export "v128.load8x8_u-4096" (func 332))
+  (export "v128.load8x8_u-const" (func 333))
+  (export "v128.load16x4_s-0" (func 334))
+  (export "v128.load16x4_s-3" (func 335))
+  (export "v128.load16x4_s-4096" (func 336))
+  (export "v128.load16x4_s-const" (func 337))
+  (export "v128.load16x4_u-0" (func 338))
+  (export "v128.load16x4_u-3" (func 339))
+  (export "v128.load16x4_u-4096" (func 340))
+  (export "v128.load16x4_u-const" (func 341))
+  (export "v128.load32x2_s-0" (func 342))
+  (export "v128.load32x2_s-3" (func 343))
+  (export "v128.load32x2_s-4096" (func 344))
+  (export "v128.load32x2_s-const" (func 345))
+  (export "v128.load32x2_u-0" (func 346))
+  (export "v128.load32x2_u-3" (func 347))
+  (export "v128.load32x2_u-4096" (func 348))
+  (export "v128.load32x2_u-const" (func 349))
+  (export "v128.load8_splat-0" (func 350))
+  (export "v128.load8_splat-3" (func 351))
+  (export "v128.load8_splat-4096" (func 352))
+  (export "v128.load8_splat-const" (func 353))
+  (export "v128.load16_splat-0" (func 354))
+  (export "v128.load16_splat-3" (func 355))
+  (export "v128.load16_splat-4096" (func 356))
+  (export "v128.load16_splat-const" (func 357))
+  (export "v128.load32_splat-0" (func 358))
+  (export "v128.load32_splat-3" (func 359))
+  (export "v128.load32_splat-4096" (func 360))
+  (export "v128.load32_splat-const" (func 361))
+  (export "v128.load64_splat-0" (func 362))
+  (export "v128.load64_splat-3" (func 363))
+  (export "v128.load64_splat-4096" (func 364))
+  (export "v128.load64_splat-const" (func 365))
+  (export "v128.load32_zero-0" (func 366))
+  (export "v128.load32_zero-3" (func 367))
+  (export "v128.load32_zero-4096" (func 368))
+  (export "v128.load32_zero-const" (func 369))
+  (export "v128.load64_zero-0" (func 370))
+  (export "v128.load64_zero-3" (func 371))
+  (export "v128.load64_zero-4096" (func 372))
+  (export "v128.load64_zero-const" (func 373))
+  (export "v128.load8_lane-0" (func 374))
+  (export "v128.store8_lane-0" (func 375))
+  (export "v128.load8_lane-15" (func 376))
+  (export "v128.store8_lane-15" (func 377))
+  (export "v128.load16_lane-0" (func 378))
+  (export "v128.store16_lane-0" (func 379))
+  (export "v128.load16_lane-7" (func 380))
+  (export "v128.store16_lane-7" (func 381))
+  (export "v128.load32_lane-0" (func 382))
+  (export "v128.store32_lane-0" (func 383))
+  (export "v128.load32_lane-3" (func 384))
+  (export "v128.store32_lane-3" (func 385))
+  (export "v128.load64_lane-0" (func 386))
+  (export "v128.store64_lane-0" (func 387))
+  (export "v128.load64_lane-1" (func 388))
+  (export "v128.store64_lane-1" (func 389))
+  (export "v128.store" (func 390))
+  (export "copy-loop" (func 391))
+  (export "call-v128" (func 394))
+  (export "call-mixed" (func 395))
+  (export "spill" (func 396))
+  (export "spill-call" (func 397))
+  (export "zero-local" (func 398))
+  (export "if-result" (func 399))
+  (export "block-br" (func 400))
+  (export "loop-sum" (func 401))
+  (export "return-v128" (func 403))
+  (export "bench-fill" (func 404))
+  (export "bench-dot-scalar" (func 405))
+  (export "bench-dot-simd" (func 406))
+  (export "bench-copy-scalar" (func 407))
+  (export "bench-copy-simd" (func 408))
+  (export "bench-count-scalar" (func 409))
+  (export "bench-count-simd" (func 410))
+  (data (;0;) (i32.const 0) "\00\01\02\03\04\05\06\07\08\09\0a\0b\0c\0d\0e\0f\10\11\12\13\14\15\16\17\18\19\1a\1b\1c\1d\1e\1f !\22#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\5c]^_`abcdefghijklmnopqrstuvwxyz{|}~\7f\80\81\82\83\84\85\86\87\88\89\8a\8b\8c\8d\8e\8f\90\91\92\93\94\95\96\97\98\99\9a\9b\9c\9d\9e\9f\a0\a1\a2\a3\a4\a5\a6\a7\a8\a9\aa\ab\ac\ad\ae\af\b0\b1\b2\b3\b4\b5\b6\b7\b8\b9\ba\bb\bc\bd\be\bf\c0\c1\c2\c3\c4\c5\c6\c7\c8\c9\ca\cb\cc\cd\ce\cf\d0\d1\d2\d3\d4\d5\d6\d7\d8\d9\da\db\dc\dd\de\df\e0\e1\e2\e3\e4\e5\e6\e7\e8\e9\ea\eb\ec\ed\ee\ef\f0\f1\f2\f3\f4\f5\f6\f7\f8\f9\fa\fb\fc\fd\fe\ff"))
@@ -0,0 +1,393 @@
+(module
+  (type (;0;) (func (param i32) (result i32)))
+  (type (;1;) (func (param i64) (result i64)))
+  (func (;0;) (type 0) (param i32) (result i32)
+    (local i32 i32 i32 i32 i32 i32 i32 i32 i32 i32 i32 i32 i32 i32 i32 i32 i32 i32 i32 i32)
+    i32.const 1
+    local.set 1
+    i32.const 2
+    local.set 2
+    i32.const 3
+    local.set 3
+    i32.const 4
+    local.set 4
+    i32.const 5
+    local.set 5
+    i32.const 6
+    local.set 6
+    i32.const 7
+    local.set 7
+    i32.const 8
+    local.set 8
+    i32.const 9
+    local.set 9
+    i32.const 10
+    local.set 10
+    i32.const 11
+    local.set 11
+    i32.const 12
+    local.set 12
+    i32.const 13
+    local.set 13
+    i32.const 14
+    local.set 14
+    i32.const 15
+    local.set 15
+    i32.const 16
+    local.set 16
+    i32.const 17
+    local.set 17
+    i32.const 18
+    local.set 18
+    i32.const 19
+    local.set 19
+    i32.const 20
+    local.set 20
+    local.get 0
+    local.get 1
+    i32.add
+    local.get 2
+    i32.add
+    local.get 3
+    i32.add
+    local.get 4
+    i32.add
+    local.get 5
+    i32.add
+    local.get 6
+    i32.add
+    local.get 7
+    i32.add
+    local.get 8
+    i32.add
+    local.get 9
+    i32.add
+    local.get 10
+    i32.add
+    local.get 11
+    i32.add
+    local.get 12
+    i32.add
+    local.get 13
+    i32.add
+    local.get 14
+    i32.add
+    local.get 15
+    i32.add
+    local.get 16
+    i32.add
+    local.get 17
+    i32.add
+    local.get 18
+    i32.add
+    local.get 19
+    i32.add
+    local.get 20
+    i32.add)
+  (func (;1;) (type 1) (param i64) (result i64)
+    (local i64 i64 i64 i64 i64 i64 i64 i64 i64 i64 i64 i64 i64 i64 i64 i64 i64 i64 i64 i64)
+    i64.const 1000000000000
+    local.set 1
+    i64.const 2000000000000
+    local.set 2
+    i64.const 3000000000000
+    local.set 3
+    i64.const 4000000000000
+    local.set 4
+    i64.const 5000000000000
+    local.set 5
+    i64.const 6000000000000
+    local.set 6
+    i64.const 7000000000000
+    local.set 7
+    i64.const 8000000000000
+    local.set 8
+    i64.const 9000000000000
+    local.set 9
+    i64.const 10000000000000
+    local.set 10
+    i64.const 11000000000000
+    local.set 11
+    i64.const 12000000000000
+    local.set 12
+    i64.const 13000000000000
+    local.set 13
+    i64.const 14000000000000
+    local.set 14
+    i64.const 15000000000000
+    local.set 15
+    i64.const 16000000000000
+    local.set 16
+    i64.const 17000000000000
+    local.set 17
+    i64.const 18000000000000
+    local.set 18
+    i64.const 19000000000000
+    local.set 19
+    i64.const 20000000000000
+    local.set 20
+    local.get 0
+    local.get 1
+    i64.add
+    local.get 2
+    i64.add
+    local.get 3
+    i64.add
+    local.get 4
+    i64.add
+    local.get 5
+    i64.add
+    local.get 6
+    i64.add
+    local.get 7
+    i64.add
+    local.get 8
+    i64.add
+    local.get 9
+    i64.add
+    local.get 10
+    i64.add
+    local.get 11
+    i64.add
+    local.get 12
+    i64.add
+    local.get 13
+    i64.add
+    local.get 14
+    i64.add
+    local.get 15
+    i64.add
+    local.get 16
+    i64.add
+    local.get 17
+    i64.add
+    local.get 18
+    i64.add
+    local.get 19
+    i64.add
+    local.get 20
+    i64.add)
+  (func (;2;) (type 0) (param i32) (result i32)
+    (local i32 i32 i32 i32 i32 i32 i32 i32 i32 i32 i32 i32 i32 i32 i32 i32 i32 i32 i32 i32)
+    i32.const 1
+    local.set 1
+    i32.const 2
+    local.set 2
+    i32.const 3
+    local.set 3
+    i32.const 4
+    local.set 4
+    i32.const 5
+    local.set 5
+    i32.const 6
+    local.set 6
+    i32.const 7
+    local.set 7
+    i32.const 8
+    local.set 8
+    i32.const 9
+    local.set 9
+    i32.const 10
+    local.set 10
+    i32.const 11
+    local.set 11
+    i32.const 12
+    local.set 12
+    i32.const 13
+    local.set 13
+    i32.const 14
+    local.set 14
+    i32.const 15
+    local.set 15
+    i32.const 16
+    local.set 16
+    i32.const 17
+    local.set 17
+    i32.const 18
+    local.set 18
+    i32.const 19
+    local.set 19
+    i32.const 20
+    local.set 20
+    local.get 0
+    if  ;; label = @1
+      local.get 20
+      local.get 1
+      i32.sub
+      return
+    end
+    local.get 0
+    local.get 1
+    i32.add
+    local.get 2
+    i32.add
+    local.get 3
+    i32.add
+    local.get 4
+    i32.add
+    local.get 5
+    i32.add
+    local.get 6
+    i32.add
+    local.get 7
+    i32.add
+    local.get 8
+    i32.add
+    local.get 9
+    i32.add
+    local.get 10
+    i32.add
+    local.get 11
+    i32.add
+    local.get 12
+    i32.add
+    local.get 13
+    i32.add
+    local.get 14
+    i32.add
+    local.get 15
+    i32.add
+    local.get 16
+    i32.add
+    local.get 17
+    i32.add
+    local.get 18
+    i32.add
+    local.get 19
+    i32.add
+    local.get 20
+    i32.add)
+  (func (;3;) (type 0) (param i32) (result i32)
+    (local i32 i32 i32 i32 i32 i32 i32 i32 i32 i32 i32 i32 i32 i32 i32 i32 i32 i32 i32 i32)
+    local.get 0
+    local.get 1
+    i32.add
+    local.get 2
+    i32.add
+    local.get 3
+    i32.add
+    local.get 4
+    i32.add
+    local.get 5
+    i32.add
+    local.get 6
+    i32.add
+    local.get 7
+    i32.add
+    local.get 8
+    i32.add
+    local.get 9
+    i32.add
+    local.get 10
+    i32.add
+    local.get 11
+    i32.add
+    local.get 12
+    i32.add
+    local.get 13
+    i32.add
+    local.get 14
+    i32.add
+    local.get 15
+    i32.add
+    local.get 16
+    i32.add
+    local.get 17
+    i32.add
+    local.get 18
+    i32.add
+    local.get 19
+    i32.add
+    local.get 20
+    i32.add)
+  (func (;4;) (type 0) (param i32) (result i32)
+    (local i32 i32 i32 i32 i32 i32 i32 i32 i32 i32 i32 i32 i32 i32 i32 i32 i32 i32 i32 i32)
+    i32.const 1
+    local.set 1
+    i32.const 2
+    local.set 2
+    i32.const 3
+    local.set 3
+    i32.const 4
+    local.set 4
+    i32.const 5
+    local.set 5
+    i32.const 6
+    local.set 6
+    i32.const 7
+    local.set 7
+    i32.const 8
+    local.set 8
+    i32.const 9
+    local.set 9
+    i32.const 10
+    local.set 10
+    i32.const 11
+    local.set 11
+    i32.const 12
+    local.set 12
+    i32.const 13
+    local.set 13
+    i32.const 14
+    local.set 14
+    i32.const 15
+    local.set 15
+    i32.const 16
+    local.set 16
+    i32.const 17
+    local.set 17
+    i32.const 18
+    local.set 18
+    i32.const 19
+    local.set 19
+    i32.const 20
+    local.set 20
+    local.get 0
+    local.tee 19
+    local.set 20
+    local.get 0
+    local.get 1
+    i32.add
+    local.get 2
+    i32.add
+    local.get 3
+    i32.add
+    local.get 4
+    i32.add
+    local.get 5
+    i32.add
+    local.get 6
+    i32.add
+    local.get 7
+    i32.add
+    local.get 8
+    i32.add
+    local.get 9
+    i32.add
+    local.get 10
+    i32.add
+    local.get 11
+    i32.add
+    local.get 12
+    i32.add
+    local.get 13
+    i32.add
+    local.get 14
+    i32.add
+    local.get 15
+    i32.add
+    local.get 16
+    i32.add
+    local.get 17
+    i32.add
+    local.get 18
+    i32.add
+    local.get 19
+    i32.add
+    local.get 20
+    i32.add)
+  (export "sum-locals" (func 0))
+  (export "sum-locals-i64" (func 1))
+  (export "early-return" (func 2))
+  (export "zero-locals" (func 3))
+  (export "tee-spilled" (func 4)))
@@ -1,33 +1,35 @@
-#include <csetjmp>
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <elf.h>
+#include <fcntl.h>
 #include <fstream>
 #include <gtest/gtest.h>
 #include <iostream>
+#include <map>
 #include <nlohmann/json.hpp>
+#include <unistd.h>
 
+#include "parser/CodeArena.hpp"
+#include "parser/CodeCache.hpp"
+#include "parser/ElfObject.hpp"
+#include "parser/LEB128.hpp"
+#include "parser/LinearMemory.hpp"
+#include "parser/MappedFile.hpp"
+#include "parser/RegisterAllocator.hpp"
+#include "parser/Runtime.hpp"
+#include "parser/Sha256.hpp"
+#include "parser/Stack.hpp"
+#include "parser/StreamingParser.hpp"
 #include "parser/aarch64_assembler.hpp"
-#include "parser/aarch64_common.hpp"
 #include "parser/parser.hpp"
 #include "parser/util.hpp"
 
 using json = nlohmann::json;
 
-int globalTrapCode = -1;
-static jmp_buf env;
-// NOLINT(cert-err52-cpp)
-void trap(int trapCode) {
-  std::cout << "wasm Trap success! get trapCode : " << trapCode << std::endl;
-  globalTrapCode = trapCode;
-  longjmp(env, trapCode);
-}
-
-int getTrapCode() {
-  auto ret = globalTrapCode;
-  globalTrapCode = -1;
-  return ret;
-}
-
-TEST(JsonTest, ParseJson) {
-  std::ifstream ifs("../if.json");
+// run every command of a wast2json spec file
+void runSpecJson(const std::string &jsonFilePath) {
+  std::ifstream ifs(jsonFilePath);
   if (!ifs.is_open()) {
     std::cerr << "Could not open the file!" << std::endl;
     return;
@@ -42,6 +44,7 @@ TEST(JsonTest, ParseJson) {
   std::string wasmFilePathPrefix = "../";
 
   ModuleInfo moduleInfo;
+  std::unique_ptr<Runtime> runtime;
 
   for (const auto &command : commands) {
     std::cout << "Command type: " << command["type"].get<std::string>() << ", line: " << command["line"].get<int>() << std::endl;
@@ -53,122 +56,448 @@ TEST(JsonTest, ParseJson) {
       std::string wasmFilePath = wasmFilePathPrefix + commandFilename;
       moduleInfo = processWasmFile(wasmFilePath.data());
       compileOpCode(moduleInfo);
+      runtime = std::make_unique<Runtime>(moduleInfo);
       continue;
     }
-    AArch64_Assembler assembler(moduleInfo);
-    std::string funcName;
-    if (command.contains("action")) {
-      std::cout << "Action type: " << command["action"]["type"].get<std::string>() << std::endl;
-      std::cout << "Action field: " << command["action"]["field"].get<std::string>() << std::endl;
-      funcName = command["action"]["field"].get<std::string>();
-
-      assembler.stpSpecial1();
-      assembler.moveSpecial1();
-
-      if (command["action"].contains("args")) {
-        const auto &args = command["action"]["args"];
-        TReg reg = TReg::R0;
-
-        for (const auto &arg : args) {
-          auto value = convertStringToUint64(arg["value"].get<std::string>());
-          bool is64 = (arg["type"].get<std::string>() == "i64");
-          assembler.MOVimm(is64, reg, convertStringToUint64(arg["value"].get<std::string>()));
-          reg = static_cast<TReg>(static_cast<uint8_t>(reg) + 1);
-          std::cout << "Arg type: " << arg["type"].get<std::string>() << ", value: " << arg["value"].get<std::string>() << std::endl;
-        }
-      }
-      void (*funcPtr)(int) = trap;
-      uint64_t trapAddress = (uint64_t)(uintptr_t)funcPtr;
-      assembler.MOVimm(true, TReg::R28, trapAddress);
-
-      assembler.blSpecial1();
+    if (!command.contains("action")) {
+      continue;
     }
 
-    assembler.ldpSpecial1();
-    assembler.Ret();
-
-    std::vector<uint8_t> testInstr = assembler.getInstructions();
+    std::cout << "Action type: " << command["action"]["type"].get<std::string>() << std::endl;
+    std::cout << "Action field: " << command["action"]["field"].get<std::string>() << std::endl;
+    auto funcName = command["action"]["field"].get<std::string>();
     auto needTestedFuncIndex = moduleInfo.functionsNameIndex.find(funcName);
-
     if (needTestedFuncIndex == moduleInfo.functionsNameIndex.end()) {
       std::cout << "func name:" << funcName << " is not found in moduleInfo" << std::endl;
       exit(1);
     }
 
-    auto testFuncInstr = moduleInfo.machineCodes[needTestedFuncIndex->second];
-    testInstr.insert(testInstr.end(), testFuncInstr.begin(), testFuncInstr.end());
-    std::cout << "test instr is :[";
-    for (size_t i = 0; i < testInstr.size(); ++i) {
-      std::cout << "0x" << std::hex << std::setw(2) << std::setfill('0') << static_cast<int>(testInstr[i]);
-      if (i < testInstr.size() - 1) {
-        std::cout << ", ";
+    std::vector<uint64_t> args;
+    if (command["action"].contains("args")) {
+      for (const auto &arg : command["action"]["args"]) {
+        args.push_back(convertStringToUint64(arg["value"].get<std::string>()));
+        std::cout << "Arg type: " << arg["type"].get<std::string>() << ", value: " << arg["value"].get<std::string>() << std::endl;
       }
     }
-    std::cout << "]" << std::endl;
+
+    auto commandType = command["type"].get<std::string>();
+    if (commandType == "assert_trap") {
+      auto const &trapText = command["text"].get<std::string>();
+      uint32_t shouldTrapCode = 2U; // integer overflow
+      if (trapText == "integer divide by zero") {
+        shouldTrapCode = 1U;
+      } else if (trapText == "out of bounds memory access") {
+        shouldTrapCode = 3U;
+      } else if (trapText == "invalid conversion to integer") {
+        shouldTrapCode = 4U;
+      }
+      try {
+        runtime->invoke(needTestedFuncIndex->second, args);
+        FAIL() << "expected trap: " << command["text"].get<std::string>();
+      } catch (const WasmTrap &wasmTrap) {
+        std::cout << "wasm Trap success! get trapCode : " << wasmTrap.trapCode() << std::endl;
+        ASSERT_EQ(wasmTrap.trapCode(), shouldTrapCode);
+      }
+      continue;
+    }
+
+    uint64_t const result = runtime->invoke(needTestedFuncIndex->second, args);
     if (command.contains("expected")) {
-      const auto &expected = command["expected"];
-      for (const auto &exp : expected) {
+      for (const auto &exp : command["expected"]) {
         std::cout << "Expected type: " << exp["type"].get<std::string>() << std::endl;
         if (exp.contains("value")) {
           std::cout << ", value: " << exp["value"].get<std::string>() << std::endl;
         }
-        if (exp["type"].get<std::string>() == "i32") {
-          uint32_t (*func)() = nullptr;
-          func = reinterpret_cast<uint32_t (*)()>(
-              mmap(nullptr, testInstr.size(), PROT_READ | PROT_WRITE | PROT_EXEC, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
-          memcpy(reinterpret_cast<void *>(func), testInstr.data(), testInstr.size());
-          __builtin___clear_cache(reinterpret_cast<char *>(func), reinterpret_cast<char *>(func) + testInstr.size());
-          auto commandType = command["type"].get<std::string>();
-          if (commandType == "assert_trap") {
-            auto shouldTrapCode = command["text"].get<std::string>() == "integer divide by zero" ? 1 : 2;
-            // NOLINT(cert-err52-cpp)
-            if (setjmp(env) == 0) {
-              auto result = func();
-              ASSERT_EQ(result, convertStringToUint64(exp["value"].get<std::string>()));
-            } else {
-              ASSERT_EQ(getTrapCode(), shouldTrapCode);
-            }
+        auto const &expType = exp["type"].get<std::string>();
+        auto const &expValue = exp["value"].get<std::string>();
+        if (expValue.compare(0U, 4U, "nan:") == 0) {
+          // nan:canonical or nan:arithmetic, any NaN with the sign bit clear or set passes
+          if (expType == "f32") {
+            ASSERT_EQ(static_cast<uint32_t>(result) & 0x7F800000U, 0x7F800000U);
+            ASSERT_NE(static_cast<uint32_t>(result) & 0x007FFFFFU, 0U);
           } else {
-            auto result = func();
-            ASSERT_EQ(result, convertStringToUint64(exp["value"].get<std::string>()));
+            ASSERT_EQ(result & 0x7FF0000000000000U, 0x7FF0000000000000U);
+            ASSERT_NE(result & 0x000FFFFFFFFFFFFFU, 0U);
           }
-          munmap(reinterpret_cast<void *>(func), testInstr.size());
+        } else if ((expType == "i32") || (expType == "f32")) {
+          ASSERT_EQ(static_cast<uint32_t>(result), static_cast<uint32_t>(convertStringToUint64(expValue)));
         } else {
-          uint64_t (*func)() = nullptr;
-          func = reinterpret_cast<uint64_t (*)()>(
-              mmap(nullptr, testInstr.size(), PROT_READ | PROT_WRITE | PROT_EXEC, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
-          memcpy(reinterpret_cast<void *>(func), testInstr.data(), testInstr.size());
-          __builtin___clear_cache(reinterpret_cast<char *>(func), reinterpret_cast<char *>(func) + testInstr.size());
-          auto commandType = command["type"].get<std::string>();
-          if (commandType == "assert_trap") {
-            auto shouldTrapCode = command["text"].get<std::string>() == "integer divide by zero" ? 1 : 2;
-            // NOLINT(cert-err52-cpp)
-            if (setjmp(env) == 0) {
-              auto result = func();
-              ASSERT_EQ(result, convertStringToUint64(exp["value"].get<std::string>()));
-            } else {
-              ASSERT_EQ(getTrapCode(), shouldTrapCode);
-            }
-          } else {
-            auto result = func();
-            ASSERT_EQ(result, convertStringToUint64(exp["value"].get<std::string>()));
-          }
-
-          munmap(reinterpret_cast<void *>(func), testInstr.size());
+          ASSERT_EQ(result, convertStringToUint64(expValue));
         }
       }
-    } else {
-      void (*func)() = nullptr;
-      func = reinterpret_cast<void (*)()>(mmap(nullptr, testInstr.size(), PROT_READ | PROT_WRITE | PROT_EXEC, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
-      memcpy(reinterpret_cast<void *>(func), testInstr.data(), testInstr.size());
-      __builtin___clear_cache(reinterpret_cast<char *>(func), reinterpret_cast<char *>(func) + testInstr.size());
-      func();
-
-      munmap(reinterpret_cast<void *>(func), testInstr.size());
     }
   }
 }
 
+TEST(JsonTest, ParseJson) {
+  runSpecJson("../if.json");
+}
+
+TEST(JsonTest, NestedBlocks) {
+  runSpecJson("../block.json");
+}
+
+TEST(JsonTest, SpilledLocals) {
+  runSpecJson("../spill.json");
+}
+
+TEST(JsonTest, DeferredActions) {
+  runSpecJson("../deferred.json");
+}
+
+TEST(JsonTest, ImmediateOperands) {
+  runSpecJson("../immediate.json");
+}
+
+TEST(JsonTest, ConstantFolding) {
+  runSpecJson("../fold.json");
+}
+
+TEST(JsonTest, DivisionByConstant) {
+  runSpecJson("../divconst.json");
+}
+
+TEST(JsonTest, FusedBranches) {
+  runSpecJson("../branch.json");
+}
+
+TEST(JsonTest, BranchesAndJumpTables) {
+  runSpecJson("../br.json");
+}
+
+TEST(JsonTest, DirectCalls) {
+  runSpecJson("../call.json");
+}
+
+TEST(JsonTest, LinearMemory) {
+  runSpecJson("../memory.json");
+}
+
+TEST(JsonTest, FloatArithmetic) {
+  runSpecJson("../float.json");
+}
+
+TEST(JsonTest, SimdOperations) {
+  runSpecJson("../simd.json");
+}
+
+TEST(StreamingTest, ChunkedStreamMatchesMappedFile) {
+  ModuleInfo expected = processWasmFile("../if.0.wasm");
+  compileOpCode(expected);
+
+  int const fd = open("../if.0.wasm", O_RDONLY);
+  ASSERT_GE(fd, 0);
+  // small odd chunks so section headers and function bodies get split
+  ModuleInfo streamed = processWasmStream(fd, true, 7U);
+  close(fd);
+
+  ASSERT_EQ(streamed.machineCodes, expected.machineCodes);
+  ASSERT_EQ(streamed.functionsNameIndex, expected.functionsNameIndex);
+}
+
+TEST(ParallelCompileTest, MatchesSerialCompile) {
+  ModuleInfo serial = processWasmFile("../if.0.wasm");
+  compileOpCode(serial);
+
+  ModuleInfo parallel = processWasmFile("../if.0.wasm");
+  compileOpCode(parallel, 4U);
+
+  ASSERT_EQ(parallel.machineCodes, serial.machineCodes);
+}
+
+TEST(CodeCacheTest, HitSkipsCompileAndRejectsCorruptEntries) {
+  char directory[] = "/tmp/codecacheXXXXXX";
+  ASSERT_NE(mkdtemp(directory), nullptr);
+  CodeCache const codeCache(directory);
+
+  ModuleInfo compiled = compileWasmFileCached("../memory.0.wasm", codeCache);
+  ModuleInfo cached = compileWasmFileCached("../memory.0.wasm", codeCache);
+  ASSERT_TRUE(cached.functionsInstructions.empty()); // nothing was parsed
+  ASSERT_EQ(cached.machineCodes, compiled.machineCodes);
+  ASSERT_EQ(cached.functionsNameIndex, compiled.functionsNameIndex);
+  Runtime const runtime(cached);
+  ASSERT_EQ(runtime.invoke(runtime.exportedFunction("load8_u"), 16), 97U); // from a data segment
+
+  std::shared_ptr<MappedFile> const wasmFile = MappedFile::open("../memory.0.wasm");
+  std::string const entryPath = codeCache.entryPath(CodeCache::moduleKey(wasmFile->bytes()));
+  std::shared_ptr<MappedFile> const otherFile = MappedFile::open("../call.0.wasm");
+  uint64_t const otherKey = CodeCache::moduleKey(otherFile->bytes());
+  std::string const otherPath = codeCache.entryPath(otherKey);
+  ModuleInfo rejected;
+  ASSERT_FALSE(codeCache.load(otherFile->bytes(), rejected)); // no entry
+
+  // the entry of memory.0.wasm under the key of call.0.wasm, as if their keys collided
+  {
+    std::ifstream entry(entryPath, std::ios::binary);
+    std::vector<char> bytes((std::istreambuf_iterator<char>(entry)), std::istreambuf_iterator<char>());
+    std::memcpy(&bytes[16], &otherKey, sizeof(otherKey)); // key after magic, format and compiler version
+    std::ofstream(otherPath, std::ios::binary).write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+  }
+  ASSERT_FALSE(codeCache.load(otherFile->bytes(), rejected));
+
+  {
+    std::fstream entry(entryPath, std::ios::in | std::ios::out | std::ios::binary);
+    entry.seekg(-1, std::ios::end);
+    char const lastByte = static_cast<char>(entry.get() ^ 1);
+    entry.seekp(-1, std::ios::end);
+    entry.put(lastByte);
+  }
+  ASSERT_FALSE(codeCache.load(wasmFile->bytes(), rejected));
+
+  unlink(otherPath.c_str());
+  unlink(entryPath.c_str());
+  rmdir(directory);
+}
+
+TEST(Sha256Test, KnownDigests) {
+  auto const hex = [](const Sha256Digest &digest) {
+    static constexpr char hexDigits[] = "0123456789abcdef";
+    std::string result;
+    for (uint8_t const digestByte : digest) {
+      result += hexDigits[digestByte >> 4U];
+      result += hexDigits[digestByte & 0xFU];
+    }
+    return result;
+  };
+  ASSERT_EQ(hex(sha256(ByteSpan{})), "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855");
+  std::string const abc = "abc";
+  ASSERT_EQ(hex(sha256(ByteSpan{reinterpret_cast<uint8_t const *>(abc.data()), abc.size()})),
+            "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+  // 56 bytes, the length no longer fits the padded block
+  std::string const twoBlocks = "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq";
+  ASSERT_EQ(hex(sha256(ByteSpan{reinterpret_cast<uint8_t const *>(twoBlocks.data()), twoBlocks.size()})),
+            "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1");
+}
+
+TEST(ElfObjectTest, RelocatesCallsAndTrapSites) {
+  ModuleInfo moduleInfo = processWasmFile("../float.0.wasm");
+  compileOpCode(moduleInfo);
+  std::vector<uint8_t> const object = emitElfObject(moduleInfo, "wasm_");
+
+  Elf64_Ehdr elfHeader{};
+  ASSERT_GE(object.size(), sizeof(elfHeader));
+  std::memcpy(&elfHeader, object.data(), sizeof(elfHeader));
+  ASSERT_EQ(std::memcmp(elfHeader.e_ident, ELFMAG, SELFMAG), 0);
+  ASSERT_EQ(elfHeader.e_type, ET_REL);
+  ASSERT_EQ(elfHeader.e_machine, EM_AARCH64);
+  std::vector<Elf64_Shdr> sectionHeaders(elfHeader.e_shnum);
+  std::memcpy(sectionHeaders.data(), object.data() + elfHeader.e_shoff, elfHeader.e_shnum * sizeof(Elf64_Shdr));
+  char const *const sectionNames = reinterpret_cast<char const *>(object.data() + sectionHeaders[elfHeader.e_shstrndx].sh_offset);
+  std::map<std::string, Elf64_Shdr> sections;
+  for (const Elf64_Shdr &sectionHeader : sectionHeaders) {
+    sections[sectionNames + sectionHeader.sh_name] = sectionHeader;
+  }
+
+  // apart from the BLs left to the linker the functions are laid out like in the code arena
+  uint8_t const *const text = object.data() + sections[".text"].sh_offset;
+  size_t numCallSites = 0U;
+  for (size_t funcIndex = 0U; funcIndex < moduleInfo.machineCodes.size(); funcIndex++) {
+    size_t const entryOffset = moduleInfo.codeArena->entryOffset(funcIndex);
+    for (const ModuleInfo::CallSite &callSite : moduleInfo.callSites[funcIndex]) {
+      ASSERT_EQ((text[entryOffset + callSite.instructionIndex * 4U + 3U] & 0xFCU), 0x94U);
+      numCallSites++;
+    }
+    if (moduleInfo.callSites[funcIndex].empty()) {
+      ASSERT_EQ(std::memcmp(text + entryOffset, moduleInfo.codeArena->base() + entryOffset, moduleInfo.machineCodes[funcIndex].size() * 4U), 0);
+    }
+  }
+
+  auto const countRelocations = [&object](const Elf64_Shdr &relocations, uint32_t const type) {
+    size_t count = 0U;
+    for (size_t offset = 0U; offset < relocations.sh_size; offset += sizeof(Elf64_Rela)) {
+      Elf64_Rela rela{};
+      std::memcpy(&rela, object.data() + relocations.sh_offset + offset, sizeof(rela));
+      count += (ELF64_R_TYPE(rela.r_info) == type) ? 1U : 0U;
+    }
+    return count;
+  };
+  size_t numTrapSites = 0U;
+  for (const std::vector<ModuleInfo::TrapSite> &trapSites : moduleInfo.trapSites) {
+    numTrapSites += trapSites.size();
+  }
+  ASSERT_GT(numTrapSites, 0U);
+  ASSERT_EQ(countRelocations(sections[".rela.text"], R_AARCH64_CALL26), numCallSites);
+  // the trap sites, the data segment table, the bytes of each data segment and the grow function of the host, all of them in a
+  // writable section so a PIE link needs no text relocations
+  ASSERT_TRUE(moduleInfo.hasMemory);
+  ASSERT_EQ(countRelocations(sections[".rela.data.rel.ro"], R_AARCH64_ABS64), 3U + numTrapSites + moduleInfo.dataSegments.size());
+  ASSERT_EQ(sections[".data.rel.ro"].sh_flags, static_cast<uint64_t>(SHF_ALLOC | SHF_WRITE));
+  ASSERT_EQ(sections.count(".rela.rodata"), 0U);
+
+  // the descriptor tells the host how to lay out the memory around the base
+  uint8_t const *const descriptor = object.data() + sections[".data.rel.ro"].sh_offset;
+  uint64_t reservationSize = 0U;
+  int32_t headerOffsets[2] = {};
+  uint32_t outOfBoundsTrapCode = 0U;
+  std::memcpy(&reservationSize, descriptor + 40U, sizeof(reservationSize));
+  std::memcpy(headerOffsets, descriptor + 52U, sizeof(headerOffsets));
+  std::memcpy(&outOfBoundsTrapCode, descriptor + 60U, sizeof(outOfBoundsTrapCode));
+  ASSERT_EQ(reservationSize, LinearMemory::reservationSize);
+  ASSERT_EQ(headerOffsets[0], LinearMemory::growFunctionOffset);
+  ASSERT_EQ(headerOffsets[1], LinearMemory::pagesOffset);
+  ASSERT_EQ(outOfBoundsTrapCode, LinearMemory::outOfBoundsTrapCode);
+
+  // one global function per export without v128, named after it, the locals in front of the first global as ELF demands
+  const Elf64_Shdr &symtab = sections[".symtab"];
+  char const *const symbolNames = reinterpret_cast<char const *>(object.data() + sections[".strtab"].sh_offset);
+  std::vector<Elf64_Sym> symbols(symtab.sh_size / sizeof(Elf64_Sym));
+  std::memcpy(symbols.data(), object.data() + symtab.sh_offset, symtab.sh_size);
+  size_t firstGlobalSymbol = symbols.size();
+  std::map<std::string, Elf64_Sym> exportSymbols;
+  for (size_t i = 1U; i < symbols.size(); i++) {
+    if (ELF64_ST_BIND(symbols[i].st_info) == STB_LOCAL) {
+      ASSERT_EQ(firstGlobalSymbol, symbols.size()); // no local after a global
+      continue;
+    }
+    firstGlobalSymbol = std::min(firstGlobalSymbol, i);
+    if ((ELF64_ST_TYPE(symbols[i].st_info) == STT_FUNC) && (symbols[i].st_shndx != SHN_UNDEF)) {
+      exportSymbols[symbolNames + symbols[i].st_name] = symbols[i];
+    }
+  }
+  ASSERT_EQ(symtab.sh_info, firstGlobalSymbol);
+
+  std::map<uint64_t, uint32_t> textRelocationTypes; // by offset
+  const Elf64_Shdr &relaText = sections[".rela.text"];
+  for (size_t offset = 0U; offset < relaText.sh_size; offset += sizeof(Elf64_Rela)) {
+    Elf64_Rela rela{};
+    std::memcpy(&rela, object.data() + relaText.sh_offset + offset, sizeof(rela));
+    textRelocationTypes[rela.r_offset] = static_cast<uint32_t>(ELF64_R_TYPE(rela.r_info));
+  }
+  size_t numExports = 0U;
+  for (const auto &exported : moduleInfo.functionsNameIndex) {
+    const std::string &signature = moduleInfo.signatureTypes[moduleInfo.functionInfos[exported.second].typeIndex];
+    if (signature.find(static_cast<char>(SignatureType::V128)) != std::string::npos) {
+      continue;
+    }
+    std::string symbolName = "wasm_" + exported.first;
+    for (char &c : symbolName) {
+      c = ((std::isalnum(static_cast<unsigned char>(c)) != 0) || (c == '_')) ? c : '_';
+    }
+    auto const symbol = exportSymbols.find(symbolName);
+    ASSERT_NE(symbol, exportSymbols.end()) << symbolName;
+    ASSERT_EQ(std::string(sectionNames + sectionHeaders[symbol->second.st_shndx].sh_name), ".text");
+    ASSERT_EQ(symbol->second.st_size, 16U);
+    // mov x2, x1; adrp x1, entry; add x1, x1, :lo12:entry; b trampoline
+    uint64_t const stub = symbol->second.st_value;
+    ASSERT_EQ(textRelocationTypes[stub + 4U], static_cast<uint32_t>(R_AARCH64_ADR_PREL_PG_HI21));
+    ASSERT_EQ(textRelocationTypes[stub + 8U], static_cast<uint32_t>(R_AARCH64_ADD_ABS_LO12_NC));
+    ASSERT_EQ(textRelocationTypes[stub + 12U], static_cast<uint32_t>(R_AARCH64_JUMP26));
+    numExports++;
+  }
+  ASSERT_GT(numExports, 0U);
+  ASSERT_EQ(exportSymbols.size(), numExports);
+  ASSERT_EQ(countRelocations(relaText, R_AARCH64_ADR_PREL_PG_HI21), numExports);
+  ASSERT_EQ(countRelocations(relaText, R_AARCH64_ADD_ABS_LO12_NC), numExports);
+  ASSERT_EQ(countRelocations(relaText, R_AARCH64_JUMP26), numExports);
+}
+
+TEST(LEB128Test, FastAndSlowPathAgree) {
+  struct Case {
+    std::vector<uint8_t> bytes;
+    int64_t value;
+  };
+  std::vector<Case> const signedCases = {{{0x00}, 0}, {{0x7F}, -1}, {{0x80, 0x7F}, -128}, {{0xFF, 0xFF, 0xFF, 0xFF, 0x07}, INT32_MAX},
+                                         {{0x80, 0x80, 0x80, 0x80, 0x78}, INT32_MIN}};
+  for (const Case &c : signedCases) {
+    // exact length takes the checked slow path, padding to 16 bytes the fast path
+    std::vector<uint8_t> padded = c.bytes;
+    padded.resize(16U, 0xFFU);
+    size_t slowIndex = 0U;
+    size_t fastIndex = 0U;
+    ASSERT_EQ(readSLEB128(c.bytes, slowIndex), c.value);
+    ASSERT_EQ(readSLEB128(padded, fastIndex), c.value);
+    ASSERT_EQ(slowIndex, c.bytes.size());
+    ASSERT_EQ(fastIndex, c.bytes.size());
+  }
+
+  std::vector<uint8_t> const u64Max = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00};
+  size_t index = 0U;
+  ASSERT_EQ(readULEB128_64(u64Max, index), UINT64_MAX);
+  ASSERT_EQ(index, 10U);
+
+  // unused bits of the last byte set, and a truncated encoding
+  std::vector<uint8_t> const tooLarge = {0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00};
+  index = 0U;
+  ASSERT_THROW(readULEB128(tooLarge, index), std::overflow_error);
+  std::vector<uint8_t> const truncated = {0x80, 0x80};
+  index = 0U;
+  ASSERT_THROW(readULEB128(truncated, index), std::out_of_range);
+}
+
+TEST(OperandStackTest, ReusesStorageAcrossFunctions) {
+  std::vector<StackElement> storage;
+  {
+    Stack stack(storage);
+    stack.reserve(4U);
+    stack.push(StackElement::i32Const(1U));
+    stack.push(StackElement::i32Const(2U));
+    stack.top().data.constUnion.u32 = 3U;
+    ASSERT_EQ(stack.peek(1U).data.constUnion.u32, 1U);
+    ASSERT_EQ(stack.top().data.constUnion.u32, 3U);
+  }
+  StackElement const *const reserved = storage.data();
+  Stack stack(storage);
+  ASSERT_TRUE(stack.empty());
+  stack.reserve(4U);
+  for (uint32_t i = 0U; i < 4U; ++i) {
+    stack.push(StackElement::i64Const(i));
+  }
+  ASSERT_EQ(storage.data(), reserved);
+  stack.pop(4U);
+  ASSERT_THROW(stack.top(), std::out_of_range);
+}
+
+TEST(RegisterAllocatorTest, SharesRegistersAndSpills) {
+  // local 0 is dead before local 2 is written, both are written before they are read
+  std::vector<uint8_t> const disjoint = {0x41, 0x01, 0x21, 0x00, 0x20, 0x00, 0x21, 0x01, 0x41, 0x02,
+                                         0x21, 0x02, 0x20, 0x01, 0x20, 0x02, 0x6A, 0x0B};
+  std::vector<ModuleInfo::LocalVar> locals(3U);
+  for (ModuleInfo::LocalVar &local : locals) {
+    local.wasmType = WasmType::I32;
+  }
+  ModuleInfo::FunctionInfo funcInfo;
+  allocateRegisters(disjoint, 0U, locals, funcInfo);
+  ASSERT_EQ(locals[0].reg, locals[2].reg);
+  ASSERT_NE(locals[0].reg, locals[1].reg);
+  ASSERT_EQ(funcInfo.numLocalsInGPR, 2U);
+  ASSERT_EQ(funcInfo.numSpilledLocals, 0U);
+  ASSERT_FALSE(locals[0].zeroOnEntry || locals[1].zeroOnEntry || locals[2].zeroOnEntry);
+
+  // 20 locals read at the end, all of them hold their implicit zero from the entry on
+  std::vector<uint8_t> sum;
+  for (uint8_t i = 0U; i < 20U; ++i) {
+    sum.insert(sum.end(), {0x20, i});
+  }
+  sum.insert(sum.end(), 19U, 0x6A);
+  sum.push_back(0x0B);
+  locals.assign(20U, locals[0]);
+  funcInfo = ModuleInfo::FunctionInfo{};
+  allocateRegisters(sum, 0U, locals, funcInfo);
+  ASSERT_EQ(funcInfo.numSpilledLocals, 4U);
+  ASSERT_EQ(funcInfo.stackFrameSize, 32U);
+  ASSERT_EQ(funcInfo.numLocalsInGPR, 16U);
+  ASSERT_TRUE(locals[19].zeroOnEntry);
+}
+
+TEST(AssemblerTest, SelectsShortestImmediates) {
+  ModuleInfo moduleInfo;
+  uint32_t encoding = 0U;
+  ASSERT_TRUE(AArch64_Assembler::logicalImmediate(false, 0xFFU, encoding));
+  ASSERT_EQ(encoding, 0x007U);
+  ASSERT_TRUE(AArch64_Assembler::logicalImmediate(true, 0xFFFFFFFF00000000U, encoding));
+  ASSERT_EQ(encoding, 0x181FU);
+  ASSERT_FALSE(AArch64_Assembler::logicalImmediate(false, 0U, encoding));
+  ASSERT_FALSE(AArch64_Assembler::logicalImmediate(false, 0xFFFFFFFFU, encoding));
+  ASSERT_FALSE(AArch64_Assembler::logicalImmediate(true, 0x12345U, encoding));
+
+  AArch64_Assembler assembler(moduleInfo);
+  assembler.MOVimm(true, TReg::R0, 0x10000U);            // movz x0, #1, lsl #16
+  assembler.MOVimm(true, TReg::R1, 0xFFFFFFFFFFFEDBBAU); // movn x1, #0x2445 + movk x1, #0xfffe, lsl #16
+  assembler.MOVimm(false, TReg::R2, 0x55555555U);        // orr w2, wzr, #0x55555555
+  MachineCode const expected = {0xD2A00020U, 0x928488A1U, 0xF2BFFFC1U, 0x3200F3E2U};
+  ASSERT_EQ(assembler.instructions(), expected);
+}
+
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();